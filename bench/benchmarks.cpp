@@ -0,0 +1,272 @@
+#include "Image.h"
+#include "GaussianBlur.h"
+#include "EdgeDetection.h"
+#include "BrightnessAdjust.h"
+#include "Convolution.h"
+#include "FilterPipeline.h"
+#include "FrameStream.h"
+#include "RgbaConvert.h"
+#include "ThreadPool.h"
+#include "TestUtils.h"
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+
+using namespace GorselIsleme;
+using GorselIsleme::test::makeNoiseImage;
+using GorselIsleme::test::nextRandom;
+
+// Kullanim: gorselisleme_bench --benchmark_format=json --benchmark_out=sonuc.json
+// Sonuclar bench/compare_benchmarks.py ile bench/baseline.json'a karsi karsilastirilir.
+// Her olcum gercek zamanla yapilir (isler havuz thread'lerinde calisir) ve
+// Mpix/s sayaci raporlanir.
+
+namespace {
+
+Image makeInput(int size, int channels) {
+    return makeNoiseImage(size, size, channels, 1u);
+}
+
+void setPixelCounter(benchmark::State& state, const Image& image) {
+    const double megapixels = static_cast<double>(image.getWidth()) * image.getHeight() / 1e6;
+    state.counters["Mpix/s"] = benchmark::Counter(megapixels * static_cast<double>(state.iterations()),
+                                                  benchmark::Counter::kIsRate);
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(image.getData().size()));
+}
+
+void runFilter(benchmark::State& state, const Filter& filter, const Image& input) {
+    Image output(input.getWidth(), input.getHeight(), input.getChannels());
+    for (auto _ : state) {
+        filter.apply(input.view(), output.view());
+        benchmark::DoNotOptimize(output.getData().data());
+        benchmark::ClobberMemory();
+    }
+    setPixelCounter(state, input);
+}
+
+// Argumanlar: boyut, kanal, sigma x 10, kernel boyutu
+void BM_GaussianBlur(benchmark::State& state) {
+    const Image input = makeInput(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+    const GaussianBlur blur(state.range(2) / 10.0, static_cast<int>(state.range(3)));
+    runFilter(state, blur, input);
+}
+
+// Argumanlar: boyut, kanal, yon (0: Horizontal, 1: Vertical, 2: Both)
+void BM_EdgeDetection(benchmark::State& state) {
+    const Image input = makeInput(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+    const EdgeDetection edge(static_cast<EdgeDetection::Direction>(state.range(2)));
+    runFilter(state, edge, input);
+}
+
+void BM_BrightnessAdjust(benchmark::State& state) {
+    const Image input = makeInput(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+    const BrightnessAdjust bright(1.3);
+    runFilter(state, bright, input);
+}
+
+// Argumanlar: boyut, kanal, kernel boyutu, strateji (Convolution::Strategy).
+// Kernel ayrilamaz (rastgele katsayilar), yani Separable tam rank calisir.
+void BM_Convolution(benchmark::State& state) {
+    const Image input = makeInput(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+    const int size = static_cast<int>(state.range(2));
+    std::vector<float> kernel(static_cast<size_t>(size) * size);
+    unsigned seed = 7u;
+    for (auto& value : kernel) {
+        value = static_cast<float>(nextRandom(seed) % 100) / (50.0f * size * size);
+    }
+    const Convolution convolution(std::move(kernel), size, size,
+                                  static_cast<Convolution::Strategy>(state.range(3)));
+    runFilter(state, convolution, input);
+}
+
+std::string benchFile(int size, int channels) {
+    return (std::filesystem::temp_directory_path() /
+            ("gorselisleme_bench_" + std::to_string(size) + "_" + std::to_string(channels) + ".pnm")).string();
+}
+
+void BM_Save(benchmark::State& state) {
+    const Image input = makeInput(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+    const std::string path = benchFile(input.getWidth(), input.getChannels());
+    for (auto _ : state) {
+        if (!input.save(path)) {
+            state.SkipWithError("kayit basarisiz");
+            break;
+        }
+    }
+    setPixelCounter(state, input);
+    std::remove(path.c_str());
+}
+
+void BM_Load(benchmark::State& state) {
+    const Image input = makeInput(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+    const std::string path = benchFile(input.getWidth(), input.getChannels());
+    if (!input.save(path)) {
+        state.SkipWithError("kayit basarisiz");
+        return;
+    }
+    for (auto _ : state) {
+        auto loaded = Image::load(path);
+        benchmark::DoNotOptimize(loaded.get());
+    }
+    setPixelCounter(state, input);
+    std::remove(path.c_str());
+}
+
+void addChain(FilterPipeline& pipeline, int chain) {
+    switch (chain) {
+    case 0: // yalnizca nokta islemleri
+        pipeline.addFilter(std::make_unique<BrightnessAdjust>(1.2));
+        pipeline.addFilter(std::make_unique<BrightnessAdjust>(0.9));
+        break;
+    case 1: // bulaniklastirma + parlaklik + kenar
+        pipeline.addFilter(std::make_unique<GaussianBlur>(2.0, 7));
+        pipeline.addFilter(std::make_unique<BrightnessAdjust>(1.2));
+        pipeline.addFilter(std::make_unique<EdgeDetection>());
+        break;
+    default: // genis bulaniklastirma + kenar
+        pipeline.addFilter(std::make_unique<GaussianBlur>(6.0, 37));
+        pipeline.addFilter(std::make_unique<EdgeDetection>());
+        break;
+    }
+}
+
+// Argumanlar: boyut, kanal, zincir, mod (0: Sequential, 1: Tiled)
+void BM_Pipeline(benchmark::State& state) {
+    const Image input = makeInput(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+    FilterPipeline pipeline;
+    addChain(pipeline, static_cast<int>(state.range(2)));
+    pipeline.setExecutionMode(state.range(3) ? FilterPipeline::Tiled : FilterPipeline::Sequential);
+    Image output(input.getWidth(), input.getHeight(), input.getChannels());
+    for (auto _ : state) {
+        pipeline.apply(input, output);
+        benchmark::DoNotOptimize(output.getData().data());
+    }
+    setPixelCounter(state, input);
+}
+
+// Argumanlar: boyut, zincir. Gri kare akisi; asamalar ayri thread'lerde,
+// her an asama sayisi + 1 kare yolda
+void BM_FrameStream(benchmark::State& state) {
+    const Image input = makeInput(static_cast<int>(state.range(0)), 1);
+    FilterPipeline pipeline;
+    addChain(pipeline, static_cast<int>(state.range(1)));
+    FrameStream stream(pipeline, input.getWidth(), input.getHeight(), 1);
+    Image output(input.getWidth(), input.getHeight(), 1);
+    for (size_t i = 0; i <= stream.getStageCount(); ++i) {
+        stream.push(input);
+    }
+    for (auto _ : state) {
+        stream.pop(output);
+        stream.push(input);
+        benchmark::DoNotOptimize(output.getData().data());
+    }
+    stream.close();
+    while (stream.pop(output)) {
+    }
+    setPixelCounter(state, input);
+}
+
+// Argumanlar: boyut, kanal. Goruntuleyicinin doku yuklemesi oncesi RGBA'ya genisletme
+void BM_ConvertToRgba(benchmark::State& state) {
+    const Image input = makeInput(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+    std::vector<uint8_t> output(static_cast<size_t>(input.getWidth()) * input.getHeight() * 4);
+    for (auto _ : state) {
+        convertToRgba(input.view(), output.data(), static_cast<std::ptrdiff_t>(input.getWidth()) * 4);
+        benchmark::DoNotOptimize(output.data());
+        benchmark::ClobberMemory();
+    }
+    setPixelCounter(state, input);
+}
+
+// Argumanlar: thread sayisi. 2048x2048 gri goruntude blur+parlaklik+kenar zinciri
+void BM_ThreadScaling(benchmark::State& state) {
+    const size_t saved_thread_count = ThreadPool::global().getThreadCount();
+    ThreadPool::setGlobalThreadCount(static_cast<size_t>(state.range(0)));
+    const Image input = makeInput(2048, 1);
+    FilterPipeline pipeline;
+    addChain(pipeline, 1);
+    Image output(input.getWidth(), input.getHeight(), input.getChannels());
+    for (auto _ : state) {
+        pipeline.apply(input, output);
+        benchmark::DoNotOptimize(output.getData().data());
+    }
+    setPixelCounter(state, input);
+    ThreadPool::setGlobalThreadCount(saved_thread_count);
+}
+
+// Sabit liste: olcum adlari makineden bagimsiz olur, temel ile her calisma
+// ayni girdileri icerir. Cekirdekten fazla thread asiri abonelik maliyetini olcer.
+void threadCounts(benchmark::internal::Benchmark* benchmark) {
+    for (int threads : {1, 2, 4, 8}) {
+        benchmark->Arg(threads);
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_GaussianBlur)
+    ->ArgNames({"size", "channels", "sigma10", "kernel"})
+    ->ArgsProduct({{512, 2048}, {1, 3}, {10}, {5}})
+    ->ArgsProduct({{512, 2048}, {1, 3}, {20}, {13}})
+    ->ArgsProduct({{512, 2048}, {1, 3}, {60}, {37}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK(BM_EdgeDetection)
+    ->ArgNames({"size", "channels", "direction"})
+    ->ArgsProduct({{512, 2048}, {1, 3}, {0, 1, 2}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK(BM_BrightnessAdjust)
+    ->ArgNames({"size", "channels"})
+    ->ArgsProduct({{512, 2048}, {1, 3}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK(BM_Convolution)
+    ->ArgNames({"size", "channels", "kernel", "strategy"})
+    ->ArgsProduct({{512}, {1, 3}, {5, 31}, {0, 1, 3}})
+    ->ArgsProduct({{2048}, {3}, {63}, {0}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK(BM_Save)
+    ->ArgNames({"size", "channels"})
+    ->ArgsProduct({{512, 2048}, {1, 3}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK(BM_Load)
+    ->ArgNames({"size", "channels"})
+    ->ArgsProduct({{512, 2048}, {1, 3}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK(BM_Pipeline)
+    ->ArgNames({"size", "channels", "chain", "tiled"})
+    ->ArgsProduct({{512, 2048}, {1, 3}, {0, 1, 2}, {0, 1}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK(BM_FrameStream)
+    ->ArgNames({"size", "chain"})
+    ->ArgsProduct({{512, 2048}, {1, 2}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK(BM_ConvertToRgba)
+    ->ArgNames({"size", "channels"})
+    ->ArgsProduct({{512, 2048}, {1, 3, 4}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK(BM_ThreadScaling)
+    ->ArgName("threads")
+    ->Apply(threadCounts)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+"""gorselisleme_bench JSON ciktisini temel (baseline) sonuclarla karsilastirir.
+
+Kullanim:
+    compare_benchmarks.py bench/baseline.json sonuc.json [--threshold 0.10]
+
+Her olcum adina gore eslenir ve gercek sureler karsilastirilir. Tekrarli
+calistirmalarda (--benchmark_repetitions) medyan kullanilir. Esigi asan
+yavaslama varsa cikis kodu 1'dir. Temelde karsiligi olmayan olcum (yeni
+eklenmis ama temel yenilenmemis) hicbir zaman yavaslama olarak
+isaretlenemeyeceginden cikis kodu 2'dir; --allow-missing bunu uyariya
+indirir. Temel ile simdiki calismanin CPU sayisi farkliysa (ornegin tek
+CPU'lu makinede kaydedilmis temel) thread olceklenme sonuclari
+karsilastirilamaz; bu durumda uyari basilir.
+"""
+
+import argparse
+import json
+import sys
+
+UNIT_SCALE = {"ns": 1e-9, "us": 1e-6, "ms": 1e-3, "s": 1.0}
+
+
+def load_results(path):
+    """(olcum adi -> saniye, context) dondurur."""
+    with open(path, encoding="utf-8") as handle:
+        data = json.load(handle)
+
+    times = {}
+    medians = {}
+    for entry in data.get("benchmarks", []):
+        if entry.get("error_occurred"):
+            continue
+        seconds = entry["real_time"] * UNIT_SCALE[entry.get("time_unit", "ns")]
+        name = entry.get("run_name", entry["name"])
+        if entry.get("run_type") == "aggregate":
+            if entry.get("aggregate_name") == "median":
+                medians[name] = seconds
+        else:
+            times.setdefault(name, []).append(seconds)
+
+    result = {name: min(values) for name, values in times.items()}
+    result.update(medians)
+    return result, data.get("context", {})
+
+
+def check_context(baseline_context, current_context):
+    """Karsilastirmayi anlamsizlastiran makine farklari icin uyari listesi."""
+    warnings = []
+    baseline_cpus = baseline_context.get("num_cpus")
+    current_cpus = current_context.get("num_cpus")
+    if baseline_cpus is not None and current_cpus is not None and baseline_cpus != current_cpus:
+        warnings.append("temel %d CPU'lu makinede, bu calisma %d CPU'lu makinede kaydedildi; "
+                        "thread olceklenme sonuclari karsilastirilamaz" % (baseline_cpus, current_cpus))
+    if baseline_cpus == 1:
+        warnings.append("temel tek CPU'lu makinede kaydedilmis; cok thread'li olcumler temsil edici "
+                        "degil, temel cok cekirdekli referans makinede yeniden uretilmeli")
+    return warnings
+
+
+def format_time(seconds):
+    if seconds >= 1.0:
+        return "%.3f s" % seconds
+    if seconds >= 1e-3:
+        return "%.3f ms" % (seconds * 1e3)
+    return "%.3f us" % (seconds * 1e6)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("baseline")
+    parser.add_argument("current")
+    parser.add_argument("--threshold", type=float, default=0.10,
+                        help="yavaslama esigi (0.10 = %%10)")
+    parser.add_argument("--allow-missing", action="store_true",
+                        help="temelde olmayan olcumlerde basarisiz olma, yalnizca uyar")
+    args = parser.parse_args()
+
+    baseline, baseline_context = load_results(args.baseline)
+    current, current_context = load_results(args.current)
+
+    regressions = []
+    unbaselined = []
+    width = max((len(name) for name in current), default=10)
+    print("%-*s %12s %12s %8s" % (width, "olcum", "temel", "simdi", "degisim"))
+    for name in sorted(current):
+        if name not in baseline:
+            print("%-*s %12s %12s %8s" % (width, name, "-", format_time(current[name]), "TEMEL YOK"))
+            unbaselined.append(name)
+            continue
+        change = current[name] / baseline[name] - 1.0
+        flag = ""
+        if change > args.threshold:
+            flag = "  YAVASLAMA"
+            regressions.append(name)
+        print("%-*s %12s %12s %+7.1f%%%s" % (width, name, format_time(baseline[name]),
+                                             format_time(current[name]), change * 100.0, flag))
+
+    missing = sorted(set(baseline) - set(current))
+    for name in missing:
+        print("%-*s %12s %12s %8s" % (width, name, format_time(baseline[name]), "-", "eksik"))
+
+    for warning in check_context(baseline_context, current_context):
+        print("\nUYARI: " + warning)
+
+    if unbaselined:
+        print("\n%s: %d olcumun temelde karsiligi yok, yavaslama denetlenemedi. "
+              "bench/baseline.json referans makinede yeniden uretilmeli:"
+              % ("UYARI" if args.allow_missing else "HATA", len(unbaselined)))
+        for name in unbaselined:
+            print("  " + name)
+    if regressions:
+        print("\n%d olcum esigi (%%%.0f) asti:" % (len(regressions), args.threshold * 100.0))
+        for name in regressions:
+            print("  " + name)
+        return 1
+    if unbaselined and not args.allow_missing:
+        return 2
+    print("\nYavaslama yok (esik %%%.0f)." % (args.threshold * 100.0))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
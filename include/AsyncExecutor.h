@@ -0,0 +1,158 @@
+#pragma once
+#include "Cancellation.h"
+#include "FilterPipeline.h"
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace GorselIsleme {
+
+class AsyncExecutor;
+
+struct JobResult {
+    enum Status { Completed, Failed, Cancelled, DeadlineExceeded };
+
+    Status status = Failed;
+    std::unique_ptr<Image> output; // yalnizca Completed
+    std::string error;
+};
+
+struct JobOptions {
+    enum Priority { Low, Normal, High };
+
+    Priority priority = Normal;
+    // Bu zamana kadar bitmeyen is DeadlineExceeded ile sonlanir. Kuyrukta
+    // beklerken gecerse is hic baslatilmaz.
+    CancellationToken::Clock::time_point deadline = CancellationToken::Clock::time_point::max();
+
+    // now + timeout
+    static JobOptions withTimeout(std::chrono::milliseconds timeout, Priority priority = Normal);
+};
+
+// Gonderilen isin tutamaci. Kopyalanabilir; is executor'dan uzun yasayabilir.
+class JobHandle {
+public:
+    enum State { Queued, Running, Completed, Failed, Cancelled, DeadlineExceeded };
+
+    JobHandle() = default;
+
+    bool valid() const { return job_ != nullptr; }
+    State getState() const;
+    bool isDone() const;
+
+    // Isbirlikci iptal: kuyruktaki is hemen Cancelled olur (geri cagirma
+    // varsa cancel() cagiran thread'de calisir); calisan is bir sonraki
+    // asama veya karo sinirinda durur. Bitmis iste etkisizdir.
+    void cancel();
+
+    void wait() const;
+    bool waitFor(std::chrono::milliseconds timeout) const;
+
+    // Future ile gonderilen isin sonucu: cikti goruntusu veya istisna (iptal
+    // ve son tarihte OperationCancelled). Tek sefer alinabilir; geri
+    // cagirmali gonderimde std::runtime_error atar.
+    std::future<std::unique_ptr<Image>>& getFuture();
+
+private:
+    friend class AsyncExecutor;
+    struct Job;
+
+    explicit JobHandle(std::shared_ptr<Job> job) : job_(std::move(job)) {}
+
+    std::shared_ptr<Job> job_;
+    std::shared_ptr<std::future<std::unique_ptr<Image>>> future_;
+};
+
+struct ExecutorOptions {
+    // Ayni anda calisan is sayisi (dagitici thread'ler); 0: 2. Piksel isi
+    // her durumda global ThreadPool uzerinden paralellesir.
+    size_t workers = 0;
+    // Kuyrukta bekleyebilecek en fazla is; dolunca submit bekler, trySubmit reddeder
+    size_t queue_capacity = 64;
+    // En az iki dagitici varsa biri yalnizca bu kadar veya daha az pikselli
+    // isleri alir; kucuk isler buyuklerin arkasinda kalmaz. 0: kapali.
+    size_t small_job_pixels = 512 * 512;
+};
+
+struct ExecutorStats {
+    uint64_t submitted = 0;
+    uint64_t rejected = 0;   // trySubmit kuyruk doluyken
+    uint64_t completed = 0;
+    uint64_t failed = 0;
+    uint64_t cancelled = 0;
+    uint64_t expired = 0;    // son tarihi gecen
+    size_t queued = 0;
+    size_t running = 0;
+};
+
+// Goruntu islerini arka planda calistirir. Isler oncelik, sonra son tarih,
+// sonra gelis sirasina gore secilir. Pipeline paylasilabilir: isler
+// const apply() kullanir, ayni pipeline birden fazla iste ayni anda calisabilir.
+// Iptal ve son tarih asamalar (Tiled modda karolar) arasinda kontrol edilir.
+class AsyncExecutor {
+public:
+    using Callback = std::function<void(JobResult&)>;
+
+    explicit AsyncExecutor(const ExecutorOptions& options = ExecutorOptions());
+    // Kuyruktaki ve calisan isleri iptal eder, calisanlarin durmasini bekler
+    ~AsyncExecutor();
+
+    AsyncExecutor(const AsyncExecutor&) = delete;
+    AsyncExecutor& operator=(const AsyncExecutor&) = delete;
+
+    // Girdi kopyalanir. Kuyruk doluysa yer acilana kadar bekler (geri basinc).
+    // Kapatilmis executor'da std::runtime_error atar.
+    JobHandle submit(const Image& input, std::shared_ptr<const FilterPipeline> pipeline,
+                     const JobOptions& options = JobOptions());
+    // Sonuc future yerine dagitici thread'de callback'e verilir.
+    // callback'ten atilan istisnalar yutulur.
+    JobHandle submit(const Image& input, std::shared_ptr<const FilterPipeline> pipeline, Callback callback,
+                     const JobOptions& options = JobOptions());
+
+    // Beklemez: kuyruk doluysa gecersiz tutamac doner
+    JobHandle trySubmit(const Image& input, std::shared_ptr<const FilterPipeline> pipeline,
+                        const JobOptions& options = JobOptions());
+    JobHandle trySubmit(const Image& input, std::shared_ptr<const FilterPipeline> pipeline, Callback callback,
+                        const JobOptions& options = JobOptions());
+
+    // Yeni isleri reddeder, kuyruktakiler dahil tum isler bitene kadar bekler
+    void shutdown();
+    // Kuyruktaki ve calisan tum isleri iptal eder
+    void cancelAll();
+
+    ExecutorStats getStats() const;
+    size_t getWorkerCount() const { return workers_.size(); }
+    size_t getQueueCapacity() const { return capacity_; }
+
+private:
+    using Job = JobHandle::Job;
+
+    mutable std::mutex mutex_;
+    std::condition_variable work_available_;
+    std::condition_variable space_available_;
+    // Kuyruk sinirli oldugundan secim dogrusal taramadir
+    std::vector<std::shared_ptr<Job>> queue_;
+    std::vector<std::shared_ptr<Job>> running_;
+    std::vector<std::thread> workers_;
+    size_t capacity_;
+    size_t small_job_pixels_;
+    uint64_t next_sequence_ = 0;
+    bool stopping_ = false;
+    ExecutorStats stats_;
+
+    JobHandle enqueue(const Image& input, std::shared_ptr<const FilterPipeline>&& pipeline, Callback&& callback,
+                      const JobOptions& options, bool wait_for_space);
+    void purgeFinished(std::vector<std::shared_ptr<Job>>& expired);
+    std::shared_ptr<Job> takeJob(bool small_only, std::vector<std::shared_ptr<Job>>& expired);
+    void workerLoop(bool small_only);
+    JobResult::Status run(Job& job);
+};
+
+} // namespace GorselIsleme
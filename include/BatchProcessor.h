@@ -0,0 +1,59 @@
+#pragma once
+#include "FilterPipeline.h"
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace GorselIsleme {
+
+struct BatchItemResult {
+    size_t index = 0;
+    std::string name;        // dosya yolu veya "#<indeks>"
+    bool success = false;
+    std::string error;
+    double latency_ms = 0.0; // okuma + isleme + yazma
+    int width = 0;
+    int height = 0;
+    std::string output_path;
+    std::unique_ptr<Image> output; // yalnizca goruntu girdisinde
+};
+
+struct BatchOptions {
+    // Ayni anda islenen goruntu sayisi; 0: global havuzun thread sayisi.
+    // Global havuzun thread sayisini asamaz.
+    size_t concurrency = 0;
+    // Dosya girdisinde sonuclarin yazilacagi dizin; bossa sonuc yazilmaz
+    std::string output_directory;
+    // Cikti dosya adi: <girdi adi><output_suffix>.pgm (3 kanalli ciktida .ppm).
+    // Ayni cikti adina dusen (a.jpg ve a.pgm) veya bir girdinin uzerine
+    // yazacak ogeler islenmeden basarisiz sayilir.
+    std::string output_suffix;
+    // Her oge bittiginde (isci thread'inden) cagrilir
+    std::function<void(const BatchItemResult&)> on_item;
+};
+
+struct BatchReport {
+    std::vector<BatchItemResult> items; // girdi sirasinda
+    size_t succeeded = 0;
+    size_t failed = 0;
+    double wall_ms = 0.0;
+
+    double imagesPerSecond() const;
+    double megapixelsPerSecond() const;
+    // Basarili ogelerin gecikme yuzdeligi (0-100)
+    double latencyPercentile(double percentile) const;
+};
+
+// Goruntuleri paralel isler. Her isci pipeline'in kendi kopyasini kullanir;
+// isler iscilere bloklar halinde dagitilir, kuyrugu bosalan isci digerlerinden
+// calar. Bir ogedeki hata yalnizca o ogeyi basarisiz yapar.
+BatchReport processBatch(const std::vector<std::string>& files, const FilterPipeline& pipeline,
+                         const BatchOptions& options = BatchOptions());
+BatchReport processBatch(const std::vector<const Image*>& images, const FilterPipeline& pipeline,
+                         const BatchOptions& options = BatchOptions());
+
+// Dizindeki .pgm, .ppm, .jpg ve .jpeg dosyalari (alt dizinler haric), ada gore sirali
+std::vector<std::string> listImageFiles(const std::string& directory);
+
+} // namespace GorselIsleme
@@ -1,13 +1,12 @@
 #pragma once
-#include "Filter.h"
+#include "PointOp.h"
 
 namespace GorselIsleme {
 
-class BrightnessAdjust : public Filter {
+class BrightnessAdjust : public PointOp {
 public:
     BrightnessAdjust(double brightness_factor = 1.0);
     
-    std::unique_ptr<Image> apply(const Image& input) const override;
     std::string getName() const override { return "BrightnessAdjust"; }
     std::unique_ptr<Filter> clone() const override;
     
@@ -15,6 +14,8 @@ public:
     
 private:
     double brightness_factor_;
+    
+    void updateLut();
 };
 
-} // namespace GorselIsleme
\ No newline at end of file
+} // namespace GorselIsleme
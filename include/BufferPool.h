@@ -0,0 +1,104 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace GorselIsleme {
+
+// Piksel tamponlari icin boyut kovali geri donusum havuzu. Varsayilan olarak
+// kapalidir; acikken serbest birakilan tamponlar kapasite dolana kadar
+// saklanir ve ayni kovadan istenen bir sonraki ayirmada dogrudan verilir
+// (malloc ve ilk dokunustaki sayfa hatalari olmadan).
+class BufferPool {
+public:
+    static constexpr size_t kAlignment = 64;
+    static constexpr size_t kDefaultCapacity = size_t(256) << 20;
+
+    struct Stats {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t retained_bytes = 0;
+        size_t retained_buffers = 0;
+        // Havuz acik olsun olmasin, allocate ile istenen toplam bayt
+        uint64_t allocated_bytes = 0;
+    };
+
+    explicit BufferPool(size_t capacity = kDefaultCapacity) : capacity_(capacity) {}
+    ~BufferPool();
+
+    BufferPool(const BufferPool&) = delete;
+    BufferPool& operator=(const BufferPool&) = delete;
+
+    // Kapatmak saklanan tamponlari serbest birakir
+    void setEnabled(bool enabled);
+    bool isEnabled() const;
+    // Saklanan toplam bayt siniri; asan tamponlar dogrudan serbest birakilir
+    void setCapacity(size_t bytes);
+    size_t getCapacity() const;
+    void trim();
+    Stats getStats() const;
+
+    // bytes, bucketSize'a yuvarlanir; donen bellek kAlignment hizalidir
+    void* allocate(size_t bytes);
+    void deallocate(void* pointer, size_t bytes) noexcept;
+
+    // Kova boyutu: 64 baytin kati, oktav basina 8 kova (israf <= %12.5).
+    // Yuvarlama ayni zamanda son satirdan tasan vektor okumalarina pay birakir.
+    static size_t bucketSize(size_t bytes);
+
+    // Program sonuna kadar yasar; statik Image nesneleri de guvenle birakilir
+    static BufferPool& global();
+
+private:
+    mutable std::mutex mutex_;
+    std::map<size_t, std::vector<void*>> free_lists_;
+    size_t capacity_;
+    bool enabled_ = false;
+    Stats stats_;
+    std::atomic<uint64_t> allocated_bytes_{0};
+
+    void releaseAll();
+};
+
+// Image piksel vektoru icin ayirici: 64 bayt hizali, global havuzdan beslenir.
+// Eleman olusturma varsayilan ilklendirmedir; resize(n) bellegi yazmaz,
+// resize(n, 0) sifirlar.
+template <typename T>
+class PixelAllocator {
+public:
+    using value_type = T;
+
+    PixelAllocator() = default;
+    template <typename U>
+    PixelAllocator(const PixelAllocator<U>&) noexcept {}
+
+    T* allocate(size_t count) {
+        return static_cast<T*>(BufferPool::global().allocate(count * sizeof(T)));
+    }
+
+    void deallocate(T* pointer, size_t count) noexcept {
+        BufferPool::global().deallocate(pointer, count * sizeof(T));
+    }
+
+    template <typename U>
+    void construct(U* pointer) noexcept {
+        ::new (static_cast<void*>(pointer)) U;
+    }
+
+    template <typename U, typename... Args>
+    void construct(U* pointer, Args&&... args) {
+        ::new (static_cast<void*>(pointer)) U(std::forward<Args>(args)...);
+    }
+
+    template <typename U>
+    bool operator==(const PixelAllocator<U>&) const noexcept { return true; }
+    template <typename U>
+    bool operator!=(const PixelAllocator<U>&) const noexcept { return false; }
+};
+
+} // namespace GorselIsleme
@@ -0,0 +1,57 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+
+namespace GorselIsleme {
+
+// Iptal veya son tarih asimi nedeniyle yarida kesilen islem
+class OperationCancelled : public std::runtime_error {
+public:
+    enum Reason { Cancelled, DeadlineExceeded };
+
+    explicit OperationCancelled(Reason reason)
+        : std::runtime_error(reason == Cancelled ? "Islem iptal edildi" : "Islemin son tarihi gecti"),
+          reason_(reason) {
+    }
+
+    Reason getReason() const { return reason_; }
+
+private:
+    Reason reason_;
+};
+
+// Isbirlikci iptal: cancel() herhangi bir thread'den cagrilabilir, isi yapan
+// taraf uygun noktalarda throwIfCancelled() ile kontrol eder. Son tarih
+// yoksa kontrol tek bir atomik okumadir.
+class CancellationToken {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    CancellationToken() = default;
+    explicit CancellationToken(Clock::time_point deadline) : deadline_(deadline) {}
+
+    CancellationToken(const CancellationToken&) = delete;
+    CancellationToken& operator=(const CancellationToken&) = delete;
+
+    void cancel() { cancelled_.store(true, std::memory_order_relaxed); }
+    bool isCancelRequested() const { return cancelled_.load(std::memory_order_relaxed); }
+    bool hasDeadline() const { return deadline_ != Clock::time_point::max(); }
+    Clock::time_point getDeadline() const { return deadline_; }
+    bool isExpired() const { return hasDeadline() && Clock::now() >= deadline_; }
+
+    void throwIfCancelled() const {
+        if (isCancelRequested()) {
+            throw OperationCancelled(OperationCancelled::Cancelled);
+        }
+        if (isExpired()) {
+            throw OperationCancelled(OperationCancelled::DeadlineExceeded);
+        }
+    }
+
+private:
+    std::atomic<bool> cancelled_{false};
+    Clock::time_point deadline_ = Clock::time_point::max();
+};
+
+} // namespace GorselIsleme
@@ -0,0 +1,81 @@
+#pragma once
+#include "Filter.h"
+#include <vector>
+
+namespace GorselIsleme {
+
+// Kullanici tanimli kernel ile genel konvolusyon. Kernel satir oncelikli
+// width x height (tek boyutlar) olarak verilir ve cevrilmeden uygulanir
+// (korelasyon): cikti(x, y) = sum k[j][i] * girdi(x + i - rx, y + j - ry).
+// Simetrik PSF'lerde konvolusyonla aynidir. Varsayilan kenar modu Clamp
+// (en yakin piksel tekrarlanir); sonuc yuvarlanip [0, 255]'e kirpilir.
+class Convolution : public Filter {
+public:
+    // Direct: her tap dogrudan (kucuk kernellerde en hizlisi)
+    // Separable: kernelin tekil deger ayrisimindan elde edilen r adet
+    //   satir x sutun cifti; r (w + h) tap. Atilan tekil degerlerin toplami
+    //   1/4 LSB'yi asmaz; float toplama sirasi da farkli oldugundan cikti
+    //   direct'ten piksel basina en fazla 1 LSB sapabilir (byte-ayni degildir).
+    // Fft: overlap-save blok FFT; piksel basina maliyet kernel boyutundan
+    //   neredeyse bagimsizdir (31x31 ve uzeri PSF'ler).
+    // Auto: goruntu ve kernel boyutuna gore tahmini en ucuz yol. Karo,
+    //   serit ve artimli calismada secim gorunume gore degisebileceginden
+    //   Fft gibi bu modlari tum goruntu hesabina dusurur (isViewInvariant).
+    enum Strategy { Auto, Direct, Separable, Fft };
+
+    Convolution(std::vector<float> kernel, int width, int height, Strategy strategy = Auto);
+
+    using Filter::apply;
+    void apply(const ConstImageView& input, const ImageView& output) const override;
+    std::string getName() const override { return "Convolution"; }
+    std::unique_ptr<Filter> clone() const override;
+    std::string getFingerprint() const override;
+    int getRadius() const override;
+
+    int getKernelWidth() const { return width_; }
+    int getKernelHeight() const { return height_; }
+    const std::vector<float>& getKernel() const { return kernel_; }
+
+    void setStrategy(Strategy strategy) { strategy_ = strategy; }
+    Strategy getStrategy() const { return strategy_; }
+    // Verilen goruntu boyutunda calisacak somut yol (Auto cozulmus)
+    Strategy selectStrategy(int image_width, int image_height, int channels) const;
+    // Ayrilabilir gosterimin terim sayisi (rank 1 kernelde 1)
+    int getSeparableRank() const { return static_cast<int>(rows_.size()); }
+
+    // Renormalize'da disaridaki tap'ler atilir ve sonuc kernel toplamina
+    // olceklenir; sifir toplamli kernellerde sifir dolguya esdegerdir.
+    void setBorderMode(BorderMode mode, Image::Pixel value = 0);
+    BorderMode getBorderMode() const { return border_mode_; }
+    Image::Pixel getBorderValue() const { return border_value_; }
+    bool isLocal() const override { return border_mode_ != Wrap; }
+    // Fft'nin yuvarlama hatasi blok yerlesimine, Auto'nun secimi gorunum
+    // boyutuna baglidir; ikisi de tum goruntu uzerinde bir kez cozulur
+    bool isViewInvariant() const override { return strategy_ == Direct || strategy_ == Separable; }
+
+private:
+    std::vector<float> kernel_;
+    int width_;
+    int height_;
+    Strategy strategy_;
+    BorderMode border_mode_ = Clamp;
+    Image::Pixel border_value_ = 0;
+    size_t nonzero_taps_;
+    double kernel_sum_;
+    double kernel_abs_sum_;
+    // (height + 1) x (width + 1) iki boyutlu onek toplami (Renormalize)
+    std::vector<double> kernel_prefix_;
+    // Separable terimler: kernel ~= sum columns_[t] (yukseklik) x rows_[t] (genislik)
+    std::vector<std::vector<float>> rows_;
+    std::vector<std::vector<float>> columns_;
+
+    void decompose();
+    int selectFftSize(int image_width, int image_height, int channels, double* cost) const;
+
+    void applyDirect(const ConstImageView& input, const ImageView& output) const;
+    void applySeparable(const ConstImageView& input, const ImageView& output) const;
+    void applyFft(const ConstImageView& input, const ImageView& output, int fft_size) const;
+    void renormalizeRow(float* values, int image_width, int image_height, int y, int x_begin, int count) const;
+};
+
+} // namespace GorselIsleme
@@ -7,23 +7,39 @@ namespace GorselIsleme {
 class EdgeDetection : public Filter {
 public:
     enum Direction { Horizontal, Vertical, Both };
-    
-    EdgeDetection(Direction direction = Both);
-    
-    std::unique_ptr<Image> apply(const Image& input) const override;
+    // L2: sqrt(gx^2 + gy^2); L1: |gx| + |gy|; Max: max(|gx|, |gy|)
+    enum Magnitude { L2, L1, Max };
+    // Sobel ve Scharr yone ve buyukluge gore gx/gy birlestirir. Laplacian
+    // yonsuzdur: cikti |L| olur, yon ve buyukluk kullanilmaz.
+    enum Operator { Sobel, Scharr, Laplacian };
+
+    EdgeDetection(Direction direction = Both, Magnitude magnitude = L2, Operator op = Sobel);
+
+    using Filter::apply;
+    void apply(const ConstImageView& input, const ImageView& output) const override;
     std::string getName() const override { return "EdgeDetection"; }
     std::unique_ptr<Filter> clone() const override;
-    
+    std::string getFingerprint() const override;
+    int getRadius() const override { return 1; }
+
     void setDirection(Direction direction);
-    
+    void setMagnitude(Magnitude magnitude);
+    void setOperator(Operator op);
+    Operator getOperator() const { return operator_; }
+
+    // Varsayilan Renormalize: 1 piksellik cerceve hesaplanmaz, sifir kalir.
+    // Diger modlarda cerceve de eslenmis komsulukla hesaplanir.
+    void setBorderMode(BorderMode mode, Image::Pixel value = 0);
+    BorderMode getBorderMode() const { return border_mode_; }
+    Image::Pixel getBorderValue() const { return border_value_; }
+    bool isLocal() const override { return border_mode_ != Wrap; }
+
 private:
     Direction direction_;
-    std::vector<std::vector<int>> sobel_x_;
-    std::vector<std::vector<int>> sobel_y_;
-    
-    void initializeSobelKernels();
-    double applyConvolution(const Image& image, int x, int y, 
-                          const std::vector<std::vector<int>>& kernel) const;
+    Magnitude magnitude_;
+    Operator operator_;
+    BorderMode border_mode_ = Renormalize;
+    Image::Pixel border_value_ = 0;
 };
 
-} // namespace GorselIsleme
\ No newline at end of file
+} // namespace GorselIsleme
@@ -8,10 +8,60 @@ namespace GorselIsleme {
 
 class Filter {
 public:
+    // Komsuluk filtrelerinde goruntu disina tasan tap'lerin degeri
+    // (ornek satir: abcd, disarisi | ile ayrilmis):
+    // Renormalize: disaridaki tap'ler atilir, kalan agirliklar yeniden
+    //   normalize edilir (turev filtrelerinde 1 piksellik cerceve sifir kalir)
+    // Clamp: aa|abcd|dd   Reflect: cb|abcd|cb (kenar pikseli tekrarlanmaz)
+    // Wrap: cd|abcd|ab    Constant: kk|abcd|kk (k = sabit deger)
+    enum BorderMode { Renormalize, Clamp, Reflect, Wrap, Constant };
+
     virtual ~Filter() = default;
-    virtual std::unique_ptr<Image> apply(const Image& input) const = 0;
+
+    virtual std::unique_ptr<Image> apply(const Image& input) const {
+        auto output = std::make_unique<Image>(input.getWidth(), input.getHeight(), input.getChannels(),
+                                              Image::Uninitialized);
+        apply(input.view(), output->view());
+        return output;
+    }
+
+    // Gorunum uzerinde calisir; cikti girdiyle ayni boyutta olmalidir. ROI
+    // gorunumunde bolge kenari goruntu kenari gibi ele alinir.
+    virtual void apply(const ConstImageView& input, const ImageView& output) const = 0;
+
     virtual std::string getName() const = 0;
     virtual std::unique_ptr<Filter> clone() const = 0;
+
+    // Ciktiyi belirleyen tum parametrelerin kararli ozeti: ozetleri ayni
+    // iki filtre ayni girdiden ayni ciktiyi uretir. Bos ise sonuc
+    // onbelleklenemez (ResultCache bu filtreyi iceren onekleri saklamaz).
+    virtual std::string getFingerprint() const { return std::string(); }
+
+    // Komsuluk yaricapi (halo): bir cikti pikseli girdide en fazla bu kadar
+    // uzaktaki piksellere bakar. Karo bazli calisma girdi karolarini bununla genisletir.
+    virtual int getRadius() const = 0;
+
+    // Girdi ve cikti ayni bellek olabilir mi (FilterPipeline tampon plani)
+    virtual bool supportsInPlace() const { return false; }
+
+    // Cikti yalnizca getRadius() icindeki girdiye mi bagli? Karo ve serit
+    // bazli calisma buna dayanir; Wrap kenar modu karsi kenari okudugu icin
+    // yerel degildir.
+    virtual bool isLocal() const { return true; }
+
+    // Bir cikti pikseli gorunumun konumundan ve boyutundan bagimsiz olarak
+    // bit bit ayni mi hesaplanir? Karo, serit ve artimli calisma apply() ile
+    // bayt bayt ayni sonuc icin buna dayanir; false donduren filtre varsa
+    // bu modlar tum goruntu hesabina duser.
+    virtual bool isViewInvariant() const { return true; }
+
+protected:
+    static void checkViews(const ConstImageView& input, const ImageView& output) {
+        if (input.empty() ||
+            !output.sameSize(input.getWidth(), input.getHeight(), input.getChannels())) {
+            throw std::invalid_argument("Girdi ve cikti boyutlari uyusmuyor");
+        }
+    }
 };
 
-} // namespace GorselIsleme
\ No newline at end of file
+} // namespace GorselIsleme
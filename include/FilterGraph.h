@@ -0,0 +1,58 @@
+#pragma once
+#include "Filter.h"
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace GorselIsleme {
+
+struct GraphStats {
+    size_t nodes = 0;           // ciktilara ulasan filtre dugumleri
+    size_t computed = 0;        // ortak alt ifadeler birlestikten sonra calisan
+    size_t shared = 0;          // baska bir dugumle ayni oldugu icin atlanan
+    size_t peak_bytes = 0;      // ayni anda yasayan ara sonuclarin en fazla boyutu
+};
+
+// Filtre grafi: dugumler filtreler, kenarlar goruntulerdir. Birden fazla
+// girdi ve cikti olabilir; her filtre dugumu tek kaynak dugumu okur.
+// run() sirasinda ayni kaynaga uygulanan ayni parmak izli filtreler
+// (Filter::getFingerprint) bir kez hesaplanir; ayni goruntuye bagli girdiler
+// de tek girdi sayilir. Bagimsiz dallar havuz thread'lerinde eszamanli
+// calisir, ara sonuc son tuketicisi bitince serbest birakilir.
+class FilterGraph {
+public:
+    using NodeId = size_t;
+
+    FilterGraph() = default;
+    FilterGraph(const FilterGraph&) = delete;
+    FilterGraph& operator=(const FilterGraph&) = delete;
+
+    // Girdiler run()'a eklenme sirasiyla verilir
+    NodeId addInput();
+    NodeId addNode(std::unique_ptr<Filter> filter, NodeId source);
+    // Donus degeri run() sonucundaki indekstir
+    size_t addOutput(NodeId node);
+
+    size_t getNodeCount() const { return nodes_.size(); }
+    size_t getInputCount() const { return input_count_; }
+    size_t getOutputCount() const { return outputs_.size(); }
+
+    // Ciktilar addOutput sirasiyla doner. Filtre hatasi diger dallar
+    // durduktan sonra yeniden atilir. Graf degismedikce ayni anda birden
+    // fazla thread'den cagrilabilir.
+    std::vector<std::unique_ptr<Image>> run(const std::vector<const Image*>& inputs,
+                                            GraphStats* stats = nullptr) const;
+
+private:
+    struct Node {
+        std::unique_ptr<Filter> filter; // girdi dugumunde bos
+        NodeId source = 0;
+        size_t input_index = 0;
+    };
+
+    std::vector<Node> nodes_;
+    std::vector<NodeId> outputs_;
+    size_t input_count_ = 0;
+};
+
+} // namespace GorselIsleme
@@ -1,29 +1,174 @@
 #pragma once
+#include "Cancellation.h"
 #include "Filter.h"
+#include "PipelineTrace.h"
+#include "PointOp.h"
+#include "ResultCache.h"
+#include "RowStream.h"
 #include <vector>
 #include <memory>
 #include <string>
 
 namespace GorselIsleme {
 
+class ScratchArena;
+
 class FilterPipeline {
 public:
-    FilterPipeline() = default;
+    // Sequential: her filtre tum goruntu uzerinde sirayla calisir.
+    // Tiled: cikti karolara bolunur; her karo tum asamalardan onbellekte
+    //   gecer. Girdi karosu asamalarin yaricaplari toplami kadar genisletilir,
+    //   sonuc Sequential ile bayt bayt aynidir. Yerel olmayan (Wrap kenar
+    //   modu) veya gorunume bagli (Filter::isViewInvariant) bir filtre varsa
+    //   Sequential calisir.
+    enum ExecutionMode { Sequential, Tiled };
+    
+    // Goruntu icinde dikdortgen bolge
+    struct Rect {
+        int x = 0;
+        int y = 0;
+        int width = 0;
+        int height = 0;
+    };
+
+    FilterPipeline();
+    ~FilterPipeline();
     
     void addFilter(std::unique_ptr<Filter> filter);
     void removeFilter(size_t index);
     void clear();
     
     std::unique_ptr<Image> apply(const Image& input) const;
+    // Iptal edilebilir apply: token asamalar arasinda (Tiled'da karolar
+    // arasinda) kontrol edilir, iptal veya son tarih asiminda
+    // OperationCancelled atar.
+    std::unique_ptr<Image> apply(const Image& input, const CancellationToken& token) const;
+    
+    // Ayni boyutlu kareler icin calisma plani ve ara tampon bir kez hazirlanir.
+    // Ara sonuclar output ile tek ara tampon arasinda gidip gelir, nokta
+    // islemleri yerinde calisir; output boyutu uyuyorsa tekrar kullanilir.
+    // Filtrelerin gecici tamponlari (buyuk kareler dahil) hatta ait bir
+    // bellek alaninda tutulur; alan ilk cagrilarda dolar, boyut degisince
+    // bosaltilir. Kararli durumda yigin ayirmasi yapmaz. Nesne ayni anda tek
+    // thread'den kullanilmalidir (thread basina clone()).
+    void prepare(int width, int height, int channels);
+    void apply(const Image& input, Image& output);
+    bool isPreparedFor(int width, int height, int channels) const;
     
+    // Goruntuyu strip_rows yukseklikli seritler halinde kaynaktan okuyup
+    // hedefe yazar; her asama yalnizca kendi yaricapi kadar ortusen satirlari
+    // tutar. Bellek goruntu yuksekliginden bagimsizdir:
+    // ~(strip_rows + 2 * getRadius()) * genislik * (asama sayisi + 1).
+    // Sonuc apply() ile bayt bayt aynidir. Yerel olmayan filtrede
+    // std::invalid_argument atar; gorunume bagli filtrede goruntu tek serit
+    // olarak okunup tum goruntu uzerinde islenir (bellek siniri gecmez).
+    StreamStats applyStreaming(RowSource& source, RowSink& sink, int strip_rows = 256) const;
+    // PGM/PPM dosyadan dosyaya
+    StreamStats applyStreaming(const std::string& input_path, const std::string& output_path,
+                               int strip_rows = 256) const;
+    
+    // Artimli calisma (etkilesimli duzenleme): ilk cagrida, boyut veya filtre
+    // listesi degisince ya da resetIncremental() sonrasi tum goruntu islenir
+    // ve asama ara sonuclari saklanir. Sonraki cagrilarda input'un onceki
+    // cagriya gore yalnizca dirty icinde degistigi, output'un onceki sonucu
+    // tuttugu kabul edilir: bolge her asamada o asamanin yaricapi kadar
+    // buyutulerek yalnizca etkilenen kisim yeniden hesaplanir; ara sonuclar
+    // ve output o bolgede yamanir. Maliyet duzenlenen alanla orantilidir,
+    // sonuc apply() ile bayt bayt aynidir. Donus degeri output'ta degismis
+    // olabilecek bolgedir. Yerel olmayan veya gorunume bagli filtrede her
+    // cagri tum goruntuyu isler. Izlenmez; nesne ayni anda tek thread'den kullanilmalidir.
+    Rect applyIncremental(const Image& input, Image& output, const Rect& dirty);
+    void resetIncremental();
+    
+    const Filter& getFilter(size_t index) const;
     std::string getFilterName(size_t index) const;
     std::vector<std::string> getAllFilterNames() const;
     size_t getFilterCount() const { return filters_.size(); }
     
+    void setExecutionMode(ExecutionMode mode) { execution_mode_ = mode; }
+    ExecutionMode getExecutionMode() const { return execution_mode_; }
+    void setTileSize(int width, int height);
+    int getTileWidth() const { return tile_width_; }
+    int getTileHeight() const { return tile_height_; }
+    // Tum asamalarin toplam halo yaricapi
+    int getRadius() const;
+    // Tum filtreler yerel mi (Filter::isLocal)
+    bool isLocal() const;
+    // Tum filtreler gorunumden bagimsiz mi (Filter::isViewInvariant)
+    bool isViewInvariant() const;
+    
+    // Izleme: gozlemci ayarliyken her apply icin asama ve cagri olaylari
+    // (sure, piksel, ayrilan bayt, thread kullanimi) uretilir. Ayarli degilken
+    // maliyet apply basina tek bir isaretci kontroludur. clone() gozlemciyi
+    // paylasir. applyStreaming izlenmez.
+    void setObserver(std::shared_ptr<PipelineObserver> observer) { observer_ = std::move(observer); }
+    const std::shared_ptr<PipelineObserver>& getObserver() const { return observer_; }
+    
+    // Sonuc onbellegi: ayarliyken apply(const Image&) ve iptal edilebilir
+    // surumu girdinin ozetini alir, asama sinirlarindaki en uzun onbellekli
+    // oneki bulur ve yalnizca kalan asamalari calistirir. Sequential'da her
+    // asama sonucu, Tiled'da yalnizca tam sonuc saklanir. Parmak izi bos
+    // filtreyi iceren onekler saklanmaz. clone() onbellegi paylasir;
+    // hazirlanmis apply(input, output) ve applyStreaming kullanmaz.
+    void setCache(std::shared_ptr<ResultCache> cache) { cache_ = std::move(cache); }
+    const std::shared_ptr<ResultCache>& getCache() const { return cache_; }
+    
     std::unique_ptr<FilterPipeline> clone() const;
     
 private:
+    // Ardisik nokta islemleri tek LUT asamasina birlestirilmis calisma plani
+    struct Stage {
+        const Filter* filter = nullptr;
+        PointOp::Lut lut;
+        size_t first_filter = 0;   // asamayi olusturan filtreler (izleme adlari icin)
+        size_t filter_count = 1;
+        int radius = 0;
+        int halo = 0;              // bu ve sonraki asamalarin yaricap toplami
+        bool in_place = false;     // girdiyi yerinde isleyebilir
+        bool to_scratch = false;   // Sequential planda ara tampona yazar
+        
+        void run(const ConstImageView& input, const ImageView& output) const;
+    };
+    
+    struct ApplyTrace;
+    
     std::vector<std::unique_ptr<Filter>> filters_;
+    std::shared_ptr<PipelineObserver> observer_;
+    std::shared_ptr<ResultCache> cache_;
+    ExecutionMode execution_mode_ = Sequential;
+    int tile_width_ = 256;
+    int tile_height_ = 256;
+    
+    // prepare() sonucu; filtre listesi degisince gecersizlesir
+    std::vector<Stage> plan_;
+    std::unique_ptr<Image> scratch_;
+    std::unique_ptr<ScratchArena> arena_;
+    bool prepared_ = false;
+    ExecutionMode prepared_mode_ = Sequential;
+    int prepared_width_ = 0;
+    int prepared_height_ = 0;
+    int prepared_channels_ = 0;
+    
+    // applyIncremental durumu: son asama disindaki asamalarin tam boyutlu
+    // sonuclari; filtre listesi degisince gecersizlesir
+    std::vector<Stage> incremental_plan_;
+    std::vector<std::unique_ptr<Image>> incremental_results_;
+    bool incremental_valid_ = false;
+    int incremental_width_ = 0;
+    int incremental_height_ = 0;
+    int incremental_channels_ = 0;
+    
+    std::vector<Stage> buildStages() const;
+    ExecutionMode effectiveMode() const;
+    static bool planBuffers(std::vector<Stage>& stages);
+    std::unique_ptr<Image> applyNew(const Image& input, const CancellationToken* token) const;
+    std::unique_ptr<Image> applyCached(const Image& input, const CancellationToken* token) const;
+    void applySequential(const Image& input, Image& output, Image* scratch, const std::vector<Stage>& stages,
+                         ApplyTrace* trace, const CancellationToken* token = nullptr) const;
+    void applyTiled(const Image& input, const ImageView& output, const std::vector<Stage>& stages,
+                    ApplyTrace* trace, const CancellationToken* token = nullptr) const;
+    Rect applyIncrementalFull(const Image& input, Image& output);
+    std::string stageName(const Stage& stage) const;
 };
 
-} // namespace GorselIsleme
\ No newline at end of file
+} // namespace GorselIsleme
@@ -0,0 +1,107 @@
+#pragma once
+#include "FilterPipeline.h"
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace GorselIsleme {
+
+struct FrameStreamOptions {
+    // Asamalar arasindaki her halkada onceden ayrilan kare sayisi
+    size_t ring_capacity = 4;
+    // Her grubun filtre sayisi (toplami pipeline'in filtre sayisi). Bossa
+    // her filtre ayri gruptur; ardisik nokta islemleri tek LUT gecisi
+    // olduklarindan ayni grupta kalir.
+    std::vector<size_t> stage_groups;
+};
+
+struct FrameStageStats {
+    std::string name;              // gruptaki filtre adlari, "+" ile
+    uint64_t frames = 0;
+    double busy_ms = 0.0;
+    double input_stall_ms = 0.0;   // girdi halkasi bos diye beklenen
+    double output_stall_ms = 0.0;  // cikti halkasi dolu diye beklenen
+    size_t input_depth = 0;        // girdi halkasindaki kare sayisi (anlik)
+    size_t max_input_depth = 0;
+};
+
+struct FrameStreamStats {
+    std::vector<FrameStageStats> stages;
+    uint64_t frames_in = 0;
+    uint64_t frames_out = 0;
+    double push_stall_ms = 0.0;    // push() halka dolu diye beklenen
+    double pop_stall_ms = 0.0;     // pop() sonuc yok diye beklenen
+    size_t output_depth = 0;       // pop() bekleyen kare sayisi (anlik)
+    size_t max_output_depth = 0;
+};
+
+// Ayni boyutlu kare akisini asama paralel isler: her filtre grubu kendi
+// thread'inde calisir, kareler gruplar arasinda onceden ayrilmis Image
+// yuvalarindan olusan sinirli, kilitsiz tek uretici/tek tuketici
+// halkalarla gecer. Her grup hazirlanmis bir FilterPipeline calistirir;
+// filtrelerin gecici tamponlari (buyuk kareler dahil) o hattin bellek
+// alaninda kaldigindan kararli durumda yigin ayirmasi yapmaz. Verim en yavas
+// grubun verimine yaklasir, gecikme gruplarin toplamidir.
+//
+// push() tek bir uretici thread'inden, pop() tek bir tuketici thread'inden
+// cagrilmalidir. Kare sirasi korunur.
+class FrameStream {
+public:
+    // Pipeline'in filtreleri kopyalanir; nesne sonradan degisebilir.
+    // Gecersiz boyut veya grup tanimi std::invalid_argument atar.
+    FrameStream(const FilterPipeline& pipeline, int width, int height, int channels,
+                const FrameStreamOptions& options = FrameStreamOptions());
+    // Bekleyen kareler atilir, thread'ler durdurulur
+    ~FrameStream();
+
+    FrameStream(const FrameStream&) = delete;
+    FrameStream& operator=(const FrameStream&) = delete;
+
+    // Kareyi ilk halkaya kopyalar; halka doluysa bekler. Boyut uymazsa
+    // std::invalid_argument, kapatilmis akista std::runtime_error atar.
+    // Bir asama hata vermisse o hatayi yeniden atar. tryPush beklemez,
+    // halka doluysa false doner.
+    void push(const Image& frame);
+    bool tryPush(const Image& frame);
+    // Kare gelmeyecegini bildirir; asamalar kalan kareleri bitirir
+    void close();
+
+    // Siradaki sonucu output'a kopyalar (boyut uymazsa output yeniden
+    // olusturulur). Akis kapanip bosaldiginda false doner; bir asama hata
+    // vermisse o hatayi yeniden atar.
+    bool pop(Image& output);
+    bool tryPop(Image& output);
+
+    size_t getStageCount() const { return stages_.size(); }
+    FrameStreamStats getStats() const;
+
+private:
+    class Ring;
+    struct Stage;
+
+    int width_;
+    int height_;
+    int channels_;
+    // rings_[i]: i. asamanin girdisi; son halka tuketicinin
+    std::vector<std::unique_ptr<Ring>> rings_;
+    std::vector<std::unique_ptr<Stage>> stages_;
+    std::atomic<uint64_t> push_stall_ns_{0};
+    std::atomic<uint64_t> pop_stall_ns_{0};
+
+    std::mutex error_mutex_;
+    std::exception_ptr error_;
+
+    void runStage(size_t index);
+    void fail(std::exception_ptr error);
+    void rethrowError();
+    void checkFrame(const Image& frame) const;
+    bool pushFrame(const Image& frame, bool wait);
+    bool popFrame(Image& output, bool wait);
+};
+
+} // namespace GorselIsleme
@@ -1,26 +1,73 @@
 #pragma once
 #include "Filter.h"
+#include <cstdint>
+#include <vector>
 
 namespace GorselIsleme {
 
 class GaussianBlur : public Filter {
 public:
-    GaussianBlur(double sigma = 1.0, int kernel_size = 3);
-    
-    std::unique_ptr<Image> apply(const Image& input) const override;
+    // Exact: sabit noktali ayrilabilir kernel, maliyet kernel boyutuyla artar.
+    // StackedBox: kernelin varyansina esit uc kayan toplamli kutu gecisi,
+    //   piksel basina maliyet sigmadan bagimsizdir. Kernel en az +-3 sigma
+    //   kapsadiginda (sigma >= 3) 1D kernel L1 farki <= 0.05, yani cikti
+    //   hatasi en kotu durumda <= 0.1 * 255 (~26 LSB); yumusak goruntulerde
+    //   tipik hata birkac LSB'dir.
+    // Auto: sigma >= kAutoSigmaThreshold ve kernel +-3 sigma kapsiyorsa
+    //   StackedBox, aksi halde Exact.
+    enum Mode { Exact, StackedBox, Auto };
+
+    static constexpr double kAutoSigmaThreshold = 5.0;
+
+    GaussianBlur(double sigma = 1.0, int kernel_size = 3, Mode mode = Auto);
+
+    using Filter::apply;
+    void apply(const ConstImageView& input, const ImageView& output) const override;
     std::string getName() const override { return "GaussianBlur"; }
     std::unique_ptr<Filter> clone() const override;
-    
+    std::string getFingerprint() const override;
+    int getRadius() const override;
+
     void setSigma(double sigma);
     void setKernelSize(int size);
-    
+    void setMode(Mode mode) { mode_ = mode; }
+    Mode getMode() const { return mode_; }
+    bool usesStackedBox() const;
+
+    // Varsayilan Renormalize. StackedBox modunda kenar modu her kutu
+    // gecisinde uygulanir.
+    void setBorderMode(BorderMode mode, Image::Pixel value = 0);
+    BorderMode getBorderMode() const { return border_mode_; }
+    Image::Pixel getBorderValue() const { return border_value_; }
+    bool isLocal() const override { return border_mode_ != Wrap; }
+
+    // Sabit noktali 1D agirliklar; toplamlari tam olarak 1 << kWeightBits
+    static constexpr int kWeightBits = 14;
+    const std::vector<int32_t>& getWeights() const { return weights_; }
+    // StackedBox modunun kutu yaricaplari (genislik = 2r + 1)
+    const std::vector<int>& getBoxRadii() const { return box_radii_; }
+
 private:
     double sigma_;
     int kernel_size_;
-    std::vector<std::vector<double>> kernel_;
-    
+    Mode mode_;
+    BorderMode border_mode_ = Renormalize;
+    Image::Pixel border_value_ = 0;
+    std::vector<double> kernel_;
+    std::vector<int32_t> weights_;
+    std::vector<int> box_radii_;
+    std::vector<uint64_t> reciprocals_;
+
     void generateKernel();
-    double gaussianFunction(double x, double y) const;
+    void generateWeights();
+    void generateBoxRadii();
+    double gaussianFunction(double x) const;
+
+    void horizontalPass(const ConstImageView& input, uint16_t* temp,
+                        int y_begin, int y_end) const;
+    void verticalPass(const uint16_t* temp, int temp_begin,
+                      const ImageView& output, int y_begin, int y_end) const;
+    void applyStackedBox(const ConstImageView& input, const ImageView& output) const;
 };
 
-} // namespace GorselIsleme
\ No newline at end of file
+} // namespace GorselIsleme
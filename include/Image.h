@@ -1,4 +1,6 @@
 #pragma once
+#include "BufferPool.h"
+#include "ImageView.h"
 #include <vector>
 #include <string>
 #include <memory>
@@ -8,28 +10,55 @@ namespace GorselIsleme {
 class Image {
 public:
     using Pixel = unsigned char;
-    using PixelVector = std::vector<Pixel>;
+    // 64 bayt hizali, BufferPool uzerinden ayrilan depolama
+    using PixelVector = std::vector<Pixel, PixelAllocator<Pixel>>;
+    
+    // Zeroed: pikseller sifirlanir. Uninitialized: piksel bellegi yazilmaz;
+    //   tamami hemen uzerine yazilacak ciktilar icin (satir dolgusu yine sifirdir).
+    enum Initialization { Zeroed, Uninitialized };
+    // Packed: satirlar bitisik (stride = width * channels).
+    // PaddedRows: her satir 64 bayt hizali baslar; satir sonunda vektor
+    //   yuklemelerine yetecek dolgu bulunur.
+    enum Layout { Packed, PaddedRows };
     
     Image(int width = 0, int height = 0, int channels = 1);
+    Image(int width, int height, int channels, Initialization init, Layout layout = Packed);
+    explicit Image(const ConstImageView& view, Layout layout = Packed);
     Image(const Image& other);
     Image& operator=(const Image& other);
+    // Tasima piksel tamponunu devralir; kaynak bos (0x0) kalir
+    Image(Image&& other) noexcept;
+    Image& operator=(Image&& other) noexcept;
     
     // Piksel erisim
     Pixel& at(int x, int y, int channel = 0);
     const Pixel& at(int x, int y, int channel = 0) const;
     
+    // Gorunumler (kontrolsuz satir erisimi, kopyasiz ROI)
+    ImageView view();
+    ConstImageView view() const;
+    ImageView view(int x, int y, int width, int height);
+    ConstImageView view(int x, int y, int width, int height) const;
+    
     // Bilgi fonksiyonlari
     int getWidth() const { return width_; }
     int getHeight() const { return height_; }
     int getChannels() const { return channels_; }
+    // Ardisik iki satir arasindaki bayt sayisi
+    std::ptrdiff_t getStride() const { return stride_; }
+    Layout getLayout() const { return layout_; }
     bool empty() const { return data_.empty(); }
     
     // Dosya islemleri
     bool save(const std::string& filename) const;
     static std::unique_ptr<Image> load(const std::string& filename);
-    static std::unique_ptr<Image> loadJPEG(const std::string& filename);
+    // Surec icinde libjpeg ile cozer; thread guvenlidir. scale_denominator
+    // 1, 2, 4 veya 8 (DCT alaninda kucultme, kucuk onizlemeler icin ucuz),
+    // channels 1 (gri) veya 3 (RGB); gecersiz degerlerde std::invalid_argument.
+    static std::unique_ptr<Image> loadJPEG(const std::string& filename, int scale_denominator = 1,
+                                           int channels = 1);
     
-    // Veri erisim
+    // Ham depolama (stride * height bayt); PaddedRows duzeninde satir dolgusunu da icerir
     const PixelVector& getData() const { return data_; }
     PixelVector& getData() { return data_; }
     
@@ -37,6 +66,8 @@ private:
     int width_;
     int height_;
     int channels_;
+    Layout layout_;
+    std::ptrdiff_t stride_;
     PixelVector data_;
     
     bool isValidCoordinate(int x, int y, int channel) const;
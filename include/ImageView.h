@@ -0,0 +1,68 @@
+#pragma once
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+namespace GorselIsleme {
+
+// Sahiplik almayan, satir adimli (stride) piksel gorunumu. Erisimler kontrolsuzdur;
+// sinirlar yalnizca subView olusturulurken denetlenir.
+template <typename PixelT>
+class BasicImageView {
+public:
+    using Pixel = PixelT;
+
+    BasicImageView() = default;
+    BasicImageView(Pixel* data, int width, int height, int channels, std::ptrdiff_t stride)
+        : data_(data), width_(width), height_(height), channels_(channels), stride_(stride) {
+    }
+
+    // ImageView -> ConstImageView donusumu
+    template <typename OtherT,
+              typename = std::enable_if_t<std::is_same<const OtherT, PixelT>::value &&
+                                          !std::is_same<OtherT, PixelT>::value>>
+    BasicImageView(const BasicImageView<OtherT>& other)
+        : data_(other.data()), width_(other.getWidth()), height_(other.getHeight()),
+          channels_(other.getChannels()), stride_(other.getStride()) {
+    }
+
+    int getWidth() const { return width_; }
+    int getHeight() const { return height_; }
+    int getChannels() const { return channels_; }
+    // Ardisik iki satir arasindaki bayt sayisi
+    std::ptrdiff_t getStride() const { return stride_; }
+    size_t getRowSize() const { return static_cast<size_t>(width_) * channels_; }
+    bool empty() const { return data_ == nullptr || width_ <= 0 || height_ <= 0; }
+    bool isContiguous() const { return stride_ == static_cast<std::ptrdiff_t>(getRowSize()); }
+
+    Pixel* data() const { return data_; }
+    Pixel* row(int y) const { return data_ + y * stride_; }
+    Pixel& at(int x, int y, int channel = 0) const {
+        return data_[y * stride_ + x * channels_ + channel];
+    }
+
+    // Ilgi bolgesi (ROI); kopyalamadan ayni bellegi gosterir
+    BasicImageView subView(int x, int y, int width, int height) const {
+        if (x < 0 || y < 0 || width <= 0 || height <= 0 ||
+            x + width > width_ || y + height > height_) {
+            throw std::out_of_range("Gecersiz ilgi bolgesi");
+        }
+        return BasicImageView(row(y) + x * channels_, width, height, channels_, stride_);
+    }
+
+    bool sameSize(int width, int height, int channels) const {
+        return width_ == width && height_ == height && channels_ == channels;
+    }
+
+private:
+    Pixel* data_ = nullptr;
+    int width_ = 0;
+    int height_ = 0;
+    int channels_ = 0;
+    std::ptrdiff_t stride_ = 0;
+};
+
+using ImageView = BasicImageView<unsigned char>;
+using ConstImageView = BasicImageView<const unsigned char>;
+
+} // namespace GorselIsleme
@@ -12,7 +12,14 @@ public:
     ImageViewer();
     ~ImageViewer();
     
+    // Pencere basina doku ve RGBA ara tampon kalicidir; yalnizca goruntu
+    // boyutu degisince yeniden olusturulur. Gri, gri + alfa, RGB ve RGBA
+    // goruntuler desteklenir.
     void goster(const std::string& window_name, const Image& image);
+    // Yalnizca degisen bolge donusturulup dokuya yuklenir (ornegin
+    // FilterPipeline::applyIncremental donusu). Yeni pencerede veya boyut
+    // degisince tum goruntu yuklenir.
+    void goster(const std::string& window_name, const Image& image, int x, int y, int width, int height);
     void waitKey(int delay_ms = 0);
     void destroyWindow(const std::string& window_name);
     void destroyAllWindows();
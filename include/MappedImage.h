@@ -0,0 +1,37 @@
+#pragma once
+#include "Image.h"
+#include <memory>
+#include <string>
+
+namespace GorselIsleme {
+
+class FileMapping;
+
+// Dosyaya eslenmis (mmap), salt okunur 8 bit P5/P6 goruntu. Piksel verisi
+// kopyalanmadan ve sifirlanmadan dogrudan sayfa onbelleginden okunur;
+// sayfalar ilk erisimde yuklenir. view() nesne yasadigi surece gecerlidir.
+class MappedImage {
+public:
+    // Dosya acilamaz, baslik gecersiz, veri eksik veya ornekler 16 bit ise
+    // nullptr (16 bit icin Image::load donusturerek yukler)
+    static std::unique_ptr<MappedImage> open(const std::string& filename);
+    ~MappedImage();
+    
+    MappedImage(const MappedImage&) = delete;
+    MappedImage& operator=(const MappedImage&) = delete;
+    
+    int getWidth() const { return view_.getWidth(); }
+    int getHeight() const { return view_.getHeight(); }
+    int getChannels() const { return view_.getChannels(); }
+    
+    // Filtrelerin view overload'una dogrudan verilebilir
+    ConstImageView view() const { return view_; }
+    
+private:
+    MappedImage() = default;
+    
+    std::unique_ptr<FileMapping> mapping_;
+    ConstImageView view_;
+};
+
+} // namespace GorselIsleme
@@ -0,0 +1,23 @@
+#pragma once
+#include "FilterPipeline.h"
+#include <memory>
+#include <string>
+
+namespace GorselIsleme {
+
+// Metin tanimindan pipeline kurar. Asamalar virgulle, parametreler iki
+// noktayla ayrilir; bosluklar yok sayilir. Ornek: "blur:1.5:5,brightness:1.2,edge:both:l1"
+//
+//   blur:sigma[:kernel[:exact|box|auto]]   (kernel varsayilani 2*ceil(3*sigma)+1)
+//   edge[:both|horizontal|vertical[:l2|l1|max[:sobel|scharr|laplacian]]]
+//   brightness:faktor   contrast:faktor   gamma:gamma   threshold:esik
+//   invert
+//
+// Komsuluk filtrelerine (blur, edge) "@mod" soneki kenar modunu verir:
+//   @renormalize (varsayilan), @clamp, @reflect, @wrap, @constant[=deger]
+//   Ornek: "blur:2@reflect,edge@constant=128"
+//
+// Gecersiz tanimda std::invalid_argument atar.
+std::unique_ptr<FilterPipeline> parsePipelineSpec(const std::string& spec);
+
+} // namespace GorselIsleme
@@ -0,0 +1,140 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace GorselIsleme {
+
+// FilterPipeline izleme olaylari. Zamanlar izleme saatine (steady_clock,
+// ilk kullanimdan beri) gore mikrosaniyedir.
+
+// Bir asamanin bir apply icindeki calismasi
+struct StageEvent {
+    uint64_t apply_id = 0;        // ayni apply'in asamalari ayni kimligi tasir
+    size_t stage_index = 0;
+    std::string name;             // birlesmis nokta islemlerinde "A+B"
+    // Tiled modda asamalar karolar icinde ic ice calisir; sure tum karolar
+    // ve thread'ler uzerinden toplanmis asama suresidir, start_us apply
+    // baslangicidir. Sequential modda gercek duvar saati araligidir.
+    bool fused = false;
+    double start_us = 0.0;
+    double duration_us = 0.0;
+    uint64_t pixels = 0;          // asamanin urettigi piksel sayisi
+    // Bu apply'in (cagiran thread ve parallelFor yardimcilari) BufferPool ve
+    // gecici tampon ayirmalari; es zamanli apply'lar birbirine karismaz
+    uint64_t allocated_bytes = 0;
+    // Bu apply'in havuz govdelerindeki mesgul suresi / (sure * thread sayisi), 0..1
+    double thread_utilization = 0.0;
+    uint32_t thread_id = 0;       // apply'i cagiran thread'in izleme kimligi
+};
+
+// Bir apply cagrisinin tamami
+struct ApplyEvent {
+    uint64_t apply_id = 0;
+    double start_us = 0.0;
+    double duration_us = 0.0;
+    int width = 0;
+    int height = 0;
+    int channels = 0;
+    bool tiled = false;
+    size_t stage_count = 0;
+    uint64_t allocated_bytes = 0;
+    double thread_utilization = 0.0;
+    uint32_t thread_id = 0;
+};
+
+// Olaylar apply'i cagiran thread'den, asamalar bittikce gelir. Kopyalanan
+// (clone) pipeline'lar gozlemciyi paylastigindan uygulamalar thread
+// guvenli olmalidir.
+class PipelineObserver {
+public:
+    virtual ~PipelineObserver() = default;
+
+    virtual void onStage(const StageEvent& event) { (void)event; }
+    virtual void onApply(const ApplyEvent& event) { (void)event; }
+};
+
+// Izleme saati (mikrosaniye) ve cagiran thread'in kucuk tam sayi kimligi
+double traceTimestampUs();
+uint32_t traceThreadId();
+
+// Olaylari biriktirir ve Chrome trace-event JSON olarak yazar
+// (chrome://tracing veya ui.perfetto.dev ile acilir). Sequential asamalar
+// apply diliminin icinde, Tiled asama toplamlari ayri bir izde gosterilir.
+class ChromeTraceRecorder : public PipelineObserver {
+public:
+    void onStage(const StageEvent& event) override;
+    void onApply(const ApplyEvent& event) override;
+
+    void write(std::ostream& out) const;
+    bool save(const std::string& filename) const;
+    void clear();
+    size_t getEventCount() const;
+
+private:
+    mutable std::mutex mutex_;
+    std::vector<StageEvent> stages_;
+    std::vector<ApplyEvent> applies_;
+};
+
+// Filtre adi basina birikimli istatistik. Gecikmeler log olcekli
+// histogramda (oktav basina 8 kova, ~%5 cozunurluk) tutulur; bellek
+// kullanimi olay sayisindan bagimsizdir.
+class PipelineStats : public PipelineObserver {
+public:
+    struct Entry {
+        std::string name;
+        uint64_t count = 0;
+        double total_ms = 0.0;
+        double p50_ms = 0.0;
+        double p99_ms = 0.0;
+        double max_ms = 0.0;
+        uint64_t pixels = 0;
+        uint64_t allocated_bytes = 0;
+
+        double megapixelsPerSecond() const;
+    };
+
+    void onStage(const StageEvent& event) override;
+
+    // Ada gore sirali anlik kopya
+    std::vector<Entry> snapshot() const;
+    void reset();
+
+private:
+    static constexpr int kBucketsPerOctave = 8;
+    static constexpr int kBucketCount = 40 * kBucketsPerOctave;
+
+    struct Accumulator {
+        uint64_t count = 0;
+        double total_us = 0.0;
+        double max_us = 0.0;
+        uint64_t pixels = 0;
+        uint64_t allocated_bytes = 0;
+        std::array<uint64_t, kBucketCount> buckets{};
+    };
+
+    mutable std::mutex mutex_;
+    std::map<std::string, Accumulator> entries_;
+
+    static double percentile(const Accumulator& accumulator, double fraction);
+};
+
+// Olaylari birden fazla gozlemciye iletir (ornegin istatistik + trace)
+class ObserverGroup : public PipelineObserver {
+public:
+    void add(std::shared_ptr<PipelineObserver> observer);
+
+    void onStage(const StageEvent& event) override;
+    void onApply(const ApplyEvent& event) override;
+
+private:
+    std::vector<std::shared_ptr<PipelineObserver>> observers_;
+};
+
+} // namespace GorselIsleme
@@ -0,0 +1,104 @@
+#pragma once
+#include "Filter.h"
+#include <array>
+#include <functional>
+
+namespace GorselIsleme {
+
+// Nokta islemleri: her bayt yalnizca kendi degerine bagli oldugundan islem
+// 256 girdilik bir tabloya (LUT) derlenir. FilterPipeline ardisik nokta
+// islemlerini tek tabloda birlestirir.
+class PointOp : public Filter {
+public:
+    using Lut = std::array<Image::Pixel, 256>;
+
+    using Filter::apply;
+    void apply(const ConstImageView& input, const ImageView& output) const override;
+
+    int getRadius() const override { return 0; }
+    bool supportsInPlace() const override { return true; }
+    // Tablonun ozeti: ayni tabloyu ureten nokta islemleri esdegerdir
+    std::string getFingerprint() const override;
+
+    const Lut& getLut() const { return lut_; }
+
+    // Once first, sonra second: sonuc[v] = second[first[v]]
+    static Lut compose(const Lut& first, const Lut& second);
+    static Lut identity();
+    // Giris ve cikis ayni bellek olabilir (yerinde uygulama)
+    static void applyLut(const Lut& lut, const ConstImageView& input, const ImageView& output);
+
+protected:
+    PointOp() : lut_(identity()) {}
+
+    Lut lut_;
+};
+
+// cikis = (v - 128) * factor + 128
+class ContrastAdjust : public PointOp {
+public:
+    ContrastAdjust(double factor = 1.0);
+
+    std::string getName() const override { return "ContrastAdjust"; }
+    std::unique_ptr<Filter> clone() const override;
+
+    void setFactor(double factor);
+
+private:
+    double factor_;
+
+    void updateLut();
+};
+
+// cikis = 255 * (v / 255)^(1 / gamma); gamma > 1 aydinlatir
+class GammaCorrection : public PointOp {
+public:
+    GammaCorrection(double gamma = 1.0);
+
+    std::string getName() const override { return "GammaCorrection"; }
+    std::unique_ptr<Filter> clone() const override;
+
+    void setGamma(double gamma);
+
+private:
+    double gamma_;
+
+    void updateLut();
+};
+
+// cikis = 255 - v
+class Invert : public PointOp {
+public:
+    Invert();
+
+    std::string getName() const override { return "Invert"; }
+    std::unique_ptr<Filter> clone() const override;
+};
+
+// cikis = v > threshold ? 255 : 0
+class Threshold : public PointOp {
+public:
+    Threshold(int threshold = 127);
+
+    std::string getName() const override { return "Threshold"; }
+    std::unique_ptr<Filter> clone() const override;
+
+    void setThreshold(int threshold);
+
+private:
+    int threshold_;
+
+    void updateLut();
+};
+
+// Kullanici tanimli egri
+class CurveAdjust : public PointOp {
+public:
+    explicit CurveAdjust(const Lut& lut);
+    explicit CurveAdjust(const std::function<Image::Pixel(Image::Pixel)>& curve);
+
+    std::string getName() const override { return "CurveAdjust"; }
+    std::unique_ptr<Filter> clone() const override;
+};
+
+} // namespace GorselIsleme
@@ -0,0 +1,73 @@
+#pragma once
+#include "Image.h"
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace GorselIsleme {
+
+// Icerik adresli ara sonuc onbellegi. Anahtar (girdi icerik ozeti, asama
+// onekinin parametre ozeti) ciftidir; goruntuler paylasilan ve degismez
+// olarak saklanir. Bayt butcesi asilinca en uzun suredir kullanilmayan
+// girdi atilir. Thread guvenlidir; birden fazla pipeline paylasabilir.
+class ResultCache {
+public:
+    struct Key {
+        uint64_t input = 0;   // girdi pikselleri ve boyutlari
+        uint64_t prefix = 0;  // uygulanan filtrelerin parmak izleri
+
+        bool operator==(const Key& other) const { return input == other.input && prefix == other.prefix; }
+    };
+
+    struct Stats {
+        uint64_t hits = 0;       // arama basina
+        uint64_t misses = 0;
+        uint64_t insertions = 0;
+        uint64_t evictions = 0;
+        size_t entries = 0;
+        size_t bytes = 0;
+    };
+
+    explicit ResultCache(size_t byte_budget);
+
+    ResultCache(const ResultCache&) = delete;
+    ResultCache& operator=(const ResultCache&) = delete;
+
+    // Bulunursa girdi en yeni kullanilan olur
+    std::shared_ptr<const Image> find(const Key& key);
+    // Ayni anahtar varsa yenilenir. Butceden buyuk goruntu saklanmaz.
+    void insert(const Key& key, std::shared_ptr<const Image> image);
+    void clear();
+
+    // Kuculurse fazlalik hemen atilir
+    void setByteBudget(size_t byte_budget);
+    size_t getByteBudget() const;
+    Stats getStats() const;
+
+    // Goruntu boyutlari ve satir iceriklerinin ozeti (dolgu haric)
+    static uint64_t hashImage(const Image& image);
+
+private:
+    struct Entry {
+        Key key;
+        std::shared_ptr<const Image> image;
+        size_t bytes;
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const { return static_cast<size_t>(key.input ^ (key.prefix * 31)); }
+    };
+
+    mutable std::mutex mutex_;
+    size_t byte_budget_;
+    // Bastaki en yeni kullanilan
+    std::list<Entry> entries_;
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> index_;
+    Stats stats_;
+
+    void evictTo(size_t byte_budget);
+};
+
+} // namespace GorselIsleme
@@ -0,0 +1,15 @@
+#pragma once
+#include "ImageView.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace GorselIsleme {
+
+// Gorunumu 8 bit RGBA'ya genisletir (doku yuklemesi icin): 1 kanal gri
+// (v, v, v, 255), 2 kanal gri + alfa, 3 kanal RGB (alfa 255), 4 kanal
+// oldugu gibi kopyalanir. output satirlari output_stride bayt arayla
+// yazilir (en az 4 * genislik). Gri ve RGB yollari SIMD ile calisir;
+// pencere veya ekran gerektirmez.
+void convertToRgba(const ConstImageView& input, uint8_t* output, std::ptrdiff_t output_stride);
+
+} // namespace GorselIsleme
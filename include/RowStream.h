@@ -0,0 +1,105 @@
+#pragma once
+#include "Image.h"
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace GorselIsleme {
+
+// Yukaridan asagiya satir satir okunan goruntu kaynagi
+class RowSource {
+public:
+    virtual ~RowSource() = default;
+
+    virtual int getWidth() const = 0;
+    virtual int getHeight() const = 0;
+    virtual int getChannels() const = 0;
+
+    // Siradaki destination.getHeight() satiri okur; basarisizlikta istisna atar
+    virtual void readRows(const ImageView& destination) = 0;
+};
+
+// Satirlari sirayla alan hedef
+class RowSink {
+public:
+    virtual ~RowSink() = default;
+
+    virtual void writeRows(const ConstImageView& rows) = 0;
+    // Tum satirlar yazildiktan sonra bir kez cagrilir
+    virtual void finish() {}
+};
+
+// P5 (gri) / P6 (RGB); 16 bit ornekler 8 bite olceklenir
+class PnmRowSource : public RowSource {
+public:
+    // Dosya acilamaz veya baslik gecersizse std::runtime_error
+    explicit PnmRowSource(const std::string& filename);
+
+    int getWidth() const override { return width_; }
+    int getHeight() const override { return height_; }
+    int getChannels() const override { return channels_; }
+    void readRows(const ImageView& destination) override;
+
+private:
+    std::ifstream file_;
+    int width_ = 0;
+    int height_ = 0;
+    int channels_ = 0;
+    int max_value_ = 0;
+    int next_row_ = 0;
+    std::vector<unsigned char> samples_; // 16 bit satir tamponu
+};
+
+// Baslik hemen yazilir; 1 kanal P5, 3 kanal P6
+class PnmRowSink : public RowSink {
+public:
+    PnmRowSink(const std::string& filename, int width, int height, int channels);
+
+    void writeRows(const ConstImageView& rows) override;
+    // Eksik satir veya yazma hatasinda std::runtime_error
+    void finish() override;
+
+private:
+    std::ofstream file_;
+    std::string filename_;
+    int width_;
+    int height_;
+    int channels_;
+    int written_rows_ = 0;
+};
+
+// Bellekteki goruntu uzerinden kaynak/hedef
+class ImageRowSource : public RowSource {
+public:
+    explicit ImageRowSource(const Image& image) : image_(image) {}
+
+    int getWidth() const override { return image_.getWidth(); }
+    int getHeight() const override { return image_.getHeight(); }
+    int getChannels() const override { return image_.getChannels(); }
+    void readRows(const ImageView& destination) override;
+
+private:
+    const Image& image_;
+    int next_row_ = 0;
+};
+
+class ImageRowSink : public RowSink {
+public:
+    // image, kaynakla ayni boyutta olmalidir
+    explicit ImageRowSink(Image& image) : image_(image) {}
+
+    void writeRows(const ConstImageView& rows) override;
+
+private:
+    Image& image_;
+    int next_row_ = 0;
+};
+
+// FilterPipeline::applyStreaming ozeti
+struct StreamStats {
+    int strips = 0;
+    // Serit pencereleri ve ara tamponun toplam boyutu; goruntu boyutundan bagimsiz
+    size_t buffer_bytes = 0;
+};
+
+} // namespace GorselIsleme
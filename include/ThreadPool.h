@@ -0,0 +1,93 @@
+#pragma once
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace GorselIsleme {
+
+// body(begin, end) icin sahiplik almayan cagri referansi. std::function'in
+// aksine yakalanan degiskenler icin yigin ayirmaz; cagri suresince gecerlidir.
+class RangeTask {
+public:
+    template <typename F, typename = std::enable_if_t<!std::is_same<std::decay_t<F>, RangeTask>::value>>
+    RangeTask(F&& function)
+        : object_(const_cast<void*>(static_cast<const void*>(&function))),
+          call_(&invoke<std::remove_reference_t<F>>) {
+    }
+
+    void operator()(int begin, int end) const { call_(object_, begin, end); }
+
+private:
+    template <typename F>
+    static void invoke(void* object, int begin, int end) {
+        (*static_cast<F*>(object))(begin, end);
+    }
+
+    void* object_;
+    void (*call_)(void*, int, int);
+};
+
+// Kutuphane genelinde paylasilan is parcacigi havuzu. thread_count, cagiran
+// thread dahil toplam paralellik derecesidir: havuz thread_count - 1 isci
+// baslatir, parallelFor cagiran thread'i da calistirir. Boylece ic ice
+// parallelFor (ornegin havuz gorevi icinden filtre uygulamak) kilitlenmez.
+class ThreadPool {
+public:
+    // 0: std::thread::hardware_concurrency()
+    explicit ThreadPool(size_t thread_count = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    size_t getThreadCount() const;
+    // Bekleyen gorevler bitirilir, isciler yeniden baslatilir. Havuzun kendi
+    // iscilerinden cagrilmamalidir.
+    void setThreadCount(size_t thread_count);
+
+    // Iscisi olmayan havuzda gorev cagiran thread'de hemen calisir
+    void submit(std::function<void()> task);
+
+    // [begin, end) araligini grain boyutlu parcalara boler ve body(parca_basi,
+    // parca_sonu) cagirir. Tum parcalar bitince doner; ilk istisna yeniden atilir.
+    void parallelFor(int begin, int end, int grain, RangeTask body);
+
+    // Satir bantlari: bant basina en az ~64 KB ve min_rows satir, thread basina
+    // birkac bant. Tek thread'de tum satirlar tek bant olarak islenir.
+    void parallelRows(int rows, size_t bytes_per_row, RangeTask body, int min_rows = 1);
+
+    static ThreadPool& global();
+    static void setGlobalThreadCount(size_t thread_count);
+
+private:
+    struct ParallelForState;
+
+    // Kuyruk elemani: ya genel gorev ya da parallelFor yardimcisi. Vektor
+    // tabanli kuyruk bosaldikca bastan kullanilir, kararli durumda ayirma yapmaz.
+    struct Task {
+        std::function<void()> function;
+        ParallelForState* parallel_for = nullptr;
+    };
+
+    mutable std::mutex mutex_;
+    std::condition_variable condition_;
+    std::vector<Task> tasks_;
+    size_t task_head_ = 0;
+    std::vector<std::thread> workers_;
+    size_t thread_count_ = 1;
+    bool stopping_ = false;
+
+    void runBody(const RangeTask& body, int begin, int end);
+
+    void enqueueHelpers(ParallelForState* state, size_t count);
+    void cancelHelpers(ParallelForState* state);
+    void startWorkers(size_t thread_count);
+    void stopWorkers();
+    void workerLoop();
+};
+
+} // namespace GorselIsleme
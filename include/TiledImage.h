@@ -0,0 +1,134 @@
+#pragma once
+#include "Image.h"
+#include "RowStream.h"
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace GorselIsleme {
+
+// Karolu, cok cozunurluklu goruntu dosyasi (.gtf). Duzen (little-endian):
+//   baslik (40 bayt) | seviye tablosu | karo indeksi | karolar
+// Her seviye sabit boyutlu kare karolara bolunur; kenar karolari da tam
+// boyutta saklanir. Seviye n+1, seviye n'nin 2x2 ortalamasidir. Indeks her
+// karo icin ofset, boyut ve kodlamayi tutar. Ham karolar 4096 bayt hizali
+// baslar ve eslenmis dosyadan kopyasiz okunur; RLE (PackBits) karolar bitisik
+// saklanir ve okunurken cozulur.
+
+// Satirlari sirayla alir (RowSink), karo satiri doldukca karolari ve
+// piramit seviyelerini yazar; bellek genislik x karo boyutu mertebesindedir.
+// FilterPipeline::applyStreaming ciktisi dogrudan verilebilir.
+class TiledImageWriter : public RowSink {
+public:
+    struct Options {
+        int tile_size = 256;   // 16'nin kati, 16..4096
+        // Piramit seviye sayisi (tam cozunurluk dahil); 0: en kucuk seviye
+        // tek karoya sigana kadar
+        int levels = 1;
+        // Karo bazinda RLE; yalnizca kuculen karolar sikistirilmis yazilir
+        bool compress = false;
+    };
+
+    // Gecersiz boyut/secenekte std::invalid_argument, dosya acilamazsa std::runtime_error
+    TiledImageWriter(const std::string& filename, int width, int height, int channels,
+                     const Options& options);
+    TiledImageWriter(const std::string& filename, int width, int height, int channels);
+    ~TiledImageWriter() override;
+
+    void writeRows(const ConstImageView& rows) override;
+    // Indeksi yazar; eksik satir veya yazma hatasinda std::runtime_error
+    void finish() override;
+
+    int getLevelCount() const { return static_cast<int>(levels_.size()); }
+
+private:
+    struct Level {
+        int width = 0;
+        int height = 0;
+        int tiles_x = 0;
+        size_t first_tile = 0;
+        Image::PixelVector band;   // karo yuksekliginde satir seridi
+        int band_rows = 0;
+        int received_rows = 0;
+    };
+    struct TileEntry {
+        uint64_t offset = 0;
+        uint32_t size = 0;
+        uint32_t encoding = 0;
+    };
+
+    std::ofstream file_;
+    std::string filename_;
+    int channels_;
+    Options options_;
+    std::vector<Level> levels_;
+    std::vector<TileEntry> index_;
+    uint64_t position_ = 0;
+    std::vector<unsigned char> tile_;
+    std::vector<unsigned char> encoded_;
+    std::vector<unsigned char> downsampled_;
+    bool finished_ = false;
+
+    void pushRow(size_t level, const Image::Pixel* row);
+    void flushBand(size_t level);
+    void writeTile(size_t level, int tile_x, int tile_y);
+    void writeBytes(const unsigned char* data, size_t size);
+};
+
+class FileMapping;
+
+// Salt okunur karolu goruntu. Bolge okumalari yalnizca bolgeyle kesisen
+// karolara dokunur; nesne farkli thread'lerden ayni anda okunabilir.
+class TiledImageReader {
+public:
+    // Dosya acilamaz veya bicim gecersizse nullptr
+    static std::unique_ptr<TiledImageReader> open(const std::string& filename);
+    ~TiledImageReader();
+
+    TiledImageReader(const TiledImageReader&) = delete;
+    TiledImageReader& operator=(const TiledImageReader&) = delete;
+
+    int getLevelCount() const { return static_cast<int>(levels_.size()); }
+    int getWidth(int level = 0) const;
+    int getHeight(int level = 0) const;
+    int getChannels() const { return channels_; }
+    int getTileSize() const { return tile_size_; }
+
+    // output boyutundaki (x, y) baslangicli bolgeyi verilen seviyeden okur.
+    // Bolge seviye disina tasarsa std::out_of_range, kanal sayisi uymazsa
+    // std::invalid_argument, bozuk karoda std::runtime_error.
+    void readRegion(int level, int x, int y, const ImageView& output) const;
+    std::unique_ptr<Image> readRegion(int level, int x, int y, int width, int height) const;
+
+    // Simdiye kadar okunan (dokunulan) karo sayisi
+    size_t getTileReadCount() const { return tile_reads_.load(std::memory_order_relaxed); }
+
+private:
+    struct Level {
+        int width = 0;
+        int height = 0;
+        int tiles_x = 0;
+        size_t first_tile = 0;
+    };
+    struct TileEntry {
+        uint64_t offset = 0;
+        uint32_t size = 0;
+        uint32_t encoding = 0;
+    };
+
+    TiledImageReader() = default;
+
+    std::unique_ptr<FileMapping> mapping_;
+    int channels_ = 0;
+    int tile_size_ = 0;
+    std::vector<Level> levels_;
+    std::vector<TileEntry> index_;
+    mutable std::atomic<size_t> tile_reads_{0};
+
+    const Level& level(int level) const;
+};
+
+} // namespace GorselIsleme
@@ -0,0 +1,423 @@
+#include "AsyncExecutor.h"
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+
+namespace GorselIsleme {
+
+namespace {
+
+constexpr size_t kDefaultWorkers = 2;
+
+JobHandle::State toState(JobResult::Status status) {
+    switch (status) {
+        case JobResult::Completed: return JobHandle::Completed;
+        case JobResult::Cancelled: return JobHandle::Cancelled;
+        case JobResult::DeadlineExceeded: return JobHandle::DeadlineExceeded;
+        default: return JobHandle::Failed;
+    }
+}
+
+} // namespace
+
+// Isin paylasilan durumu. Sonucu tek bir taraf teslim eder: calistiran
+// dagitici, kuyruktayken cancel() cagiran veya son tarihi gecen isi temizleyen.
+// Teslim hakki claim() ile alinir; teslim kilit disinda yapilir.
+struct JobHandle::Job {
+    std::unique_ptr<Image> input; // teslimde birakilir
+    std::shared_ptr<const FilterPipeline> pipeline;
+    AsyncExecutor::Callback callback;
+    std::promise<std::unique_ptr<Image>> promise;
+    CancellationToken token;
+    JobOptions::Priority priority;
+    uint64_t sequence = 0; // kuyruga eklenirken executor kilidi altinda atanir
+    size_t pixels;
+
+    std::mutex mutex;
+    std::condition_variable done;
+    State state = Queued;
+    bool claimed = false;
+
+    Job(std::unique_ptr<Image>&& input, std::shared_ptr<const FilterPipeline>&& pipeline,
+        AsyncExecutor::Callback&& callback, const JobOptions& options)
+        : input(std::move(input)), pipeline(std::move(pipeline)), callback(std::move(callback)),
+          token(options.deadline), priority(options.priority),
+          pixels(static_cast<size_t>(this->input->getWidth()) * this->input->getHeight()) {
+    }
+
+    // Once yuksek oncelik, sonra erken son tarih, sonra gelis sirasi
+    bool before(const Job& other) const {
+        if (priority != other.priority) {
+            return priority > other.priority;
+        }
+        if (token.getDeadline() != other.token.getDeadline()) {
+            return token.getDeadline() < other.token.getDeadline();
+        }
+        return sequence < other.sequence;
+    }
+
+    bool claim(State expected) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (state != expected || claimed) {
+            return false;
+        }
+        claimed = true;
+        return true;
+    }
+
+    // Kuyruktaki isi calismaya gecirir; iptal edilmisse false
+    bool start() {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (state != Queued || claimed) {
+            return false;
+        }
+        state = Running;
+        return true;
+    }
+
+    // Geri cagirma durumdan once calisir: wait() dondugunde bitmistir.
+    // Future ise durumdan sonra hazir olur: get() sonrasi getState() son durumu verir.
+    void deliver(JobResult& result, std::exception_ptr error) {
+        input.reset();
+        if (callback) {
+            try {
+                callback(result);
+            } catch (...) {
+            }
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            state = toState(result.status);
+        }
+        done.notify_all();
+        if (!callback) {
+            if (result.status == JobResult::Completed) {
+                promise.set_value(std::move(result.output));
+            } else {
+                promise.set_exception(error);
+            }
+        }
+    }
+
+    void abandon(OperationCancelled::Reason reason) {
+        JobResult result;
+        result.status = reason == OperationCancelled::Cancelled ? JobResult::Cancelled : JobResult::DeadlineExceeded;
+        const OperationCancelled error(reason);
+        result.error = error.what();
+        deliver(result, std::make_exception_ptr(error));
+    }
+};
+
+JobOptions JobOptions::withTimeout(std::chrono::milliseconds timeout, Priority priority) {
+    JobOptions options;
+    options.priority = priority;
+    options.deadline = CancellationToken::Clock::now() + timeout;
+    return options;
+}
+
+JobHandle::State JobHandle::getState() const {
+    if (!job_) {
+        throw std::runtime_error("Gecersiz is tutamaci");
+    }
+    std::lock_guard<std::mutex> lock(job_->mutex);
+    return job_->state;
+}
+
+bool JobHandle::isDone() const {
+    const State state = getState();
+    return state != Queued && state != Running;
+}
+
+void JobHandle::cancel() {
+    if (!job_) {
+        return;
+    }
+    job_->token.cancel();
+    if (job_->claim(Queued)) {
+        job_->abandon(OperationCancelled::Cancelled);
+    }
+}
+
+void JobHandle::wait() const {
+    if (!job_) {
+        throw std::runtime_error("Gecersiz is tutamaci");
+    }
+    std::unique_lock<std::mutex> lock(job_->mutex);
+    job_->done.wait(lock, [this]() { return job_->state != Queued && job_->state != Running; });
+}
+
+bool JobHandle::waitFor(std::chrono::milliseconds timeout) const {
+    if (!job_) {
+        throw std::runtime_error("Gecersiz is tutamaci");
+    }
+    std::unique_lock<std::mutex> lock(job_->mutex);
+    return job_->done.wait_for(lock, timeout,
+                               [this]() { return job_->state != Queued && job_->state != Running; });
+}
+
+std::future<std::unique_ptr<Image>>& JobHandle::getFuture() {
+    if (!future_) {
+        throw std::runtime_error("Is future ile gonderilmedi");
+    }
+    return *future_;
+}
+
+AsyncExecutor::AsyncExecutor(const ExecutorOptions& options)
+    : capacity_(options.queue_capacity), small_job_pixels_(options.small_job_pixels) {
+    if (capacity_ == 0) {
+        throw std::invalid_argument("Kuyruk kapasitesi pozitif olmali");
+    }
+    const size_t worker_count = options.workers == 0 ? kDefaultWorkers : options.workers;
+    const bool express_lane = worker_count >= 2 && small_job_pixels_ > 0;
+    queue_.reserve(capacity_);
+    for (size_t i = 0; i < worker_count; ++i) {
+        workers_.emplace_back(&AsyncExecutor::workerLoop, this, express_lane && i == 0);
+    }
+}
+
+AsyncExecutor::~AsyncExecutor() {
+    cancelAll();
+    shutdown();
+}
+
+JobHandle AsyncExecutor::submit(const Image& input, std::shared_ptr<const FilterPipeline> pipeline,
+                                const JobOptions& options) {
+    return enqueue(input, std::move(pipeline), Callback(), options, true);
+}
+
+JobHandle AsyncExecutor::submit(const Image& input, std::shared_ptr<const FilterPipeline> pipeline, Callback callback,
+                                const JobOptions& options) {
+    if (!callback) {
+        throw std::invalid_argument("Geri cagirma bos olamaz");
+    }
+    return enqueue(input, std::move(pipeline), std::move(callback), options, true);
+}
+
+JobHandle AsyncExecutor::trySubmit(const Image& input, std::shared_ptr<const FilterPipeline> pipeline,
+                                   const JobOptions& options) {
+    return enqueue(input, std::move(pipeline), Callback(), options, false);
+}
+
+JobHandle AsyncExecutor::trySubmit(const Image& input, std::shared_ptr<const FilterPipeline> pipeline,
+                                   Callback callback, const JobOptions& options) {
+    if (!callback) {
+        throw std::invalid_argument("Geri cagirma bos olamaz");
+    }
+    return enqueue(input, std::move(pipeline), std::move(callback), options, false);
+}
+
+JobHandle AsyncExecutor::enqueue(const Image& input, std::shared_ptr<const FilterPipeline>&& pipeline,
+                                 Callback&& callback, const JobOptions& options, bool wait_for_space) {
+    if (!pipeline) {
+        throw std::invalid_argument("Pipeline bos olamaz");
+    }
+    // Girdi kopyasi ve is nesnesi kilit disinda hazirlanir; buyuk bir karenin
+    // kopyasi diger gonderenleri ve dagiticilari bekletmez
+    const bool has_callback = static_cast<bool>(callback);
+    auto job = std::make_shared<Job>(std::make_unique<Image>(input), std::move(pipeline), std::move(callback),
+                                     options);
+    std::shared_ptr<std::future<std::unique_ptr<Image>>> future;
+    if (!has_callback) {
+        future = std::make_shared<std::future<std::unique_ptr<Image>>>(job->promise.get_future());
+    }
+    std::vector<std::shared_ptr<Job>> expired;
+    JobHandle handle;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        for (;;) {
+            if (stopping_) {
+                throw std::runtime_error("Executor kapatildi");
+            }
+            purgeFinished(expired);
+            if (queue_.size() < capacity_) {
+                break;
+            }
+            if (!wait_for_space) {
+                ++stats_.rejected;
+                break;
+            }
+            space_available_.wait(lock);
+        }
+        if (queue_.size() < capacity_) {
+            job->sequence = next_sequence_++;
+            handle = JobHandle(job);
+            handle.future_ = std::move(future);
+            queue_.push_back(std::move(job));
+            ++stats_.submitted;
+            // Kucuk is hatti yalnizca uygun isleri aldigindan hepsi uyandirilir
+            work_available_.notify_all();
+        }
+    }
+    for (auto& job : expired) {
+        job->abandon(OperationCancelled::DeadlineExceeded);
+    }
+    return handle;
+}
+
+void AsyncExecutor::purgeFinished(std::vector<std::shared_ptr<Job>>& expired) {
+    // Kilit altinda: kuyruktayken iptal edilenler cikarilir, son tarihi
+    // gecenler teslim icin expired'a alinir
+    const size_t before = queue_.size();
+    queue_.erase(std::remove_if(queue_.begin(), queue_.end(),
+                                [&](const std::shared_ptr<Job>& job) {
+                                    if (job->token.isExpired() && job->claim(JobHandle::Queued)) {
+                                        ++stats_.expired;
+                                        expired.push_back(job);
+                                        return true;
+                                    }
+                                    std::lock_guard<std::mutex> job_lock(job->mutex);
+                                    if (job->claimed) {
+                                        ++stats_.cancelled;
+                                        return true;
+                                    }
+                                    return false;
+                                }),
+                 queue_.end());
+    if (queue_.size() != before) {
+        space_available_.notify_all();
+    }
+}
+
+std::shared_ptr<AsyncExecutor::Job> AsyncExecutor::takeJob(bool small_only,
+                                                           std::vector<std::shared_ptr<Job>>& expired) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+        purgeFinished(expired);
+        auto best = queue_.end();
+        for (auto it = queue_.begin(); it != queue_.end(); ++it) {
+            if (small_only && (*it)->pixels > small_job_pixels_) {
+                continue;
+            }
+            if (best == queue_.end() || (*it)->before(**best)) {
+                best = it;
+            }
+        }
+        if (best != queue_.end()) {
+            auto job = std::move(*best);
+            queue_.erase(best);
+            running_.push_back(job);
+            space_available_.notify_one();
+            return job;
+        }
+        // Son tarihi gecenler kilit disinda teslim edilir
+        if (!expired.empty() || (stopping_ && (small_only || queue_.empty()))) {
+            return nullptr;
+        }
+        // Bos dagitici, bekleyen islerin en yakin son tarihinde uyanip onlari sonlandirir
+        auto deadline = CancellationToken::Clock::time_point::max();
+        for (const auto& job : queue_) {
+            deadline = std::min(deadline, job->token.getDeadline());
+        }
+        if (deadline == CancellationToken::Clock::time_point::max()) {
+            work_available_.wait(lock);
+        } else {
+            work_available_.wait_until(lock, deadline);
+        }
+    }
+}
+
+void AsyncExecutor::workerLoop(bool small_only) {
+    for (;;) {
+        std::vector<std::shared_ptr<Job>> expired;
+        const auto job = takeJob(small_only, expired);
+        for (auto& item : expired) {
+            item->abandon(OperationCancelled::DeadlineExceeded);
+        }
+        if (!job) {
+            if (expired.empty()) {
+                return;
+            }
+            continue;
+        }
+
+        const JobResult::Status status = run(*job);
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_.erase(std::find(running_.begin(), running_.end(), job));
+        switch (status) {
+            case JobResult::Completed: ++stats_.completed; break;
+            case JobResult::Failed: ++stats_.failed; break;
+            case JobResult::Cancelled: ++stats_.cancelled; break;
+            case JobResult::DeadlineExceeded: ++stats_.expired; break;
+        }
+    }
+}
+
+JobResult::Status AsyncExecutor::run(Job& job) {
+    if (!job.start()) {
+        // Kuyruktan alinmadan hemen once iptal edildi; sonuc teslim edildi
+        return JobResult::Cancelled;
+    }
+
+    JobResult result;
+    std::exception_ptr error;
+    try {
+        result.output = job.pipeline->apply(*job.input, job.token);
+        result.status = JobResult::Completed;
+    } catch (const OperationCancelled& cancelled) {
+        result.status = cancelled.getReason() == OperationCancelled::Cancelled ? JobResult::Cancelled
+                                                                               : JobResult::DeadlineExceeded;
+        result.error = cancelled.what();
+        error = std::current_exception();
+    } catch (const std::exception& failure) {
+        result.status = JobResult::Failed;
+        result.error = failure.what();
+        error = std::current_exception();
+    } catch (...) {
+        result.status = JobResult::Failed;
+        result.error = "Bilinmeyen hata";
+        error = std::current_exception();
+    }
+    job.claim(JobHandle::Running);
+    const JobResult::Status status = result.status;
+    job.deliver(result, error);
+    return status;
+}
+
+void AsyncExecutor::shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+        work_available_.notify_all();
+        space_available_.notify_all();
+    }
+    for (auto& worker : workers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+void AsyncExecutor::cancelAll() {
+    std::vector<std::shared_ptr<Job>> queued;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queued.swap(queue_);
+        queue_.reserve(capacity_);
+        for (auto& job : running_) {
+            job->token.cancel();
+        }
+        space_available_.notify_all();
+    }
+    for (auto& job : queued) {
+        job->token.cancel();
+        const bool claimed = job->claim(JobHandle::Queued);
+        if (claimed) {
+            job->abandon(OperationCancelled::Cancelled);
+        }
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_.cancelled += queued.size();
+}
+
+ExecutorStats AsyncExecutor::getStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ExecutorStats stats = stats_;
+    stats.queued = static_cast<size_t>(std::count_if(queue_.begin(), queue_.end(), [](const std::shared_ptr<Job>& job) {
+        std::lock_guard<std::mutex> job_lock(job->mutex);
+        return !job->claimed;
+    }));
+    stats.running = running_.size();
+    return stats;
+}
+
+} // namespace GorselIsleme
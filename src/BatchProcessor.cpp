@@ -0,0 +1,305 @@
+#include "BatchProcessor.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+
+namespace GorselIsleme {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double elapsedMs(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+std::string lowerExtension(const std::filesystem::path& path) {
+    std::string extension = path.extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return extension;
+}
+
+std::unique_ptr<Image> loadImageFile(const std::string& path) {
+    const std::string extension = lowerExtension(path);
+    if (extension == ".jpg" || extension == ".jpeg") {
+        return Image::loadJPEG(path);
+    }
+    return Image::load(path);
+}
+
+// Uzantisiz cikti yolu: <dizin>/<girdi adi><output_suffix>
+std::filesystem::path outputBase(const std::string& file, const BatchOptions& options) {
+    return std::filesystem::path(options.output_directory) /
+           (std::filesystem::path(file).stem().string() + options.output_suffix);
+}
+
+std::string normalizedPath(const std::filesystem::path& path) {
+    return std::filesystem::weakly_canonical(std::filesystem::absolute(path)).string();
+}
+
+// Cikti yollari isler baslamadan hesaplanir. Uzanti kanal sayisina bagli
+// oldugundan uzantisiz yol karsilastirilir: ayni yola dusen ogeler (a.jpg ve
+// a.pgm) ya da .pgm/.ppm ciktisi bir girdinin uzerine yazacak ogeler
+// hata mesajini alir, digerleri bos kalir.
+std::vector<std::string> findOutputConflicts(const std::vector<std::string>& files, const BatchOptions& options) {
+    std::vector<std::string> conflicts(files.size());
+    std::set<std::string> sources;
+    for (const auto& file : files) {
+        sources.insert(normalizedPath(file));
+    }
+
+    std::map<std::string, std::vector<size_t>> owners;
+    for (size_t i = 0; i < files.size(); ++i) {
+        const std::string base = normalizedPath(outputBase(files[i], options));
+        owners[base].push_back(i);
+        for (const char* extension : {".pgm", ".ppm"}) {
+            if (sources.count(base + extension)) {
+                conflicts[i] = "Cikti bir girdinin uzerine yazar: " + base + extension;
+            }
+        }
+    }
+    for (const auto& owner : owners) {
+        const std::vector<size_t>& indices = owner.second;
+        if (indices.size() < 2) {
+            continue;
+        }
+        for (size_t i = 0; i < indices.size(); ++i) {
+            if (conflicts[indices[i]].empty()) {
+                const size_t other = indices[i == 0 ? 1 : 0];
+                conflicts[indices[i]] = "Cikti yolu baska bir girdiyle cakisiyor: " + files[other];
+            }
+        }
+    }
+    return conflicts;
+}
+
+// Isci basina indeks araligi. Sahibi bastan alir; calan thread kalan
+// araligin arka yarisini kendi kuyruguna tasir.
+class WorkQueue {
+public:
+    void assign(size_t begin, size_t end) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        begin_ = begin;
+        end_ = end;
+    }
+
+    bool pop(size_t& index) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (begin_ == end_) {
+            return false;
+        }
+        index = begin_++;
+        return true;
+    }
+
+    bool stealInto(WorkQueue& thief) {
+        size_t begin = 0;
+        size_t end = 0;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (begin_ == end_) {
+                return false;
+            }
+            const size_t middle = begin_ + (end_ - begin_) / 2;
+            begin = middle;
+            end = end_;
+            end_ = middle;
+        }
+        thief.assign(begin, end);
+        return true;
+    }
+
+private:
+    std::mutex mutex_;
+    size_t begin_ = 0;
+    size_t end_ = 0;
+};
+
+// Isciye ait pipeline kopyasi ve tekrar kullanilan cikti tamponu
+struct WorkerContext {
+    std::unique_ptr<FilterPipeline> pipeline;
+    std::unique_ptr<Image> output;
+};
+
+// process(indeks, isci baglami, sonuc); istisnalar ogenin hatasi olur
+using ItemFunction = std::function<void(size_t, WorkerContext&, BatchItemResult&)>;
+
+BatchReport runBatch(size_t count, const FilterPipeline& pipeline, const BatchOptions& options,
+                     const ItemFunction& process) {
+    BatchReport report;
+    report.items.resize(count);
+    if (count == 0) {
+        return report;
+    }
+
+    ThreadPool& pool = ThreadPool::global();
+    size_t workers = pool.getThreadCount();
+    if (options.concurrency > 0) {
+        workers = std::min(workers, options.concurrency);
+    }
+    workers = std::min(workers, count);
+
+    std::vector<WorkQueue> queues(workers);
+    for (size_t w = 0; w < workers; ++w) {
+        queues[w].assign(count * w / workers, count * (w + 1) / workers);
+    }
+
+    const auto start = Clock::now();
+    pool.parallelFor(0, static_cast<int>(workers), 1, [&](int worker_begin, int worker_end) {
+        for (int worker = worker_begin; worker < worker_end; ++worker) {
+            WorkerContext context{pipeline.clone(), nullptr};
+            WorkQueue& own = queues[worker];
+            for (;;) {
+                size_t index = 0;
+                if (!own.pop(index)) {
+                    bool stolen = false;
+                    for (size_t k = 1; k < workers && !stolen; ++k) {
+                        stolen = queues[(worker + k) % workers].stealInto(own);
+                    }
+                    if (!stolen) {
+                        break;
+                    }
+                    continue;
+                }
+
+                BatchItemResult& item = report.items[index];
+                item.index = index;
+                const auto item_start = Clock::now();
+                try {
+                    process(index, context, item);
+                    item.success = true;
+                } catch (const std::exception& error) {
+                    item.success = false;
+                    item.error = error.what();
+                }
+                item.latency_ms = elapsedMs(item_start);
+                if (options.on_item) {
+                    options.on_item(item);
+                }
+            }
+        }
+    });
+    report.wall_ms = elapsedMs(start);
+
+    for (const auto& item : report.items) {
+        if (item.success) {
+            ++report.succeeded;
+        } else {
+            ++report.failed;
+        }
+    }
+    return report;
+}
+
+} // namespace
+
+double BatchReport::imagesPerSecond() const {
+    return wall_ms > 0.0 ? succeeded * 1000.0 / wall_ms : 0.0;
+}
+
+double BatchReport::megapixelsPerSecond() const {
+    double pixels = 0.0;
+    for (const auto& item : items) {
+        if (item.success) {
+            pixels += static_cast<double>(item.width) * item.height;
+        }
+    }
+    return wall_ms > 0.0 ? pixels / 1e6 * 1000.0 / wall_ms : 0.0;
+}
+
+double BatchReport::latencyPercentile(double percentile) const {
+    std::vector<double> latencies;
+    for (const auto& item : items) {
+        if (item.success) {
+            latencies.push_back(item.latency_ms);
+        }
+    }
+    if (latencies.empty()) {
+        return 0.0;
+    }
+    std::sort(latencies.begin(), latencies.end());
+    const double clamped = std::min(100.0, std::max(0.0, percentile));
+    const size_t rank = static_cast<size_t>(std::ceil(clamped / 100.0 * latencies.size()));
+    return latencies[std::max<size_t>(rank, 1) - 1];
+}
+
+BatchReport processBatch(const std::vector<std::string>& files, const FilterPipeline& pipeline,
+                         const BatchOptions& options) {
+    std::vector<std::string> conflicts(files.size());
+    if (!options.output_directory.empty()) {
+        std::filesystem::create_directories(options.output_directory);
+        conflicts = findOutputConflicts(files, options);
+    }
+
+    return runBatch(files.size(), pipeline, options,
+                    [&](size_t index, WorkerContext& context, BatchItemResult& item) {
+        item.name = files[index];
+        if (!conflicts[index].empty()) {
+            throw std::runtime_error(conflicts[index]);
+        }
+
+        auto input = loadImageFile(files[index]);
+        if (!input) {
+            throw std::runtime_error("Dosya okunamadi");
+        }
+        item.width = input->getWidth();
+        item.height = input->getHeight();
+
+        // Ayni boyutlu dosyalarda plan ve cikti tamponu tekrar kullanilir
+        if (!context.output) {
+            context.output = std::make_unique<Image>(1, 1, 1, Image::Uninitialized);
+        }
+        context.pipeline->apply(*input, *context.output);
+
+        if (!options.output_directory.empty()) {
+            const std::filesystem::path target = outputBase(files[index], options).string() +
+                (context.output->getChannels() == 3 ? ".ppm" : ".pgm");
+            item.output_path = target.string();
+            if (!context.output->save(item.output_path)) {
+                throw std::runtime_error("Dosya yazilamadi: " + item.output_path);
+            }
+        }
+    });
+}
+
+BatchReport processBatch(const std::vector<const Image*>& images, const FilterPipeline& pipeline,
+                         const BatchOptions& options) {
+    return runBatch(images.size(), pipeline, options,
+                    [&](size_t index, WorkerContext& context, BatchItemResult& item) {
+        item.name = "#" + std::to_string(index);
+        if (!images[index] || images[index]->empty()) {
+            throw std::invalid_argument("Goruntu bos");
+        }
+        item.width = images[index]->getWidth();
+        item.height = images[index]->getHeight();
+        item.output = context.pipeline->apply(*images[index]);
+    });
+}
+
+std::vector<std::string> listImageFiles(const std::string& directory) {
+    if (!std::filesystem::is_directory(directory)) {
+        throw std::invalid_argument("Dizin bulunamadi: " + directory);
+    }
+    std::vector<std::string> files;
+    for (const auto& entry : std::filesystem::directory_iterator(directory)) {
+        if (!entry.is_regular_file()) {
+            continue;
+        }
+        const std::string extension = lowerExtension(entry.path());
+        if (extension == ".pgm" || extension == ".ppm" || extension == ".jpg" || extension == ".jpeg") {
+            files.push_back(entry.path().string());
+        }
+    }
+    std::sort(files.begin(), files.end());
+    return files;
+}
+
+} // namespace GorselIsleme
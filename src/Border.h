@@ -0,0 +1,38 @@
+#pragma once
+#include "Filter.h"
+
+// Dahili kenar modu yardimcilari. Filtreler ic bolgeyi kontrolsuz dongulerle
+// isler; yalnizca kenara degen tap'ler bu eslemeden gecer.
+
+namespace GorselIsleme {
+
+// Goruntu disindaki koordinati [0, length) araligina esler. Constant ve
+// Renormalize modlarinda karsilik gelen piksel yoktur, -1 doner. Yaricap
+// goruntuden buyuk olsa da (coklu yansima/sarma) gecerlidir.
+inline int borderIndex(int index, int length, Filter::BorderMode mode) {
+    if (index >= 0 && index < length) {
+        return index;
+    }
+    switch (mode) {
+    case Filter::Clamp:
+        return index < 0 ? 0 : length - 1;
+    case Filter::Reflect: {
+        if (length == 1) {
+            return 0;
+        }
+        const int period = 2 * (length - 1);
+        index %= period;
+        if (index < 0) {
+            index += period;
+        }
+        return index < length ? index : period - index;
+    }
+    case Filter::Wrap:
+        index %= length;
+        return index < 0 ? index + length : index;
+    default:
+        return -1;
+    }
+}
+
+} // namespace GorselIsleme
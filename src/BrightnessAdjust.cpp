@@ -9,22 +9,7 @@ BrightnessAdjust::BrightnessAdjust(double brightness_factor)
     if (brightness_factor < 0) {
         throw std::invalid_argument("Parlaklik faktoru negatif olamaz");
     }
-}
-
-std::unique_ptr<Image> BrightnessAdjust::apply(const Image& input) const {
-    auto output = std::make_unique<Image>(input.getWidth(), input.getHeight(), input.getChannels());
-    
-    for (int y = 0; y < input.getHeight(); ++y) {
-        for (int x = 0; x < input.getWidth(); ++x) {
-            for (int channel = 0; channel < input.getChannels(); ++channel) {
-                double new_value = input.at(x, y, channel) * brightness_factor_;
-                output->at(x, y, channel) = static_cast<Image::Pixel>(
-                    std::min(255.0, std::max(0.0, new_value)));
-            }
-        }
-    }
-    
-    return output;
+    updateLut();
 }
 
 std::unique_ptr<Filter> BrightnessAdjust::clone() const {
@@ -36,6 +21,14 @@ void BrightnessAdjust::setBrightnessFactor(double factor) {
         throw std::invalid_argument("Parlaklik faktoru negatif olamaz");
     }
     brightness_factor_ = factor;
+    updateLut();
+}
+
+void BrightnessAdjust::updateLut() {
+    for (int v = 0; v < 256; ++v) {
+        double new_value = v * brightness_factor_;
+        lut_[v] = static_cast<Image::Pixel>(std::min(255.0, std::max(0.0, new_value)));
+    }
 }
 
-} // namespace GorselIsleme
\ No newline at end of file
+} // namespace GorselIsleme
@@ -0,0 +1,138 @@
+#include "BufferPool.h"
+#include "TraceCounters.h"
+#include <algorithm>
+
+namespace GorselIsleme {
+
+namespace {
+
+void* alignedNew(size_t bytes) {
+    return ::operator new(bytes, std::align_val_t(BufferPool::kAlignment));
+}
+
+void alignedDelete(void* pointer) {
+    ::operator delete(pointer, std::align_val_t(BufferPool::kAlignment));
+}
+
+} // namespace
+
+BufferPool::~BufferPool() {
+    releaseAll();
+}
+
+void BufferPool::setEnabled(bool enabled) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    enabled_ = enabled;
+    if (!enabled) {
+        releaseAll();
+    }
+}
+
+bool BufferPool::isEnabled() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return enabled_;
+}
+
+void BufferPool::setCapacity(size_t bytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    capacity_ = bytes;
+    // Yeni sinira inene kadar en buyuk kovalardan birak
+    while (stats_.retained_bytes > capacity_ && !free_lists_.empty()) {
+        auto last = std::prev(free_lists_.end());
+        alignedDelete(last->second.back());
+        last->second.pop_back();
+        stats_.retained_bytes -= last->first;
+        --stats_.retained_buffers;
+        if (last->second.empty()) {
+            free_lists_.erase(last);
+        }
+    }
+}
+
+size_t BufferPool::getCapacity() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return capacity_;
+}
+
+void BufferPool::trim() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    releaseAll();
+}
+
+BufferPool::Stats BufferPool::getStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Stats stats = stats_;
+    stats.allocated_bytes = allocated_bytes_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void* BufferPool::allocate(size_t bytes) {
+    const size_t size = bucketSize(bytes);
+    allocated_bytes_.fetch_add(size, std::memory_order_relaxed);
+    TraceCounters::addAllocated(size);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (enabled_) {
+            auto it = free_lists_.find(size);
+            if (it != free_lists_.end() && !it->second.empty()) {
+                void* pointer = it->second.back();
+                it->second.pop_back();
+                stats_.retained_bytes -= size;
+                --stats_.retained_buffers;
+                ++stats_.hits;
+                return pointer;
+            }
+            ++stats_.misses;
+        }
+    }
+    return alignedNew(size);
+}
+
+void BufferPool::deallocate(void* pointer, size_t bytes) noexcept {
+    if (!pointer) {
+        return;
+    }
+    const size_t size = bucketSize(bytes);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (enabled_ && stats_.retained_bytes + size <= capacity_) {
+            try {
+                // Bos listeler silinmez; kararli durumda kayit ayirma yapmaz
+                free_lists_[size].push_back(pointer);
+                stats_.retained_bytes += size;
+                ++stats_.retained_buffers;
+                return;
+            } catch (const std::bad_alloc&) {
+            }
+        }
+    }
+    alignedDelete(pointer);
+}
+
+size_t BufferPool::bucketSize(size_t bytes) {
+    size_t size = std::max(bytes, kAlignment);
+    size_t octave = 1;
+    while (octave <= size / 2) {
+        octave <<= 1;
+    }
+    const size_t step = std::max(kAlignment, octave / 8);
+    return (size + step - 1) / step * step;
+}
+
+BufferPool& BufferPool::global() {
+    static BufferPool* pool = new BufferPool();
+    return *pool;
+}
+
+void BufferPool::releaseAll() {
+    for (auto& entry : free_lists_) {
+        for (void* pointer : entry.second) {
+            alignedDelete(pointer);
+        }
+        entry.second.clear();
+    }
+    stats_.retained_bytes = 0;
+    stats_.retained_buffers = 0;
+}
+
+} // namespace GorselIsleme
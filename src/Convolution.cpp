@@ -0,0 +1,595 @@
+#include "Convolution.h"
+#include "Border.h"
+#include "Fft.h"
+#include "Hash.h"
+#include "Scratch.h"
+#include "Simd.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <stdexcept>
+
+namespace GorselIsleme {
+
+namespace {
+
+// Direct ve Separable yollari bantlari bu kadar cikti satirlik seritlerle
+// isler; serit tamponlari onbellekte kalir
+constexpr int kStripRows = 32;
+
+// Separable: atilan tekil degerlerin en kotu durum cikti hatasi (LSB)
+constexpr double kSeparableErrorBound = 0.25;
+
+// Auto maliyet modeli, birim = direct yolda piksel basina bir tap. Toplama
+// ve yazma (kPixelCost) direct ve separable icin ortaktir; FFT kelebegi
+// karmasik ve kisa asamalarda skaler oldugundan pahalidir. Katsayilar
+// 1024x768x3 goruntude olculen surelerden alinmistir.
+constexpr double kPixelCost = 14.0;
+constexpr double kSeparableTapCost = 1.3;
+constexpr double kButterflyCost = 12.0;
+constexpr double kFftPointCost = 24.0;
+constexpr int kMaxFftSize = 512;
+
+// ScratchBuffer etiketleri
+struct StripTag;
+struct PassTag;
+struct AccumulatorTag;
+struct PlaneTag;
+struct SpectrumTag;
+
+// Toplama sirasinda goruntu disi orneklerin kaynagi. Renormalize disaridaki
+// tap'leri sifirla toplar; olcek sonradan renormalizeRow ile uygulanir.
+struct GatherBorder {
+    Filter::BorderMode mode;
+    float value;
+};
+
+GatherBorder gatherBorder(Filter::BorderMode mode, Image::Pixel value) {
+    if (mode == Filter::Renormalize) {
+        return {Filter::Constant, 0.0f};
+    }
+    return {mode, static_cast<float>(value)};
+}
+
+// Girdinin bir kanalindan [x_begin, x_begin + count) sutunlarini float'a
+// toplar. Ic bolge kontrolsuz kopyalanir; yalnizca kenar disindaki sutun
+// ve satirlar kenar moduna gore eslenir.
+void gatherRow(const ConstImageView& input, int y, int channel, int x_begin, int count, float* dst,
+               const GatherBorder& border) {
+    const int width = input.getWidth();
+    const int channels = input.getChannels();
+    const int source_row = borderIndex(y, input.getHeight(), border.mode);
+    if (source_row < 0) {
+        std::fill(dst, dst + count, border.value);
+        return;
+    }
+    const Image::Pixel* row = input.row(source_row) + channel;
+
+    const auto sample = [&](int i) {
+        const int column = borderIndex(x_begin + i, width, border.mode);
+        return column < 0 ? border.value : static_cast<float>(row[static_cast<ptrdiff_t>(column) * channels]);
+    };
+    const int left = std::min(count, std::max(0, -x_begin));
+    const int inner_end = std::max(left, std::min(count, width - x_begin));
+    for (int i = 0; i < left; ++i) {
+        dst[i] = sample(i);
+    }
+    const Image::Pixel* src = row + static_cast<ptrdiff_t>(x_begin) * channels;
+    for (int i = left; i < inner_end; ++i) {
+        dst[i] = src[static_cast<ptrdiff_t>(i) * channels];
+    }
+    for (int i = inner_end; i < count; ++i) {
+        dst[i] = sample(i);
+    }
+}
+
+void storeRow(const float* values, int count, Image::Pixel* dst, int channels) {
+    for (int x = 0; x < count; ++x) {
+        const float value = std::min(std::max(values[x], 0.0f), 255.0f);
+        dst[static_cast<ptrdiff_t>(x) * channels] = static_cast<Image::Pixel>(value + 0.5f);
+    }
+}
+
+// acc[x] += sum_j sum_i kernel[j][i] * strip[j][x + i]
+GORSEL_INLINE void directRow(const float* strip, size_t stride, const float* kernel, int kernel_width,
+                             int kernel_height, float* acc, int count) {
+    std::fill(acc, acc + count, 0.0f);
+    for (int j = 0; j < kernel_height; ++j) {
+        for (int i = 0; i < kernel_width; ++i) {
+            const float w = kernel[j * kernel_width + i];
+            if (w == 0.0f) {
+                continue;
+            }
+            const float* src = strip + j * stride + i;
+            for (int x = 0; x < count; ++x) {
+                acc[x] += w * src[x];
+            }
+        }
+    }
+}
+
+// dst[x] = sum_i taps[i] * src[x + i]
+GORSEL_INLINE void rowPass(const float* src, const float* taps, int tap_count, float* dst, int count) {
+    std::fill(dst, dst + count, 0.0f);
+    for (int i = 0; i < tap_count; ++i) {
+        const float w = taps[i];
+        for (int x = 0; x < count; ++x) {
+            dst[x] += w * src[x + i];
+        }
+    }
+}
+
+// acc[x] += sum_j taps[j] * src[j][x]
+GORSEL_INLINE void columnPass(const float* src, size_t stride, const float* taps, int tap_count, float* acc,
+                              int count) {
+    for (int j = 0; j < tap_count; ++j) {
+        const float w = taps[j];
+        const float* row = src + j * stride;
+        for (int x = 0; x < count; ++x) {
+            acc[x] += w * row[x];
+        }
+    }
+}
+
+#if GORSEL_X86_SIMD
+GORSEL_TARGET("avx2,fma")
+void directRowAvx2(const float* strip, size_t stride, const float* kernel, int kernel_width, int kernel_height,
+                   float* acc, int count) {
+    directRow(strip, stride, kernel, kernel_width, kernel_height, acc, count);
+}
+
+GORSEL_TARGET("avx2,fma")
+void rowPassAvx2(const float* src, const float* taps, int tap_count, float* dst, int count) {
+    rowPass(src, taps, tap_count, dst, count);
+}
+
+GORSEL_TARGET("avx2,fma")
+void columnPassAvx2(const float* src, size_t stride, const float* taps, int tap_count, float* acc, int count) {
+    columnPass(src, stride, taps, tap_count, acc, count);
+}
+#endif
+
+// Tek boyutlu yollarin CPU'ya gore secimi
+struct Kernels1D {
+    decltype(&directRow) direct = &directRow;
+    decltype(&rowPass) row = &rowPass;
+    decltype(&columnPass) column = &columnPass;
+
+    Kernels1D() {
+#if GORSEL_X86_SIMD
+        if (simd::hasAvx2()) {
+            direct = &directRowAvx2;
+            row = &rowPassAvx2;
+            column = &columnPassAvx2;
+        }
+#endif
+    }
+};
+
+const Kernels1D& kernels1D() {
+    static const Kernels1D instance;
+    return instance;
+}
+
+int log2Of(int value) {
+    int bits = 0;
+    while ((1 << bits) < value) {
+        ++bits;
+    }
+    return bits;
+}
+
+} // namespace
+
+Convolution::Convolution(std::vector<float> kernel, int width, int height, Strategy strategy)
+    : kernel_(std::move(kernel)), width_(width), height_(height), strategy_(strategy) {
+    if (width <= 0 || height <= 0 || width % 2 == 0 || height % 2 == 0) {
+        throw std::invalid_argument("Kernel boyutlari pozitif tek sayi olmali");
+    }
+    if (kernel_.size() != static_cast<size_t>(width) * height) {
+        throw std::invalid_argument("Kernel eleman sayisi boyutlarla uyusmuyor");
+    }
+    nonzero_taps_ = 0;
+    kernel_sum_ = 0.0;
+    kernel_abs_sum_ = 0.0;
+    kernel_prefix_.assign(static_cast<size_t>(width + 1) * (height + 1), 0.0);
+    for (int j = 0; j < height; ++j) {
+        for (int i = 0; i < width; ++i) {
+            const float value = kernel_[j * width + i];
+            if (!std::isfinite(value)) {
+                throw std::invalid_argument("Kernel sonlu olmali");
+            }
+            nonzero_taps_ += (value != 0.0f);
+            kernel_sum_ += value;
+            kernel_abs_sum_ += std::abs(value);
+            kernel_prefix_[(j + 1) * (width + 1) + i + 1] = value + kernel_prefix_[j * (width + 1) + i + 1] +
+                                                             kernel_prefix_[(j + 1) * (width + 1) + i] -
+                                                             kernel_prefix_[j * (width + 1) + i];
+        }
+    }
+    decompose();
+}
+
+void Convolution::decompose() {
+    // Tek tarafli Jacobi SVD (double): U = K'nin sutunlari karsilikli dik
+    // olana kadar dondurulur, V donusleri biriktirir. K = sum s_t u_t v_t^T.
+    const int m = height_;
+    const int n = width_;
+    std::vector<double> u(kernel_.begin(), kernel_.end()); // m x n, satir oncelikli
+    std::vector<double> v(static_cast<size_t>(n) * n, 0.0);
+    for (int i = 0; i < n; ++i) {
+        v[i * n + i] = 1.0;
+    }
+
+    for (int sweep = 0; sweep < 60; ++sweep) {
+        bool rotated = false;
+        for (int p = 0; p < n - 1; ++p) {
+            for (int q = p + 1; q < n; ++q) {
+                double alpha = 0.0, beta = 0.0, gamma = 0.0;
+                for (int r = 0; r < m; ++r) {
+                    const double up = u[r * n + p];
+                    const double uq = u[r * n + q];
+                    alpha += up * up;
+                    beta += uq * uq;
+                    gamma += up * uq;
+                }
+                if (std::abs(gamma) <= 1e-15 * std::sqrt(alpha * beta) || gamma == 0.0) {
+                    continue;
+                }
+                rotated = true;
+                const double zeta = (beta - alpha) / (2.0 * gamma);
+                const double t = (zeta >= 0.0 ? 1.0 : -1.0) / (std::abs(zeta) + std::sqrt(1.0 + zeta * zeta));
+                const double c = 1.0 / std::sqrt(1.0 + t * t);
+                const double s = c * t;
+                for (int r = 0; r < m; ++r) {
+                    const double up = u[r * n + p];
+                    const double uq = u[r * n + q];
+                    u[r * n + p] = c * up - s * uq;
+                    u[r * n + q] = s * up + c * uq;
+                }
+                for (int r = 0; r < n; ++r) {
+                    const double vp = v[r * n + p];
+                    const double vq = v[r * n + q];
+                    v[r * n + p] = c * vp - s * vq;
+                    v[r * n + q] = s * vp + c * vq;
+                }
+            }
+        }
+        if (!rotated) {
+            break;
+        }
+    }
+
+    std::vector<std::pair<double, int>> singular(n);
+    for (int i = 0; i < n; ++i) {
+        double norm = 0.0;
+        for (int r = 0; r < m; ++r) {
+            norm += u[r * n + i] * u[r * n + i];
+        }
+        singular[i] = {std::sqrt(norm), i};
+    }
+    std::sort(singular.begin(), singular.end(), std::greater<std::pair<double, int>>());
+
+    // Atilan terimlerin cikti hatasi <= 255 * sqrt(m n) * sum(s_t); sinirin
+    // altinda kalan en kisa onek tutulur
+    const double limit = kSeparableErrorBound / (255.0 * std::sqrt(static_cast<double>(m) * n));
+    size_t rank = singular.size();
+    double discarded = 0.0;
+    while (rank > 0 && discarded + singular[rank - 1].first <= limit) {
+        discarded += singular[rank - 1].first;
+        --rank;
+    }
+
+    rows_.assign(rank, std::vector<float>(n));
+    columns_.assign(rank, std::vector<float>(m));
+    for (size_t t = 0; t < rank; ++t) {
+        // u_t * s_t sutun vektoru, u matrisinde zaten olceklenmis halde
+        const int index = singular[t].second;
+        for (int r = 0; r < m; ++r) {
+            columns_[t][r] = static_cast<float>(u[r * n + index]);
+        }
+        for (int i = 0; i < n; ++i) {
+            rows_[t][i] = static_cast<float>(v[i * n + index]);
+        }
+    }
+}
+
+void Convolution::setBorderMode(BorderMode mode, Image::Pixel value) {
+    border_mode_ = mode;
+    border_value_ = value;
+}
+
+void Convolution::renormalizeRow(float* values, int image_width, int image_height, int y, int x_begin,
+                                 int count) const {
+    // Disaridaki tap'ler sifirla toplandi; kenara r'den yakin piksellerde
+    // sonuc kernel toplami / goruntu icindeki agirlik toplami ile olceklenir.
+    // Gecerli agirliklar dikdortgendir, toplamlari onek tablosundan O(1).
+    if (border_mode_ != Renormalize) {
+        return;
+    }
+    const int radius_x = width_ / 2;
+    const int radius_y = height_ / 2;
+    const int j0 = std::max(0, radius_y - y);
+    const int j1 = std::min(height_, image_height - y + radius_y);
+    const bool border_row = j0 != 0 || j1 != height_;
+    const auto weight = [&](int i0, int i1) {
+        const size_t stride = width_ + 1;
+        return kernel_prefix_[j1 * stride + i1] - kernel_prefix_[j0 * stride + i1] -
+               kernel_prefix_[j1 * stride + i0] + kernel_prefix_[j0 * stride + i0];
+    };
+    const auto rescale = [&](int x) {
+        const double valid = weight(std::max(0, radius_x - x), std::min(width_, image_width - x + radius_x));
+        // Sifir toplamli (turev) kernellerde olcek anlamsizdir; sifir dolgu kalir
+        if (std::abs(valid) > 1e-6 * kernel_abs_sum_ && std::abs(kernel_sum_) > 1e-6 * kernel_abs_sum_) {
+            values[x - x_begin] = static_cast<float>(values[x - x_begin] * (kernel_sum_ / valid));
+        }
+    };
+
+    const int end = x_begin + count;
+    if (border_row) {
+        for (int x = x_begin; x < end; ++x) {
+            rescale(x);
+        }
+        return;
+    }
+    const int left_end = std::min(end, std::max(x_begin, radius_x));
+    for (int x = x_begin; x < left_end; ++x) {
+        rescale(x);
+    }
+    for (int x = std::max(left_end, image_width - radius_x); x < end; ++x) {
+        rescale(x);
+    }
+}
+
+int Convolution::getRadius() const {
+    return std::max(width_, height_) / 2;
+}
+
+std::unique_ptr<Filter> Convolution::clone() const {
+    return std::make_unique<Convolution>(*this);
+}
+
+std::string Convolution::getFingerprint() const {
+    char buffer[96];
+    std::snprintf(buffer, sizeof(buffer), "Convolution:%dx%d:%016llx:%d:%d:%d", width_, height_,
+                  static_cast<unsigned long long>(hash::bytes(kernel_.data(), kernel_.size() * sizeof(float))),
+                  static_cast<int>(strategy_), static_cast<int>(border_mode_), static_cast<int>(border_value_));
+    return buffer;
+}
+
+int Convolution::selectFftSize(int image_width, int image_height, int channels, double* cost) const {
+    // 2D donusum N^2 log2(N) kelebek; ileri + geri, iki is (kanal/karo) bir
+    // karmasik donusumde birlikte tasinir. Karo basina gecerli cikti
+    // (N - w + 1) x (N - h + 1).
+    int best_size = 0;
+    double best_cost = 0.0;
+    const int minimum = 1 << log2Of(std::max(width_, height_) + 1);
+    const int useful = 1 << log2Of(std::max(image_width + width_, image_height + height_));
+    for (int size = minimum; size <= std::max(minimum, std::min(kMaxFftSize, useful)); size *= 2) {
+        const double tiles = std::ceil(static_cast<double>(image_width) / (size - width_ + 1)) *
+                             std::ceil(static_cast<double>(image_height) / (size - height_ + 1));
+        const double pairs = std::ceil(tiles * channels / 2.0);
+        const double points = static_cast<double>(size) * size;
+        const double total = pairs * (kButterflyCost * 2.0 * points * log2Of(size) + kFftPointCost * points);
+        if (best_size == 0 || total < best_cost) {
+            best_size = size;
+            best_cost = total;
+        }
+    }
+    if (cost) {
+        *cost = best_cost;
+    }
+    return best_size;
+}
+
+Convolution::Strategy Convolution::selectStrategy(int image_width, int image_height, int channels) const {
+    if (strategy_ != Auto) {
+        return strategy_;
+    }
+    const double pixels = static_cast<double>(image_width) * image_height * channels;
+    const double direct = pixels * (kPixelCost + static_cast<double>(nonzero_taps_));
+    const double separable =
+        pixels * (kPixelCost + kSeparableTapCost * static_cast<double>(rows_.size()) * (width_ + height_));
+    double fft = 0.0;
+    selectFftSize(image_width, image_height, channels, &fft);
+
+    if (direct <= separable && direct <= fft) {
+        return Direct;
+    }
+    return separable <= fft ? Separable : Fft;
+}
+
+void Convolution::apply(const ConstImageView& input, const ImageView& output) const {
+    checkViews(input, output);
+
+    switch (selectStrategy(input.getWidth(), input.getHeight(), input.getChannels())) {
+    case Separable:
+        applySeparable(input, output);
+        break;
+    case Fft:
+        applyFft(input, output, selectFftSize(input.getWidth(), input.getHeight(), input.getChannels(), nullptr));
+        break;
+    default:
+        applyDirect(input, output);
+        break;
+    }
+}
+
+void Convolution::applyDirect(const ConstImageView& input, const ImageView& output) const {
+    const int width = input.getWidth();
+    const int height = input.getHeight();
+    const int channels = input.getChannels();
+    const int radius_x = width_ / 2;
+    const int radius_y = height_ / 2;
+    const int padded_width = width + width_ - 1;
+    const Kernels1D& kernels = kernels1D();
+    const GatherBorder border = gatherBorder(border_mode_, border_value_);
+
+    ThreadPool::global().parallelRows(height, input.getRowSize() * std::max<size_t>(nonzero_taps_, 1),
+                                      [&](int band_begin, int band_end) {
+        ScratchBuffer<float, StripTag> strip(static_cast<size_t>(kStripRows + height_ - 1) * padded_width);
+        ScratchBuffer<float, AccumulatorTag> acc(width);
+        for (int y_begin = band_begin; y_begin < band_end; y_begin += kStripRows) {
+            const int rows = std::min(kStripRows, band_end - y_begin);
+            for (int channel = 0; channel < channels; ++channel) {
+                for (int r = 0; r < rows + height_ - 1; ++r) {
+                    gatherRow(input, y_begin + r - radius_y, channel, -radius_x, padded_width,
+                              strip.data() + static_cast<size_t>(r) * padded_width, border);
+                }
+                for (int y = 0; y < rows; ++y) {
+                    kernels.direct(strip.data() + static_cast<size_t>(y) * padded_width, padded_width,
+                                   kernel_.data(), width_, height_, acc.data(), width);
+                    renormalizeRow(acc.data(), width, height, y_begin + y, 0, width);
+                    storeRow(acc.data(), width, output.row(y_begin + y) + channel, channels);
+                }
+            }
+        }
+    });
+}
+
+void Convolution::applySeparable(const ConstImageView& input, const ImageView& output) const {
+    const int width = input.getWidth();
+    const int height = input.getHeight();
+    const int channels = input.getChannels();
+    const int radius_x = width_ / 2;
+    const int radius_y = height_ / 2;
+    const int padded_width = width + width_ - 1;
+    const Kernels1D& kernels = kernels1D();
+    const size_t terms = rows_.size();
+    const GatherBorder border = gatherBorder(border_mode_, border_value_);
+
+    ThreadPool::global().parallelRows(height, input.getRowSize() * std::max<size_t>(terms * (width_ + height_), 1),
+                                      [&](int band_begin, int band_end) {
+        const int strip_rows = kStripRows + height_ - 1;
+        ScratchBuffer<float, StripTag> strip(static_cast<size_t>(strip_rows) * padded_width);
+        ScratchBuffer<float, PassTag> pass(static_cast<size_t>(strip_rows) * width);
+        ScratchBuffer<float, AccumulatorTag> acc(static_cast<size_t>(kStripRows) * width);
+        for (int y_begin = band_begin; y_begin < band_end; y_begin += kStripRows) {
+            const int rows = std::min(kStripRows, band_end - y_begin);
+            for (int channel = 0; channel < channels; ++channel) {
+                for (int r = 0; r < rows + height_ - 1; ++r) {
+                    gatherRow(input, y_begin + r - radius_y, channel, -radius_x, padded_width,
+                              strip.data() + static_cast<size_t>(r) * padded_width, border);
+                }
+                std::fill(acc.data(), acc.data() + static_cast<size_t>(rows) * width, 0.0f);
+                for (size_t t = 0; t < terms; ++t) {
+                    for (int r = 0; r < rows + height_ - 1; ++r) {
+                        kernels.row(strip.data() + static_cast<size_t>(r) * padded_width, rows_[t].data(), width_,
+                                    pass.data() + static_cast<size_t>(r) * width, width);
+                    }
+                    for (int y = 0; y < rows; ++y) {
+                        kernels.column(pass.data() + static_cast<size_t>(y) * width, width, columns_[t].data(),
+                                       height_, acc.data() + static_cast<size_t>(y) * width, width);
+                    }
+                }
+                for (int y = 0; y < rows; ++y) {
+                    float* values = acc.data() + static_cast<size_t>(y) * width;
+                    renormalizeRow(values, width, height, y_begin + y, 0, width);
+                    storeRow(values, width, output.row(y_begin + y) + channel, channels);
+                }
+            }
+        }
+    });
+}
+
+void Convolution::applyFft(const ConstImageView& input, const ImageView& output, int fft_size) const {
+    const int width = input.getWidth();
+    const int height = input.getHeight();
+    const int channels = input.getChannels();
+    const int radius_x = width_ / 2;
+    const int radius_y = height_ / 2;
+    const int n = fft_size;
+    const size_t points = static_cast<size_t>(n) * n;
+    const int block_width = n - width_ + 1;
+    const int block_height = n - height_ + 1;
+    const int tiles_x = (width + block_width - 1) / block_width;
+    const int tiles_y = (height + block_height - 1) / block_height;
+    const int jobs = tiles_x * tiles_y * channels;
+    const FftPlan plan(n);
+    const GatherBorder border = gatherBorder(border_mode_, border_value_);
+
+    const auto forward2D = [&](float* re, float* im) {
+        for (int y = 0; y < n; ++y) {
+            plan.transform(re + static_cast<size_t>(y) * n, im + static_cast<size_t>(y) * n, false);
+        }
+        plan.transformColumns(re, im, n, false);
+    };
+
+    // Kernel spektrumu: h[-j mod N][-i mod N] = k[j][i], 1/N^2 olcegi dahil.
+    // Karo girdisi A(m) = girdi(karo_basi - r + m) ile dairesel konvolusyonun
+    // [0, N - k] araligi korelasyonun kendisidir (overlap-save).
+    ScratchBuffer<float, SpectrumTag> spectrum(2 * points);
+    float* spectrum_re = spectrum.data();
+    float* spectrum_im = spectrum.data() + points;
+    std::fill(spectrum_re, spectrum_re + 2 * points, 0.0f);
+    const float scale = 1.0f / static_cast<float>(points);
+    for (int j = 0; j < height_; ++j) {
+        for (int i = 0; i < width_; ++i) {
+            spectrum_re[static_cast<size_t>((n - j) % n) * n + (n - i) % n] = kernel_[j * width_ + i] * scale;
+        }
+    }
+    forward2D(spectrum_re, spectrum_im);
+
+    // Is = (karo, kanal); iki is tek karmasik donusumde gercek ve sanal kisim
+    // olarak tasinir (kernel gercek oldugundan sonuclar karismaz)
+    const auto gather = [&](int job, float* plane) {
+        const int tile = job / channels;
+        const int channel = job % channels;
+        const int x0 = (tile % tiles_x) * block_width - radius_x;
+        const int y0 = (tile / tiles_x) * block_height - radius_y;
+        for (int y = 0; y < n; ++y) {
+            gatherRow(input, y0 + y, channel, x0, n, plane + static_cast<size_t>(y) * n, border);
+        }
+    };
+    const auto scatter = [&](int job, float* plane) {
+        const int tile = job / channels;
+        const int channel = job % channels;
+        const int x0 = (tile % tiles_x) * block_width;
+        const int y0 = (tile / tiles_x) * block_height;
+        const int columns = std::min(block_width, width - x0);
+        const int rows = std::min(block_height, height - y0);
+        for (int y = 0; y < rows; ++y) {
+            renormalizeRow(plane + static_cast<size_t>(y) * n, width, height, y0 + y, x0, columns);
+            storeRow(plane + static_cast<size_t>(y) * n, columns,
+                     output.row(y0 + y) + static_cast<ptrdiff_t>(x0) * channels + channel, channels);
+        }
+    };
+
+    const int pairs = (jobs + 1) / 2;
+    ThreadPool::global().parallelFor(0, pairs, 1, [&](int pair_begin, int pair_end) {
+        ScratchBuffer<float, PlaneTag> planes(2 * points);
+        float* re = planes.data();
+        float* im = planes.data() + points;
+        for (int pair = pair_begin; pair < pair_end; ++pair) {
+            const int first = 2 * pair;
+            const bool has_second = first + 1 < jobs;
+            gather(first, re);
+            if (has_second) {
+                gather(first + 1, im);
+            } else {
+                std::fill(im, im + points, 0.0f);
+            }
+
+            forward2D(re, im);
+            for (size_t i = 0; i < points; ++i) {
+                const float a = re[i];
+                const float b = im[i];
+                re[i] = a * spectrum_re[i] - b * spectrum_im[i];
+                im[i] = a * spectrum_im[i] + b * spectrum_re[i];
+            }
+            // Ters donusum: sutunlar, sonra yalnizca gecerli satirlar
+            plan.transformColumns(re, im, n, true);
+            for (int y = 0; y < block_height; ++y) {
+                plan.transform(re + static_cast<size_t>(y) * n, im + static_cast<size_t>(y) * n, true);
+            }
+
+            scatter(first, re);
+            if (has_second) {
+                scatter(first + 1, im);
+            }
+        }
+    });
+}
+
+} // namespace GorselIsleme
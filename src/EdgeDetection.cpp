@@ -1,70 +1,437 @@
 #include "EdgeDetection.h"
+#include "Border.h"
+#include "KernelCore.h"
+#include "Scratch.h"
+#include "Simd.h"
+#include "ThreadPool.h"
 #include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
 #include <algorithm>
 #include <stdexcept>
 
 namespace GorselIsleme {
 
-EdgeDetection::EdgeDetection(Direction direction) : direction_(direction) {
-    initializeSobelKernels();
+namespace {
+
+using kernels::Kernel3x3;
+
+// ScratchBuffer etiketi
+struct GradientTag;
+
+// Satir ici duz indeks: komsu pikselin ayni kanali +-channels uzaklikta
+struct SobelRows {
+    const Image::Pixel* top;
+    const Image::Pixel* middle;
+    const Image::Pixel* bottom;
+    Image::Pixel* output;
+    int step;
+    bool use_gx;
+    bool use_gy;
+    EdgeDetection::Magnitude magnitude;
+};
+
+inline Image::Pixel sobelMagnitude(int gx, int gy, EdgeDetection::Magnitude magnitude) {
+    int value;
+    switch (magnitude) {
+    case EdgeDetection::L1:
+        value = std::abs(gx) + std::abs(gy);
+        break;
+    case EdgeDetection::Max:
+        value = std::max(std::abs(gx), std::abs(gy));
+        break;
+    default:
+        // |gx|, |gy| <= 4080 (Scharr): int32 kare toplami float'a SIMD ile ayni
+        // yuvarlanir; 255'in altindaki sonuclarda karekok tam sayi icin kesin
+        value = static_cast<int>(std::sqrt(static_cast<float>(gx * gx + gy * gy)));
+        break;
+    }
+    return static_cast<Image::Pixel>(std::min(value, 255));
+}
+
+void sobelRowScalar(const SobelRows& rows, size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+        int gx = 0;
+        int gy = 0;
+        if (rows.use_gx) {
+            gx = kernels::response3x3<kernels::kSobelX>(rows.top + i, rows.middle + i, rows.bottom + i, rows.step);
+        }
+        if (rows.use_gy) {
+            gy = kernels::response3x3<kernels::kSobelY>(rows.top + i, rows.middle + i, rows.bottom + i, rows.step);
+        }
+        rows.output[i] = sobelMagnitude(gx, gy, rows.magnitude);
+    }
+}
+
+void magnitudeRowScalar(const int16_t* gx, const int16_t* gy, Image::Pixel* output, size_t begin, size_t end,
+                        EdgeDetection::Magnitude magnitude) {
+    for (size_t i = begin; i < end; ++i) {
+        output[i] = sobelMagnitude(gx[i], gy[i], magnitude);
+    }
+}
+
+#if GORSEL_X86_SIMD
+
+GORSEL_TARGET("sse2")
+inline __m128i loadWiden(const Image::Pixel* p) {
+    return _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)), _mm_setzero_si128());
+}
+
+GORSEL_TARGET("sse2")
+inline __m128i abs16(__m128i v) {
+    return _mm_max_epi16(v, _mm_sub_epi16(_mm_setzero_si128(), v));
+}
+
+GORSEL_TARGET("sse2")
+inline __m128i magnitudeSse2(__m128i gx, __m128i gy, EdgeDetection::Magnitude magnitude) {
+    if (magnitude == EdgeDetection::L1) {
+        return _mm_add_epi16(abs16(gx), abs16(gy));
+    }
+    if (magnitude == EdgeDetection::Max) {
+        return _mm_max_epi16(abs16(gx), abs16(gy));
+    }
+    __m128i lo = _mm_madd_epi16(_mm_unpacklo_epi16(gx, gy), _mm_unpacklo_epi16(gx, gy));
+    __m128i hi = _mm_madd_epi16(_mm_unpackhi_epi16(gx, gy), _mm_unpackhi_epi16(gx, gy));
+    lo = _mm_cvttps_epi32(_mm_sqrt_ps(_mm_cvtepi32_ps(lo)));
+    hi = _mm_cvttps_epi32(_mm_sqrt_ps(_mm_cvtepi32_ps(hi)));
+    return _mm_packs_epi32(lo, hi);
+}
+
+// 8 cikis pikseli; gx, gy int16'da kalir (|g| <= 1020)
+GORSEL_TARGET("sse2")
+size_t sobelRowSse2(const SobelRows& rows, size_t begin, size_t end) {
+    const int s = rows.step;
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = begin;
+    for (; i + 8 <= end; i += 8) {
+        __m128i tl = loadWiden(rows.top + i - s), tc = loadWiden(rows.top + i), tr = loadWiden(rows.top + i + s);
+        __m128i ml = loadWiden(rows.middle + i - s), mr = loadWiden(rows.middle + i + s);
+        __m128i bl = loadWiden(rows.bottom + i - s), bc = loadWiden(rows.bottom + i), br = loadWiden(rows.bottom + i + s);
+
+        __m128i gx = zero;
+        __m128i gy = zero;
+        if (rows.use_gx) {
+            __m128i right = _mm_add_epi16(_mm_add_epi16(tr, br), _mm_slli_epi16(mr, 1));
+            __m128i left = _mm_add_epi16(_mm_add_epi16(tl, bl), _mm_slli_epi16(ml, 1));
+            gx = _mm_sub_epi16(right, left);
+        }
+        if (rows.use_gy) {
+            __m128i bottom = _mm_add_epi16(_mm_add_epi16(bl, br), _mm_slli_epi16(bc, 1));
+            __m128i top = _mm_add_epi16(_mm_add_epi16(tl, tr), _mm_slli_epi16(tc, 1));
+            gy = _mm_sub_epi16(bottom, top);
+        }
+
+        const __m128i result = magnitudeSse2(gx, gy, rows.magnitude);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(rows.output + i), _mm_packus_epi16(result, result));
+    }
+    return i;
+}
+
+GORSEL_TARGET("sse2")
+size_t magnitudeRowSse2(const int16_t* gx, const int16_t* gy, Image::Pixel* output, size_t begin, size_t end,
+                        EdgeDetection::Magnitude magnitude) {
+    size_t i = begin;
+    for (; i + 8 <= end; i += 8) {
+        const __m128i result = magnitudeSse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(gx + i)),
+                                             _mm_loadu_si128(reinterpret_cast<const __m128i*>(gy + i)), magnitude);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(output + i), _mm_packus_epi16(result, result));
+    }
+    return i;
+}
+
+GORSEL_TARGET("avx2")
+inline __m256i loadWiden256(const Image::Pixel* p) {
+    return _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+}
+
+// unpack/pack 128 bitlik seritler icinde kalir; sira packs sonrasi korunur
+GORSEL_TARGET("avx2")
+inline __m256i magnitudeAvx2(__m256i gx, __m256i gy, EdgeDetection::Magnitude magnitude) {
+    if (magnitude == EdgeDetection::L1) {
+        return _mm256_add_epi16(_mm256_abs_epi16(gx), _mm256_abs_epi16(gy));
+    }
+    if (magnitude == EdgeDetection::Max) {
+        return _mm256_max_epi16(_mm256_abs_epi16(gx), _mm256_abs_epi16(gy));
+    }
+    __m256i lo = _mm256_madd_epi16(_mm256_unpacklo_epi16(gx, gy), _mm256_unpacklo_epi16(gx, gy));
+    __m256i hi = _mm256_madd_epi16(_mm256_unpackhi_epi16(gx, gy), _mm256_unpackhi_epi16(gx, gy));
+    lo = _mm256_cvttps_epi32(_mm256_sqrt_ps(_mm256_cvtepi32_ps(lo)));
+    hi = _mm256_cvttps_epi32(_mm256_sqrt_ps(_mm256_cvtepi32_ps(hi)));
+    return _mm256_packs_epi32(lo, hi);
+}
+
+GORSEL_TARGET("avx2")
+inline void storePacked16(Image::Pixel* output, __m256i result) {
+    __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(result, result), 0x08);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output), _mm256_castsi256_si128(packed));
+}
+
+// 16 cikis pikseli
+GORSEL_TARGET("avx2")
+size_t sobelRowAvx2(const SobelRows& rows, size_t begin, size_t end) {
+    const int s = rows.step;
+    const __m256i zero = _mm256_setzero_si256();
+    size_t i = begin;
+    for (; i + 16 <= end; i += 16) {
+        __m256i tl = loadWiden256(rows.top + i - s), tc = loadWiden256(rows.top + i), tr = loadWiden256(rows.top + i + s);
+        __m256i ml = loadWiden256(rows.middle + i - s), mr = loadWiden256(rows.middle + i + s);
+        __m256i bl = loadWiden256(rows.bottom + i - s), bc = loadWiden256(rows.bottom + i), br = loadWiden256(rows.bottom + i + s);
+
+        __m256i gx = zero;
+        __m256i gy = zero;
+        if (rows.use_gx) {
+            __m256i right = _mm256_add_epi16(_mm256_add_epi16(tr, br), _mm256_slli_epi16(mr, 1));
+            __m256i left = _mm256_add_epi16(_mm256_add_epi16(tl, bl), _mm256_slli_epi16(ml, 1));
+            gx = _mm256_sub_epi16(right, left);
+        }
+        if (rows.use_gy) {
+            __m256i bottom = _mm256_add_epi16(_mm256_add_epi16(bl, br), _mm256_slli_epi16(bc, 1));
+            __m256i top = _mm256_add_epi16(_mm256_add_epi16(tl, tr), _mm256_slli_epi16(tc, 1));
+            gy = _mm256_sub_epi16(bottom, top);
+        }
+
+        storePacked16(rows.output + i, magnitudeAvx2(gx, gy, rows.magnitude));
+    }
+    return i;
+}
+
+GORSEL_TARGET("avx2")
+size_t magnitudeRowAvx2(const int16_t* gx, const int16_t* gy, Image::Pixel* output, size_t begin, size_t end,
+                        EdgeDetection::Magnitude magnitude) {
+    size_t i = begin;
+    for (; i + 16 <= end; i += 16) {
+        storePacked16(output + i,
+                      magnitudeAvx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(gx + i)),
+                                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(gy + i)), magnitude));
+    }
+    return i;
 }
 
-std::unique_ptr<Image> EdgeDetection::apply(const Image& input) const {
-    auto output = std::make_unique<Image>(input.getWidth(), input.getHeight(), input.getChannels());
-    
-    for (int y = 1; y < input.getHeight() - 1; ++y) {
-        for (int x = 1; x < input.getWidth() - 1; ++x) {
-            for (int channel = 0; channel < input.getChannels(); ++channel) {
-                double gx = 0.0, gy = 0.0;
-                
-                if (direction_ == Horizontal || direction_ == Both) {
-                    gx = applyConvolution(input, x, y, sobel_x_);
+#endif
+
+void sobelRow(const SobelRows& rows, size_t begin, size_t end) {
+    size_t i = begin;
+#if GORSEL_X86_SIMD
+    if (simd::hasAvx2()) {
+        i = sobelRowAvx2(rows, i, end);
+    }
+    i = sobelRowSse2(rows, i, end);
+#endif
+    sobelRowScalar(rows, i, end);
+}
+
+void magnitudeRow(const int16_t* gx, const int16_t* gy, Image::Pixel* output, size_t begin, size_t end,
+                  EdgeDetection::Magnitude magnitude) {
+    size_t i = begin;
+#if GORSEL_X86_SIMD
+    if (simd::hasAvx2()) {
+        i = magnitudeRowAvx2(gx, gy, output, i, end, magnitude);
+    }
+    i = magnitudeRowSse2(gx, gy, output, i, end, magnitude);
+#endif
+    magnitudeRowScalar(gx, gy, output, i, end, magnitude);
+}
+
+template <const Kernel3x3& KX, const Kernel3x3& KY, int Channels>
+GORSEL_INLINE void gradientRows(const SobelRows& rows, int16_t* gx, int16_t* gy, size_t begin, size_t end) {
+    if (rows.use_gx) {
+        kernels::kernelRow3x3<KX, Channels>(rows.top, rows.middle, rows.bottom, gx, begin, end, rows.step);
+    }
+    if (rows.use_gy) {
+        kernels::kernelRow3x3<KY, Channels>(rows.top, rows.middle, rows.bottom, gy, begin, end, rows.step);
+    }
+}
+
+#if GORSEL_X86_SIMD
+template <const Kernel3x3& KX, const Kernel3x3& KY, int Channels>
+GORSEL_TARGET("avx2")
+void gradientRowsAvx2(const SobelRows& rows, int16_t* gx, int16_t* gy, size_t begin, size_t end) {
+    gradientRows<KX, KY, Channels>(rows, gx, gy, begin, end);
+}
+#endif
+
+// Sobel disindaki operatorler: satir once derleme zamani kernelleriyle int16
+// gx/gy tamponlarina (derleyici vektorlestirir), sonra buyukluge cevrilir.
+// Kullanilmayan gradyan sifir kalir; Laplacian yalnizca gx'i kullanir.
+template <const Kernel3x3& KX, const Kernel3x3& KY, int Channels>
+void kernelBand(const ConstImageView& input, const ImageView& output, int band_begin, int band_end,
+                SobelRows rows) {
+    const size_t row_size = output.getRowSize();
+    const size_t begin = rows.step;
+    const size_t end = row_size - rows.step;
+
+    ScratchBuffer<int16_t, GradientTag> gradients(2 * row_size);
+    int16_t* gx = gradients.data();
+    int16_t* gy = gradients.data() + row_size;
+    std::fill(gx, gx + 2 * row_size, 0);
+
+    for (int y = band_begin + 1; y < band_end + 1; ++y) {
+        rows.top = input.row(y - 1);
+        rows.middle = input.row(y);
+        rows.bottom = input.row(y + 1);
+#if GORSEL_X86_SIMD
+        if (simd::hasAvx2()) {
+            gradientRowsAvx2<KX, KY, Channels>(rows, gx, gy, begin, end);
+        } else {
+            gradientRows<KX, KY, Channels>(rows, gx, gy, begin, end);
+        }
+#else
+        gradientRows<KX, KY, Channels>(rows, gx, gy, begin, end);
+#endif
+        magnitudeRow(gx, gy, output.row(y), begin, end, rows.magnitude);
+    }
+}
+
+// Kenar modlu cerceve (1 piksellik halka; dar goruntude tum pikseller):
+// 3x3 komsuluk kanal kanal eslenmis koordinatlardan toplanir. Ic bolge
+// kontrolsuz satir cekirdekleriyle hesaplandigindan bu dongu kucuktur.
+template <const Kernel3x3& KX, const Kernel3x3& KY>
+void frameBorder(const ConstImageView& input, const ImageView& output, const SobelRows& settings,
+                 Filter::BorderMode mode, Image::Pixel value) {
+    const int width = input.getWidth();
+    const int height = input.getHeight();
+    const int channels = input.getChannels();
+    const bool narrow = width < 3 || height < 3;
+
+    for (int y = 0; y < height; ++y) {
+        const bool full_row = narrow || y == 0 || y == height - 1;
+        int rows[3];
+        int columns[3];
+        for (int k = 0; k < 3; ++k) {
+            rows[k] = borderIndex(y + k - 1, height, mode);
+        }
+        for (int x = 0; x < width; x = (full_row || x == width - 1) ? x + 1 : width - 1) {
+            for (int k = 0; k < 3; ++k) {
+                columns[k] = borderIndex(x + k - 1, width, mode);
+            }
+            for (int channel = 0; channel < channels; ++channel) {
+                Image::Pixel patch[3][3];
+                for (int j = 0; j < 3; ++j) {
+                    for (int i = 0; i < 3; ++i) {
+                        patch[j][i] = (rows[j] < 0 || columns[i] < 0)
+                                          ? value
+                                          : input.row(rows[j])[columns[i] * channels + channel];
+                    }
+                }
+                int gx = 0;
+                int gy = 0;
+                if (settings.use_gx) {
+                    gx = kernels::response3x3<KX>(patch[0] + 1, patch[1] + 1, patch[2] + 1, 1);
                 }
-                
-                if (direction_ == Vertical || direction_ == Both) {
-                    gy = applyConvolution(input, x, y, sobel_y_);
+                if (settings.use_gy) {
+                    gy = kernels::response3x3<KY>(patch[0] + 1, patch[1] + 1, patch[2] + 1, 1);
                 }
-                
-                double magnitude = std::sqrt(gx * gx + gy * gy);
-                output->at(x, y, channel) = static_cast<Image::Pixel>(
-                    std::min(255.0, std::max(0.0, magnitude)));
+                output.row(y)[x * channels + channel] = sobelMagnitude(gx, gy, settings.magnitude);
             }
         }
     }
-    
-    return output;
+}
+
+} // namespace
+
+EdgeDetection::EdgeDetection(Direction direction, Magnitude magnitude, Operator op)
+    : direction_(direction), magnitude_(magnitude), operator_(op) {
+}
+
+void EdgeDetection::apply(const ConstImageView& input, const ImageView& output) const {
+    checkViews(input, output);
+
+    const int width = input.getWidth();
+    const int height = input.getHeight();
+    const int channels = input.getChannels();
+    const size_t row_size = output.getRowSize();
+
+    SobelRows settings;
+    settings.step = channels;
+    settings.use_gx = (direction_ == Horizontal || direction_ == Both);
+    settings.use_gy = (direction_ == Vertical || direction_ == Both);
+    settings.magnitude = magnitude_;
+    if (operator_ == Laplacian) {
+        settings.use_gx = true;
+        settings.use_gy = false;
+        settings.magnitude = L1;
+    }
+
+    if (border_mode_ == Renormalize) {
+        // 1 piksellik cerceve hesaplanmaz, sifir kalir
+        for (int y = 0; y < height; ++y) {
+            Image::Pixel* row = output.row(y);
+            if (y == 0 || y == height - 1 || width < 3) {
+                std::fill(row, row + row_size, 0);
+            } else {
+                std::fill(row, row + channels, 0);
+                std::fill(row + row_size - channels, row + row_size, 0);
+            }
+        }
+    } else if (operator_ == Scharr) {
+        frameBorder<kernels::kScharrX, kernels::kScharrY>(input, output, settings, border_mode_, border_value_);
+    } else if (operator_ == Laplacian) {
+        frameBorder<kernels::kLaplacian, kernels::kLaplacian>(input, output, settings, border_mode_, border_value_);
+    } else {
+        frameBorder<kernels::kSobelX, kernels::kSobelY>(input, output, settings, border_mode_, border_value_);
+    }
+    if (width < 3 || height < 3) {
+        return;
+    }
+
+    if (operator_ != Sobel) {
+        ThreadPool::global().parallelRows(height - 2, row_size, [&](int band_begin, int band_end) {
+            kernels::withChannels(channels, [&](auto step) {
+                if (operator_ == Scharr) {
+                    kernelBand<kernels::kScharrX, kernels::kScharrY, step()>(input, output, band_begin, band_end,
+                                                                             settings);
+                } else {
+                    kernelBand<kernels::kLaplacian, kernels::kLaplacian, step()>(input, output, band_begin,
+                                                                                 band_end, settings);
+                }
+            });
+        });
+        return;
+    }
+
+    // Sobel: gx, gy ve buyukluk tek SIMD gecisinde
+    const size_t begin = channels;
+    const size_t end = row_size - channels;
+    ThreadPool::global().parallelRows(height - 2, row_size, [&](int band_begin, int band_end) {
+        SobelRows rows = settings;
+        for (int y = band_begin + 1; y < band_end + 1; ++y) {
+            rows.top = input.row(y - 1);
+            rows.middle = input.row(y);
+            rows.bottom = input.row(y + 1);
+            rows.output = output.row(y);
+            sobelRow(rows, begin, end);
+        }
+    });
 }
 
 std::unique_ptr<Filter> EdgeDetection::clone() const {
     return std::make_unique<EdgeDetection>(*this);
 }
 
+std::string EdgeDetection::getFingerprint() const {
+    char buffer[64];
+    std::snprintf(buffer, sizeof(buffer), "EdgeDetection:%d:%d:%d:%d:%d", static_cast<int>(direction_),
+                  static_cast<int>(magnitude_), static_cast<int>(operator_), static_cast<int>(border_mode_),
+                  static_cast<int>(border_value_));
+    return buffer;
+}
+
 void EdgeDetection::setDirection(Direction direction) {
     direction_ = direction;
 }
 
-void EdgeDetection::initializeSobelKernels() {
-    sobel_x_ = {{-1, 0, 1}, {-2, 0, 2}, {-1, 0, 1}};
-    sobel_y_ = {{-1, -2, -1}, {0, 0, 0}, {1, 2, 1}};
+void EdgeDetection::setMagnitude(Magnitude magnitude) {
+    magnitude_ = magnitude;
 }
 
-double EdgeDetection::applyConvolution(const Image& image, int x, int y, 
-                                     const std::vector<std::vector<int>>& kernel) const {
-    double sum = 0.0;
-    
-    for (int ky = 0; ky < 3; ++ky) {
-        for (int kx = 0; kx < 3; ++kx) {
-            int nx = x + kx - 1;
-            int ny = y + ky - 1;
-            
-            if (nx >= 0 && nx < image.getWidth() && 
-                ny >= 0 && ny < image.getHeight()) {
-                sum += image.at(nx, ny) * kernel[ky][kx];
-            }
-        }
-    }
-    
-    return sum;
+void EdgeDetection::setOperator(Operator op) {
+    operator_ = op;
+}
+
+void EdgeDetection::setBorderMode(BorderMode mode, Image::Pixel value) {
+    border_mode_ = mode;
+    border_value_ = value;
 }
 
-}
\ No newline at end of file
+} // namespace GorselIsleme
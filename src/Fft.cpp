@@ -0,0 +1,103 @@
+#include "Fft.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace GorselIsleme {
+
+FftPlan::FftPlan(int size) : size_(size) {
+    if (size < 1 || (size & (size - 1)) != 0) {
+        throw std::invalid_argument("FFT boyutu 2'nin kuvveti olmali");
+    }
+
+    int bits = 0;
+    while ((1 << bits) < size) {
+        ++bits;
+    }
+    bit_reverse_.resize(size);
+    for (int i = 0; i < size; ++i) {
+        int reversed = 0;
+        for (int bit = 0; bit < bits; ++bit) {
+            reversed |= ((i >> bit) & 1) << (bits - 1 - bit);
+        }
+        bit_reverse_[i] = reversed;
+    }
+
+    // w_k = exp(-2 pi i k / (2 half)), double ile hesaplanir
+    twiddle_re_.reserve(std::max(size - 1, 0));
+    twiddle_im_.reserve(std::max(size - 1, 0));
+    for (int half = 1; half < size; half *= 2) {
+        for (int k = 0; k < half; ++k) {
+            const double angle = -M_PI * k / half;
+            twiddle_re_.push_back(static_cast<float>(std::cos(angle)));
+            twiddle_im_.push_back(static_cast<float>(std::sin(angle)));
+        }
+    }
+}
+
+void FftPlan::transform(float* re, float* im, bool inverse) const {
+    for (int i = 0; i < size_; ++i) {
+        const int j = bit_reverse_[i];
+        if (i < j) {
+            std::swap(re[i], re[j]);
+            std::swap(im[i], im[j]);
+        }
+    }
+
+    const float sign = inverse ? -1.0f : 1.0f;
+    size_t offset = 0;
+    for (int half = 1; half < size_; offset += half, half *= 2) {
+        const float* wr = twiddle_re_.data() + offset;
+        const float* wi = twiddle_im_.data() + offset;
+        for (int start = 0; start < size_; start += 2 * half) {
+            float* are = re + start;
+            float* aim = im + start;
+            float* bre = are + half;
+            float* bim = aim + half;
+            for (int k = 0; k < half; ++k) {
+                const float w_im = sign * wi[k];
+                const float tr = bre[k] * wr[k] - bim[k] * w_im;
+                const float ti = bre[k] * w_im + bim[k] * wr[k];
+                bre[k] = are[k] - tr;
+                bim[k] = aim[k] - ti;
+                are[k] += tr;
+                aim[k] += ti;
+            }
+        }
+    }
+}
+
+void FftPlan::transformColumns(float* re, float* im, size_t columns, bool inverse) const {
+    for (int i = 0; i < size_; ++i) {
+        const int j = bit_reverse_[i];
+        if (i < j) {
+            std::swap_ranges(re + i * columns, re + (i + 1) * columns, re + j * columns);
+            std::swap_ranges(im + i * columns, im + (i + 1) * columns, im + j * columns);
+        }
+    }
+
+    const float sign = inverse ? -1.0f : 1.0f;
+    size_t offset = 0;
+    for (int half = 1; half < size_; offset += half, half *= 2) {
+        for (int start = 0; start < size_; start += 2 * half) {
+            for (int k = 0; k < half; ++k) {
+                const float w_re = twiddle_re_[offset + k];
+                const float w_im = sign * twiddle_im_[offset + k];
+                float* are = re + (start + k) * columns;
+                float* aim = im + (start + k) * columns;
+                float* bre = are + half * columns;
+                float* bim = aim + half * columns;
+                for (size_t c = 0; c < columns; ++c) {
+                    const float tr = bre[c] * w_re - bim[c] * w_im;
+                    const float ti = bre[c] * w_im + bim[c] * w_re;
+                    bre[c] = are[c] - tr;
+                    bim[c] = aim[c] - ti;
+                    are[c] += tr;
+                    aim[c] += ti;
+                }
+            }
+        }
+    }
+}
+
+} // namespace GorselIsleme
@@ -0,0 +1,34 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+
+// Dahili radix-2 karmasik FFT (harici kutuphane yok). Veriler ayri gercek ve
+// sanal dizilerde tutulur; asama basina ardisik twiddle tablolari sayesinde
+// kelebek dongusu birim adimlidir ve vektorlesir. Ters donusum olceklenmez.
+
+namespace GorselIsleme {
+
+class FftPlan {
+public:
+    // size 2'nin kuvveti olmali
+    explicit FftPlan(int size);
+
+    int size() const { return size_; }
+
+    // Tek dizi, yerinde
+    void transform(float* re, float* im, bool inverse) const;
+
+    // size x columns satir oncelikli duzlemin her sutununu donusturur.
+    // Kelebekler satir ciftleri uzerinde calisir; sutunlar boyunca vektorlesir
+    // ve transpoz gerekmez.
+    void transformColumns(float* re, float* im, size_t columns, bool inverse) const;
+
+private:
+    int size_;
+    std::vector<int> bit_reverse_;
+    // half = 1, 2, 4, ... asamalarinin twiddle'lari art arda (toplam size - 1)
+    std::vector<float> twiddle_re_;
+    std::vector<float> twiddle_im_;
+};
+
+} // namespace GorselIsleme
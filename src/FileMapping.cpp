@@ -0,0 +1,66 @@
+#include "FileMapping.h"
+#include <fstream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define GORSEL_HAS_MMAP 1
+#endif
+
+namespace GorselIsleme {
+
+bool FileMapping::open(const std::string& filename, Access access) {
+    if (data_) {
+        return false;
+    }
+#ifdef GORSEL_HAS_MMAP
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat info;
+    if (::fstat(fd, &info) != 0 || info.st_size <= 0) {
+        ::close(fd);
+        return false;
+    }
+    const size_t size = static_cast<size_t>(info.st_size);
+    void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // eslem dosya kapandiktan sonra da gecerlidir
+    if (mapping == MAP_FAILED) {
+        return false;
+    }
+    // Sirali okumada sayfalar onden yuklenir; rastgele erisimde okuma
+    // onden yapilmaz, yalnizca dokunulan sayfalar yuklenir
+    ::madvise(mapping, size, access == Sequential ? MADV_WILLNEED : MADV_RANDOM);
+    mapping_ = mapping;
+    data_ = static_cast<const unsigned char*>(mapping);
+    size_ = size;
+#else
+    (void)access;
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    if (!file.is_open() || file.tellg() <= 0) {
+        return false;
+    }
+    fallback_.resize(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    if (!file.read(reinterpret_cast<char*>(fallback_.data()), fallback_.size())) {
+        fallback_.clear();
+        return false;
+    }
+    data_ = fallback_.data();
+    size_ = fallback_.size();
+#endif
+    return true;
+}
+
+FileMapping::~FileMapping() {
+#ifdef GORSEL_HAS_MMAP
+    if (mapping_) {
+        ::munmap(mapping_, size_);
+    }
+#endif
+}
+
+} // namespace GorselIsleme
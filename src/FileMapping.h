@@ -0,0 +1,35 @@
+#pragma once
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Dahili salt okunur dosya eslemi. POSIX'te mmap kullanilir; diger
+// platformlarda dosya bellege okunur.
+
+namespace GorselIsleme {
+
+class FileMapping {
+public:
+    // Erisim deseni cekirdege ipucu olarak verilir
+    enum Access { Sequential, Random };
+    
+    FileMapping() = default;
+    ~FileMapping();
+    
+    FileMapping(const FileMapping&) = delete;
+    FileMapping& operator=(const FileMapping&) = delete;
+    
+    // Dosya acilamaz veya bossa false
+    bool open(const std::string& filename, Access access = Sequential);
+    
+    const unsigned char* data() const { return data_; }
+    size_t size() const { return size_; }
+    
+private:
+    void* mapping_ = nullptr;
+    const unsigned char* data_ = nullptr;
+    size_t size_ = 0;
+    std::vector<unsigned char> fallback_;
+};
+
+} // namespace GorselIsleme
@@ -0,0 +1,244 @@
+#include "FilterGraph.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace GorselIsleme {
+
+namespace {
+
+size_t imageBytes(const Image& image) {
+    return image.getData().size() * sizeof(Image::Pixel);
+}
+
+// Tek run() cagrisinin zamanlama durumu. Hazir dugum kalmayan govde beklemez,
+// cikar; boylece havuz thread'leri filtrelerin kendi parallelRows'una kalir.
+// Hazir dugumler calisan govdelerden fazlaysa havuza yardimci gonderilir.
+// Yardimcilar durumu paylasimli tutar: kuyrukta gec kalan bir yardimci run()
+// dondukten sonra calissa da yalnizca bos hazir listeyi gorup cikar.
+struct GraphRun : std::enable_shared_from_this<GraphRun> {
+    using NodeId = FilterGraph::NodeId;
+
+    std::vector<const Filter*> filters;  // girdi dugumunde nullptr
+    std::vector<NodeId> sources;         // temsilci kaynak
+    std::vector<std::vector<NodeId>> consumers;
+    std::vector<int> uses;
+    std::vector<char> is_output;
+    std::vector<const Image*> images;
+    std::vector<std::unique_ptr<Image>> results;
+    std::vector<NodeId> ready;
+    ThreadPool* pool = nullptr;
+    size_t thread_count = 1;
+    size_t computed = 0;
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    size_t finished = 0;
+    size_t running = 0;  // filtresi o an calisan dugum
+    size_t bodies = 1;   // cagiran + kuyruktaki veya calisan yardimcilar
+    size_t live_bytes = 0;
+    size_t peak_bytes = 0;
+    std::exception_ptr error;
+
+    // Cagiran tum dugumler bitene (veya hata sonrasi calisanlar durana) kadar
+    // doner; yardimci hazir dugum kalmayinca cikar. Hazir liste yigin gibi
+    // kullanilir: derinlik oncelikli sira ara sonuclari daha erken birakir.
+    void work(bool caller) {
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;) {
+            if (caller) {
+                condition.wait(lock, [&]() { return error || finished == computed || !ready.empty(); });
+                if (error) {
+                    condition.wait(lock, [&]() { return running == 0; });
+                    return;
+                }
+                if (finished == computed) {
+                    return;
+                }
+            } else if (error || ready.empty()) {
+                --bodies;
+                return;
+            }
+            const NodeId id = ready.back();
+            ready.pop_back();
+            ++running;
+            const size_t helpers = bodies < thread_count ? std::min(ready.size(), thread_count - bodies) : 0;
+            bodies += helpers;
+            const NodeId source = sources[id];
+            const Image& input = *images[source];
+            lock.unlock();
+
+            for (size_t i = 0; i < helpers; ++i) {
+                pool->submit([run = shared_from_this()]() { run->work(false); });
+            }
+            std::unique_ptr<Image> output;
+            try {
+                output = std::make_unique<Image>(input.getWidth(), input.getHeight(), input.getChannels(),
+                                                 Image::Uninitialized);
+                filters[id]->apply(input.view(), output->view());
+            } catch (...) {
+                lock.lock();
+                if (!error) {
+                    error = std::current_exception();
+                }
+                --running;
+                condition.notify_all();
+                continue;
+            }
+
+            lock.lock();
+            live_bytes += imageBytes(*output);
+            peak_bytes = std::max(peak_bytes, live_bytes);
+            images[id] = output.get();
+            results[id] = std::move(output);
+            if (--uses[source] == 0 && !is_output[source] && results[source]) {
+                live_bytes -= imageBytes(*results[source]);
+                results[source].reset();
+            }
+            ready.insert(ready.end(), consumers[id].begin(), consumers[id].end());
+            ++finished;
+            --running;
+            condition.notify_all();
+        }
+    }
+};
+
+} // namespace
+
+FilterGraph::NodeId FilterGraph::addInput() {
+    Node node;
+    node.input_index = input_count_++;
+    nodes_.push_back(std::move(node));
+    return nodes_.size() - 1;
+}
+
+FilterGraph::NodeId FilterGraph::addNode(std::unique_ptr<Filter> filter, NodeId source) {
+    if (!filter) {
+        throw std::invalid_argument("Filtre bos olamaz");
+    }
+    if (source >= nodes_.size()) {
+        throw std::out_of_range("Gecersiz kaynak dugum");
+    }
+    Node node;
+    node.filter = std::move(filter);
+    node.source = source;
+    nodes_.push_back(std::move(node));
+    return nodes_.size() - 1;
+}
+
+size_t FilterGraph::addOutput(NodeId node) {
+    if (node >= nodes_.size()) {
+        throw std::out_of_range("Gecersiz cikti dugumu");
+    }
+    outputs_.push_back(node);
+    return outputs_.size() - 1;
+}
+
+std::vector<std::unique_ptr<Image>> FilterGraph::run(const std::vector<const Image*>& inputs,
+                                                     GraphStats* stats) const {
+    if (inputs.size() != input_count_) {
+        throw std::invalid_argument("Girdi sayisi grafla uyusmuyor");
+    }
+    if (std::find(inputs.begin(), inputs.end(), nullptr) != inputs.end()) {
+        throw std::invalid_argument("Girdi bos olamaz");
+    }
+    const size_t count = nodes_.size();
+
+    // Ortak alt ifadeler: her dugum kaynagindan sonra eklendiginden tek ileri
+    // gecis yeter. Ayni (kaynak, parmak izi) ciftinin ilk dugumu temsilcidir.
+    std::vector<NodeId> canonical(count);
+    std::map<const Image*, NodeId> input_nodes;
+    std::map<std::pair<NodeId, std::string>, NodeId> filter_nodes;
+    for (NodeId id = 0; id < count; ++id) {
+        const Node& node = nodes_[id];
+        if (!node.filter) {
+            canonical[id] = input_nodes.emplace(inputs[node.input_index], id).first->second;
+            continue;
+        }
+        const std::string fingerprint = node.filter->getFingerprint();
+        canonical[id] = fingerprint.empty()
+                            ? id
+                            : filter_nodes.emplace(std::make_pair(canonical[node.source], fingerprint), id)
+                                  .first->second;
+    }
+
+    // Ciktilardan geriye: yalnizca ulasilan temsilciler calisir. uses, bir
+    // sonucu okuyacak dugum sayisidir; sifira inince sonuc serbest kalir.
+    auto run = std::make_shared<GraphRun>();
+    run->filters.resize(count);
+    run->sources.resize(count);
+    run->consumers.resize(count);
+    run->uses.resize(count);
+    run->is_output.resize(count);
+    run->images.resize(count);
+    run->results.resize(count);
+    std::vector<char> reached(count), needed(count);
+    for (const NodeId output : outputs_) {
+        reached[output] = 1;
+        needed[canonical[output]] = 1;
+        run->is_output[canonical[output]] = 1;
+    }
+    GraphStats run_stats;
+    for (NodeId id = count; id-- > 0;) {
+        if (!nodes_[id].filter) {
+            continue;
+        }
+        if (reached[id]) {
+            reached[nodes_[id].source] = 1;
+            ++run_stats.nodes;
+        }
+        if (needed[id]) {
+            const NodeId source = canonical[nodes_[id].source];
+            needed[source] = 1;
+            ++run->uses[source];
+            run->consumers[source].push_back(id);
+            run->filters[id] = nodes_[id].filter.get();
+            run->sources[id] = source;
+            ++run_stats.computed;
+        }
+    }
+    run_stats.shared = run_stats.nodes - run_stats.computed;
+
+    for (NodeId id = 0; id < count; ++id) {
+        if (needed[id] && !nodes_[id].filter) {
+            run->images[id] = inputs[nodes_[id].input_index];
+            run->ready.insert(run->ready.end(), run->consumers[id].begin(), run->consumers[id].end());
+        }
+    }
+
+    if (run_stats.computed > 0) {
+        run->pool = &ThreadPool::global();
+        run->thread_count = run->pool->getThreadCount();
+        run->computed = run_stats.computed;
+        run->work(true);
+        if (run->error) {
+            std::rethrow_exception(run->error);
+        }
+        run_stats.peak_bytes = run->peak_bytes;
+    }
+    std::vector<std::unique_ptr<Image>>& results = run->results;
+    const std::vector<const Image*>& images = run->images;
+
+    // Ayni temsilciye bagli ikinci cikti ve girdinin kendisi kopyalanir
+    std::vector<std::unique_ptr<Image>> outputs(outputs_.size());
+    for (size_t i = 0; i < outputs_.size(); ++i) {
+        const NodeId node = canonical[outputs_[i]];
+        if (results[node]) {
+            outputs[i] = std::move(results[node]);
+        } else {
+            outputs[i] = std::make_unique<Image>(*images[node]);
+        }
+    }
+    if (stats) {
+        *stats = run_stats;
+    }
+    return outputs;
+}
+
+} // namespace GorselIsleme
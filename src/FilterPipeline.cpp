@@ -1,13 +1,145 @@
 #include "FilterPipeline.h"
+#include "Hash.h"
+#include "Scratch.h"
+#include "ThreadPool.h"
+#include "TraceCounters.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <stdexcept>
 
 namespace GorselIsleme {
 
+namespace {
+
+struct TileTag;
+struct IncrementalTag;
+
+struct Region {
+    int x0, y0, x1, y1;
+    
+    int width() const { return x1 - x0; }
+    int height() const { return y1 - y0; }
+    
+    Region expanded(int radius, int width, int height) const {
+        return {std::max(0, x0 - radius), std::max(0, y0 - radius),
+                std::min(width, x1 + radius), std::min(height, y1 + radius)};
+    }
+};
+
+uint64_t nanosecondsSince(std::chrono::steady_clock::time_point start) {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+}
+
+} // namespace
+
+// Izleme acikken tek apply'in olcumleri. Yalnizca gozlemci ayarliysa olusturulur.
+// Ayirma ve mesgul sure sayaclari bu apply'a aittir: olusturan thread'e ve
+// onun parallelFor yardimcilarina baglanir, es zamanli apply'lar karismaz.
+struct FilterPipeline::ApplyTrace {
+    const FilterPipeline& pipeline;
+    PipelineObserver& observer;
+    const std::vector<Stage>& stages;
+    TraceCounters counters;
+    TraceCountersScope scope;
+    ApplyEvent apply;
+    uint64_t pixels;
+    double thread_count;
+    double stage_start_us = 0.0;
+    uint64_t stage_busy_ns = 0;
+    uint64_t stage_bytes = 0;
+    std::unique_ptr<std::atomic<uint64_t>[]> fused_ns; // Tiled: asama basina toplam
+    
+    ApplyTrace(const FilterPipeline& pipeline, const std::vector<Stage>& stages, const Image& input, bool tiled)
+        : pipeline(pipeline), observer(*pipeline.observer_), stages(stages), scope(&counters),
+          pixels(static_cast<uint64_t>(input.getWidth()) * input.getHeight()),
+          thread_count(static_cast<double>(ThreadPool::global().getThreadCount())) {
+        static std::atomic<uint64_t> next_apply_id{1};
+        counters.parent = scope.previous();
+        apply.apply_id = next_apply_id.fetch_add(1, std::memory_order_relaxed);
+        apply.width = input.getWidth();
+        apply.height = input.getHeight();
+        apply.channels = input.getChannels();
+        apply.tiled = tiled;
+        apply.stage_count = stages.size();
+        apply.thread_id = traceThreadId();
+        if (tiled) {
+            fused_ns.reset(new std::atomic<uint64_t>[stages.size()]);
+            for (size_t i = 0; i < stages.size(); ++i) {
+                fused_ns[i] = 0;
+            }
+        }
+        apply.start_us = traceTimestampUs();
+    }
+    
+    uint64_t busyNanoseconds() const { return counters.busy_ns.load(std::memory_order_relaxed); }
+    uint64_t allocatedBytes() const { return counters.allocated_bytes.load(std::memory_order_relaxed); }
+    
+    double utilization(uint64_t busy_ns, double duration_us) const {
+        return duration_us > 0.0 ? std::min(1.0, busy_ns / (duration_us * 1000.0 * thread_count)) : 0.0;
+    }
+    
+    void beginStage() {
+        stage_busy_ns = busyNanoseconds();
+        stage_bytes = allocatedBytes();
+        stage_start_us = traceTimestampUs();
+    }
+    
+    void endStage(size_t index) {
+        StageEvent event;
+        event.duration_us = traceTimestampUs() - stage_start_us;
+        event.start_us = stage_start_us;
+        event.allocated_bytes = allocatedBytes() - stage_bytes;
+        event.thread_utilization = utilization(busyNanoseconds() - stage_busy_ns, event.duration_us);
+        emitStage(index, event);
+    }
+    
+    void emitStage(size_t index, StageEvent& event) {
+        event.apply_id = apply.apply_id;
+        event.stage_index = index;
+        event.name = pipeline.stageName(stages[index]);
+        event.pixels = pixels;
+        event.thread_id = apply.thread_id;
+        observer.onStage(event);
+    }
+    
+    void finish() {
+        apply.duration_us = traceTimestampUs() - apply.start_us;
+        apply.allocated_bytes = allocatedBytes();
+        apply.thread_utilization = utilization(busyNanoseconds(), apply.duration_us);
+        if (fused_ns) {
+            for (size_t i = 0; i < stages.size(); ++i) {
+                StageEvent event;
+                event.fused = true;
+                event.start_us = apply.start_us;
+                event.duration_us = fused_ns[i].load(std::memory_order_relaxed) / 1000.0;
+                event.thread_utilization = apply.thread_utilization;
+                emitStage(i, event);
+            }
+        }
+        observer.onApply(apply);
+    }
+};
+
+void FilterPipeline::Stage::run(const ConstImageView& input, const ImageView& output) const {
+    if (filter) {
+        filter->apply(input, output);
+    } else {
+        PointOp::applyLut(lut, input, output);
+    }
+}
+
+FilterPipeline::FilterPipeline() = default;
+FilterPipeline::~FilterPipeline() = default;
+
 void FilterPipeline::addFilter(std::unique_ptr<Filter> filter) {
     if (!filter) {
         throw std::invalid_argument("Filtre bos olamaz");
     }
     filters_.push_back(std::move(filter));
+    prepared_ = false;
+    incremental_valid_ = false;
 }
 
 void FilterPipeline::removeFilter(size_t index) {
@@ -15,24 +147,629 @@ void FilterPipeline::removeFilter(size_t index) {
         throw std::out_of_range("Gecersiz filtre indeksi");
     }
     filters_.erase(filters_.begin() + index);
+    prepared_ = false;
+    incremental_valid_ = false;
 }
 
 void FilterPipeline::clear() {
     filters_.clear();
+    prepared_ = false;
+    incremental_valid_ = false;
 }
 
 std::unique_ptr<Image> FilterPipeline::apply(const Image& input) const {
+    return applyNew(input, nullptr);
+}
+
+std::unique_ptr<Image> FilterPipeline::apply(const Image& input, const CancellationToken& token) const {
+    return applyNew(input, &token);
+}
+
+std::unique_ptr<Image> FilterPipeline::applyNew(const Image& input, const CancellationToken* token) const {
+    if (token) {
+        token->throwIfCancelled();
+    }
     if (filters_.empty()) {
         return std::make_unique<Image>(input);
     }
+    if (cache_) {
+        return applyCached(input, token);
+    }
+    
+    auto output = std::make_unique<Image>(input.getWidth(), input.getHeight(), input.getChannels(),
+                                          Image::Uninitialized);
+    auto stages = buildStages();
+    std::unique_ptr<ApplyTrace> trace;
+    if (observer_) {
+        trace = std::make_unique<ApplyTrace>(*this, stages, input, effectiveMode() == Tiled);
+    }
+    if (effectiveMode() == Tiled) {
+        applyTiled(input, output->view(), stages, trace.get(), token);
+    } else {
+        std::unique_ptr<Image> scratch;
+        if (planBuffers(stages)) {
+            scratch = std::make_unique<Image>(input.getWidth(), input.getHeight(), input.getChannels(),
+                                              Image::Uninitialized);
+        }
+        applySequential(input, *output, scratch.get(), stages, trace.get(), token);
+    }
+    if (trace) {
+        trace->finish();
+    }
+    return output;
+}
+
+std::unique_ptr<Image> FilterPipeline::applyCached(const Image& input, const CancellationToken* token) const {
+    const std::vector<Stage> stages = buildStages();
+    const uint64_t input_hash = ResultCache::hashImage(input);
+    
+    // keys[i]: i. asama sonrasinin anahtari (0..i asamalarinin filtreleri)
+    std::vector<ResultCache::Key> keys(stages.size());
+    std::vector<char> cacheable(stages.size());
+    uint64_t prefix = 0;
+    bool valid = true;
+    for (size_t i = 0, filter = 0; i < stages.size(); ++i) {
+        for (; filter < stages[i].first_filter + stages[i].filter_count; ++filter) {
+            const std::string fingerprint = filters_[filter]->getFingerprint();
+            valid = valid && !fingerprint.empty();
+            prefix = hash::combine(prefix, hash::bytes(fingerprint.data(), fingerprint.size()));
+        }
+        keys[i] = {input_hash, prefix};
+        cacheable[i] = valid;
+    }
+    
+    size_t start = 0;
+    std::shared_ptr<const Image> cached;
+    for (size_t i = stages.size(); i-- > 0;) {
+        if (cacheable[i] && (cached = cache_->find(keys[i]))) {
+            start = i + 1;
+            break;
+        }
+    }
+    if (start == stages.size()) {
+        return std::make_unique<Image>(*cached);
+    }
+    
+    const Image& source = cached ? *cached : input;
+    const std::vector<Stage> remaining(stages.begin() + start, stages.end());
+    const bool tiled = effectiveMode() == Tiled;
+    std::unique_ptr<ApplyTrace> trace;
+    if (observer_) {
+        trace = std::make_unique<ApplyTrace>(*this, remaining, input, tiled);
+    }
+    auto output = std::make_unique<Image>(input.getWidth(), input.getHeight(), input.getChannels(),
+                                          Image::Uninitialized);
+    if (tiled) {
+        applyTiled(source, output->view(), remaining, trace.get(), token);
+    } else {
+        // Her ara sonuc kendi tamponuna yazilir ve kopyalanmadan onbellege girer
+        std::shared_ptr<const Image> previous;
+        const Image* from = &source;
+        for (size_t i = 0; i < remaining.size(); ++i) {
+            if (token && i > 0) {
+                token->throwIfCancelled();
+            }
+            const bool last = i + 1 == remaining.size();
+            std::shared_ptr<Image> target;
+            if (!last) {
+                target = std::make_shared<Image>(input.getWidth(), input.getHeight(), input.getChannels(),
+                                                 Image::Uninitialized);
+            }
+            if (trace) {
+                trace->beginStage();
+            }
+            remaining[i].run(from->view(), last ? output->view() : target->view());
+            if (trace) {
+                trace->endStage(i);
+            }
+            if (!last) {
+                if (cacheable[start + i]) {
+                    cache_->insert(keys[start + i], target);
+                }
+                previous = std::move(target);
+                from = previous.get();
+            }
+        }
+    }
+    if (cacheable.back()) {
+        cache_->insert(keys.back(), std::make_shared<Image>(*output));
+    }
+    if (trace) {
+        trace->finish();
+    }
+    return output;
+}
+
+void FilterPipeline::prepare(int width, int height, int channels) {
+    if (width <= 0 || height <= 0 || channels <= 0) {
+        throw std::invalid_argument("Gecersiz boyutlar");
+    }
+    
+    plan_ = buildStages();
+    const bool needs_scratch = planBuffers(plan_) && effectiveMode() == Sequential;
+    if (!needs_scratch) {
+        scratch_.reset();
+    } else if (!scratch_ || scratch_->getWidth() != width || scratch_->getHeight() != height ||
+               scratch_->getChannels() != channels) {
+        scratch_ = std::make_unique<Image>(width, height, channels, Image::Uninitialized);
+    }
+    // Onceki boyutun yuvalari birakilir; yenileri ilk apply'larda olusur
+    if (!arena_ || !isPreparedFor(width, height, channels)) {
+        arena_ = std::make_unique<ScratchArena>();
+    }
     
-    std::unique_ptr<Image> current = std::make_unique<Image>(input);
+    prepared_ = true;
+    prepared_width_ = width;
+    prepared_height_ = height;
+    prepared_channels_ = channels;
+    prepared_mode_ = execution_mode_;
+}
+
+bool FilterPipeline::isPreparedFor(int width, int height, int channels) const {
+    return prepared_ && prepared_mode_ == execution_mode_ && prepared_width_ == width &&
+           prepared_height_ == height && prepared_channels_ == channels;
+}
+
+void FilterPipeline::apply(const Image& input, Image& output) {
+    if (&input == &output) {
+        throw std::invalid_argument("Girdi ve cikti ayni goruntu olamaz");
+    }
+    
+    const int width = input.getWidth();
+    const int height = input.getHeight();
+    const int channels = input.getChannels();
+    if (output.getWidth() != width || output.getHeight() != height || output.getChannels() != channels) {
+        output = Image(width, height, channels, Image::Uninitialized, output.getLayout());
+    }
+    if (filters_.empty()) {
+        const ConstImageView source = input.view();
+        const ImageView destination = output.view();
+        for (int y = 0; y < height; ++y) {
+            std::copy(source.row(y), source.row(y) + source.getRowSize(), destination.row(y));
+        }
+        return;
+    }
     
+    if (!isPreparedFor(width, height, channels)) {
+        prepare(width, height, channels);
+    }
+    ScratchArenaScope arena_scope(arena_.get());
+    std::unique_ptr<ApplyTrace> trace;
+    if (observer_) {
+        trace = std::make_unique<ApplyTrace>(*this, plan_, input, effectiveMode() == Tiled);
+    }
+    if (effectiveMode() == Tiled) {
+        applyTiled(input, output.view(), plan_, trace.get());
+    } else {
+        applySequential(input, output, scratch_.get(), plan_, trace.get());
+    }
+    if (trace) {
+        trace->finish();
+    }
+}
+
+FilterPipeline::Rect FilterPipeline::applyIncremental(const Image& input, Image& output, const Rect& dirty) {
+    if (&input == &output) {
+        throw std::invalid_argument("Girdi ve cikti ayni goruntu olamaz");
+    }
+    if (dirty.width < 0 || dirty.height < 0) {
+        throw std::invalid_argument("Gecersiz bolge boyutu");
+    }
+    
+    const int width = input.getWidth();
+    const int height = input.getHeight();
+    const int channels = input.getChannels();
+    if (!incremental_valid_ || incremental_width_ != width || incremental_height_ != height ||
+        incremental_channels_ != channels || output.getWidth() != width || output.getHeight() != height ||
+        output.getChannels() != channels) {
+        return applyIncrementalFull(input, output);
+    }
+    
+    Region region{std::max(0, dirty.x), std::max(0, dirty.y), std::min(width, dirty.x + dirty.width),
+                  std::min(height, dirty.y + dirty.height)};
+    if (region.width() <= 0 || region.height() <= 0) {
+        return Rect();
+    }
+    
+    const auto copyRegion = [](const ConstImageView& from, const ImageView& to) {
+        for (int y = 0; y < from.getHeight(); ++y) {
+            std::copy(from.row(y), from.row(y) + from.getRowSize(), to.row(y));
+        }
+    };
+    if (incremental_plan_.empty()) {
+        copyRegion(input.view(region.x0, region.y0, region.width(), region.height()),
+                   output.view(region.x0, region.y0, region.width(), region.height()));
+        return {region.x0, region.y0, region.width(), region.height()};
+    }
+    
+    const Image* source = &input;
+    for (size_t i = 0; i < incremental_plan_.size(); ++i) {
+        const Stage& stage = incremental_plan_[i];
+        // Asama ciktisinda degisen bolge yaricap kadar buyur; onu dogru
+        // hesaplamak icin girdi bir yaricap daha genis okunur. Gorunum kenari
+        // goruntu kenari gibi islendiginden yalnizca ic kisim gecerlidir.
+        const Region changed = region.expanded(stage.radius, width, height);
+        const Region needed = changed.expanded(stage.radius, width, height);
+        Image& target = i + 1 < incremental_plan_.size() ? *incremental_results_[i] : output;
+        
+        ScratchBuffer<Image::Pixel, IncrementalTag> buffer(static_cast<size_t>(needed.width()) *
+                                                           needed.height() * channels);
+        const ImageView result(buffer.data(), needed.width(), needed.height(), channels,
+                               static_cast<std::ptrdiff_t>(needed.width()) * channels);
+        stage.run(source->view(needed.x0, needed.y0, needed.width(), needed.height()), result);
+        copyRegion(result.subView(changed.x0 - needed.x0, changed.y0 - needed.y0, changed.width(), changed.height()),
+                   target.view(changed.x0, changed.y0, changed.width(), changed.height()));
+        
+        source = &target;
+        region = changed;
+    }
+    return {region.x0, region.y0, region.width(), region.height()};
+}
+
+void FilterPipeline::resetIncremental() {
+    incremental_valid_ = false;
+    incremental_plan_.clear();
+    incremental_results_.clear();
+}
+
+FilterPipeline::Rect FilterPipeline::applyIncrementalFull(const Image& input, Image& output) {
+    const int width = input.getWidth();
+    const int height = input.getHeight();
+    const int channels = input.getChannels();
+    if (output.getWidth() != width || output.getHeight() != height || output.getChannels() != channels) {
+        output = Image(width, height, channels, Image::Uninitialized, output.getLayout());
+    }
+    
+    incremental_plan_ = buildStages();
+    incremental_results_.resize(incremental_plan_.empty() ? 0 : incremental_plan_.size() - 1);
+    for (auto& result : incremental_results_) {
+        if (!result || result->getWidth() != width || result->getHeight() != height ||
+            result->getChannels() != channels) {
+            result = std::make_unique<Image>(width, height, channels, Image::Uninitialized);
+        }
+    }
+    
+    const Image* source = &input;
+    for (size_t i = 0; i < incremental_plan_.size(); ++i) {
+        Image& target = i + 1 < incremental_plan_.size() ? *incremental_results_[i] : output;
+        incremental_plan_[i].run(source->view(), target.view());
+        source = &target;
+    }
+    if (incremental_plan_.empty()) {
+        const ConstImageView from = input.view();
+        const ImageView to = output.view();
+        for (int y = 0; y < height; ++y) {
+            std::copy(from.row(y), from.row(y) + from.getRowSize(), to.row(y));
+        }
+    }
+    
+    // Yerel olmayan veya gorunume bagli filtrede bolge buyutmesi gecersiz:
+    // her cagri tam hesaplanir
+    incremental_valid_ = isLocal() && isViewInvariant();
+    incremental_width_ = width;
+    incremental_height_ = height;
+    incremental_channels_ = channels;
+    return {0, 0, width, height};
+}
+
+void FilterPipeline::setTileSize(int width, int height) {
+    if (width <= 0 || height <= 0) {
+        throw std::invalid_argument("Karo boyutu pozitif olmali");
+    }
+    tile_width_ = width;
+    tile_height_ = height;
+}
+
+bool FilterPipeline::isLocal() const {
+    return std::all_of(filters_.begin(), filters_.end(),
+                       [](const std::unique_ptr<Filter>& filter) { return filter->isLocal(); });
+}
+
+bool FilterPipeline::isViewInvariant() const {
+    return std::all_of(filters_.begin(), filters_.end(),
+                       [](const std::unique_ptr<Filter>& filter) { return filter->isViewInvariant(); });
+}
+
+FilterPipeline::ExecutionMode FilterPipeline::effectiveMode() const {
+    return execution_mode_ == Tiled && isLocal() && isViewInvariant() ? Tiled : Sequential;
+}
+
+int FilterPipeline::getRadius() const {
+    int radius = 0;
     for (const auto& filter : filters_) {
-        current = filter->apply(*current);
+        radius += filter->getRadius();
     }
+    return radius;
+}
+
+std::vector<FilterPipeline::Stage> FilterPipeline::buildStages() const {
+    std::vector<Stage> stages;
     
-    return current;
+    for (size_t i = 0; i < filters_.size();) {
+        Stage stage;
+        const auto* point_op = dynamic_cast<const PointOp*>(filters_[i].get());
+        if (!point_op) {
+            stage.filter = filters_[i].get();
+            stage.first_filter = i;
+            stage.radius = stage.filter->getRadius();
+            stage.in_place = stage.filter->supportsInPlace();
+            stages.push_back(stage);
+            ++i;
+            continue;
+        }
+        
+        // Ardisik nokta islemleri tek tabloda birlesir: N yerine tek bellek gecisi
+        stage.lut = point_op->getLut();
+        stage.in_place = true;
+        stage.first_filter = i;
+        for (++i; i < filters_.size(); ++i) {
+            const auto* next = dynamic_cast<const PointOp*>(filters_[i].get());
+            if (!next) {
+                break;
+            }
+            stage.lut = PointOp::compose(stage.lut, next->getLut());
+        }
+        stage.filter_count = i - stage.first_filter;
+        stages.push_back(stage);
+    }
+    
+    for (size_t i = stages.size(); i-- > 0;) {
+        stages[i].halo = stages[i].radius + (i + 1 < stages.size() ? stages[i + 1].halo : 0);
+    }
+    return stages;
+}
+
+bool FilterPipeline::planBuffers(std::vector<Stage>& stages) {
+    // Sondan basa: son asama output'a yazar. Bir sonraki asama yerinde
+    // calisabiliyorsa onceki asama ayni tampona yazar, aksi halde diger tampona.
+    // Boylece output disinda en fazla bir ara tampon gerekir.
+    bool needs_scratch = false;
+    bool next_to_scratch = false;
+    for (size_t i = stages.size(); i-- > 0;) {
+        if (i + 1 == stages.size()) {
+            stages[i].to_scratch = false;
+        } else {
+            stages[i].to_scratch = stages[i + 1].in_place ? next_to_scratch : !next_to_scratch;
+        }
+        next_to_scratch = stages[i].to_scratch;
+        needs_scratch = needs_scratch || stages[i].to_scratch;
+    }
+    return needs_scratch;
+}
+
+void FilterPipeline::applySequential(const Image& input, Image& output, Image* scratch,
+                                     const std::vector<Stage>& stages, ApplyTrace* trace,
+                                     const CancellationToken* token) const {
+    const Image* source = &input;
+    
+    for (size_t i = 0; i < stages.size(); ++i) {
+        if (token && i > 0) {
+            token->throwIfCancelled();
+        }
+        Image* target = stages[i].to_scratch ? scratch : &output;
+        if (trace) {
+            trace->beginStage();
+        }
+        stages[i].run(source->view(), target->view());
+        if (trace) {
+            trace->endStage(i);
+        }
+        source = target;
+    }
+}
+
+std::string FilterPipeline::stageName(const Stage& stage) const {
+    std::string name = filters_[stage.first_filter]->getName();
+    for (size_t i = 1; i < stage.filter_count; ++i) {
+        name += "+" + filters_[stage.first_filter + i]->getName();
+    }
+    return name;
+}
+
+void FilterPipeline::applyTiled(const Image& input, const ImageView& output, const std::vector<Stage>& stages,
+                                ApplyTrace* trace, const CancellationToken* token) const {
+    const int width = input.getWidth();
+    const int height = input.getHeight();
+    const int channels = input.getChannels();
+    
+    // halo(i): i. asamanin girdi bolgesinin karodan tasma miktari
+    const auto halo = [&stages](size_t i) { return i < stages.size() ? stages[i].halo : 0; };
+    
+    const int tiles_x = (width + tile_width_ - 1) / tile_width_;
+    const int tiles_y = (height + tile_height_ - 1) / tile_height_;
+    const size_t max_buffer = static_cast<size_t>(tile_width_ + 2 * halo(0)) *
+                              (tile_height_ + 2 * halo(0)) * channels;
+    
+    ThreadPool& pool = ThreadPool::global();
+    const int tile_count = tiles_x * tiles_y;
+    const int bands = static_cast<int>(pool.getThreadCount()) * 4;
+    const int grain = (tile_count + bands - 1) / bands;
+    
+    pool.parallelFor(0, tile_count, grain, [&](int tile_begin, int tile_end) {
+        // Karo asamalari iki tampon arasinda gidip gelir
+        ScratchBuffer<Image::Pixel, TileTag> tile_buffers(2 * max_buffer);
+        Image::Pixel* buffers[2] = {tile_buffers.data(), tile_buffers.data() + max_buffer};
+        
+        for (int tile = tile_begin; tile < tile_end; ++tile) {
+            if (token) {
+                token->throwIfCancelled();
+            }
+            const int tx = (tile % tiles_x) * tile_width_;
+            const int ty = (tile / tiles_x) * tile_height_;
+            const Region target{tx, ty, std::min(width, tx + tile_width_), std::min(height, ty + tile_height_)};
+            
+            Region source_region = target.expanded(halo(0), width, height);
+            ConstImageView source = input.view(source_region.x0, source_region.y0,
+                                               source_region.width(), source_region.height());
+            ImageView result;
+            
+            for (size_t i = 0; i < stages.size(); ++i) {
+                // Asama girdi bolgesinin tamami uzerinde calisir; gecerli cikti
+                // bir sonraki asamanin bolgesidir (halo(i + 1) kadar genis)
+                result = ImageView(buffers[i % 2], source_region.width(), source_region.height(), channels,
+                                   static_cast<std::ptrdiff_t>(source_region.width()) * channels);
+                if (trace) {
+                    const auto start = std::chrono::steady_clock::now();
+                    stages[i].run(source, result);
+                    trace->fused_ns[i].fetch_add(nanosecondsSince(start), std::memory_order_relaxed);
+                } else {
+                    stages[i].run(source, result);
+                }
+                
+                const Region next_region = target.expanded(halo(i + 1), width, height);
+                result = result.subView(next_region.x0 - source_region.x0, next_region.y0 - source_region.y0,
+                                        next_region.width(), next_region.height());
+                source = result;
+                source_region = next_region;
+            }
+            
+            const ImageView destination = output.subView(target.x0, target.y0, target.width(), target.height());
+            const size_t row_bytes = destination.getRowSize();
+            for (int y = 0; y < target.height(); ++y) {
+                std::copy(result.row(y), result.row(y) + row_bytes, destination.row(y));
+            }
+        }
+    });
+}
+
+StreamStats FilterPipeline::applyStreaming(RowSource& source, RowSink& sink, int strip_rows) const {
+    if (strip_rows <= 0) {
+        throw std::invalid_argument("Serit yuksekligi pozitif olmali");
+    }
+    if (!isLocal()) {
+        throw std::invalid_argument("Yerel olmayan filtre (Wrap kenar modu) seritlerle islenemez");
+    }
+    const int width = source.getWidth();
+    const int height = source.getHeight();
+    const int channels = source.getChannels();
+    const size_t row_size = static_cast<size_t>(width) * channels;
+    auto stages = buildStages();
+    if (!isViewInvariant()) {
+        // Seritler ayri gorunumler olurdu; sonuc apply() ile ayni kalsin diye
+        // goruntu tek parca okunur
+        Image input(width, height, channels, Image::Uninitialized);
+        Image output(width, height, channels, Image::Uninitialized);
+        std::unique_ptr<Image> scratch;
+        if (planBuffers(stages)) {
+            scratch = std::make_unique<Image>(width, height, channels, Image::Uninitialized);
+        }
+        source.readRows(input.view());
+        applySequential(input, output, scratch.get(), stages, nullptr);
+        sink.writeRows(output.view());
+        sink.finish();
+        
+        StreamStats stats;
+        stats.strips = 1;
+        stats.buffer_bytes = (scratch ? 3 : 2) * row_size * height;
+        return stats;
+    }
+    
+    // Asama girdisinin kayan penceresi: [first, first + count) satirlari.
+    // Bir asamaya gelen satirlar en fazla strip_rows + onceki yaricaplar,
+    // tutulan satirlar en fazla 2 * yaricap; kapasite ikisini de karsilar.
+    struct Window {
+        Image::PixelVector data;
+        int first = 0;
+        int count = 0;
+        int produced = 0;
+        
+        ImageView rows(int begin, int end, int width, int channels, size_t row_size) {
+            return ImageView(data.data() + static_cast<size_t>(begin - first) * row_size, width, end - begin,
+                             channels, static_cast<std::ptrdiff_t>(row_size));
+        }
+    };
+    
+    const int halo = stages.empty() ? 0 : stages[0].halo;
+    const size_t capacity_rows = static_cast<size_t>(std::min(height, strip_rows + 2 * halo));
+    std::vector<Window> windows(std::max<size_t>(stages.size(), 1));
+    for (auto& window : windows) {
+        window.data.resize(capacity_rows * row_size);
+    }
+    Image::PixelVector scratch(stages.empty() ? 0 : capacity_rows * row_size);
+    
+    const auto append = [&](Window& window, const ConstImageView& rows) {
+        const int begin = window.first + window.count;
+        const ImageView target = window.rows(begin, begin + rows.getHeight(), width, channels, row_size);
+        for (int y = 0; y < rows.getHeight(); ++y) {
+            std::copy(rows.row(y), rows.row(y) + row_size, target.row(y));
+        }
+        window.count += rows.getHeight();
+    };
+    
+    // i. asama, penceresindeki satirlarla uretebildigi tum gecerli satirlari
+    // uretip bir sonraki asamaya (veya hedefe) iter
+    const auto pump = [&](size_t i, const auto& self) -> void {
+        Window& window = windows[i];
+        const int radius = stages[i].radius;
+        const int available = window.first + window.count;
+        const int produce_end = available == height ? height : available - radius;
+        const int produce_begin = window.produced;
+        if (produce_end <= produce_begin) {
+            return;
+        }
+        
+        const int in_begin = std::max(0, produce_begin - radius);
+        const int in_end = std::min(height, produce_end + radius);
+        const ImageView input = window.rows(in_begin, in_end, width, channels, row_size);
+        const ImageView output(scratch.data(), width, in_end - in_begin, channels,
+                               static_cast<std::ptrdiff_t>(row_size));
+        stages[i].run(input, output);
+        
+        const ConstImageView valid = output.subView(0, produce_begin - in_begin, width, produce_end - produce_begin);
+        if (i + 1 < stages.size()) {
+            append(windows[i + 1], valid);
+            window.produced = produce_end;
+            self(i + 1, self);
+        } else {
+            sink.writeRows(valid);
+            window.produced = produce_end;
+        }
+        
+        // Sonraki uretim icin yalnizca yaricap kadar geri satir tutulur
+        const int keep_first = std::max(0, produce_end - radius);
+        const size_t drop = static_cast<size_t>(keep_first - window.first) * row_size;
+        std::copy(window.data.begin() + drop, window.data.begin() + static_cast<size_t>(window.count) * row_size,
+                  window.data.begin());
+        window.count -= keep_first - window.first;
+        window.first = keep_first;
+    };
+    
+    StreamStats stats;
+    for (int row = 0; row < height; row += strip_rows) {
+        const int rows = std::min(strip_rows, height - row);
+        Window& first = windows[0];
+        const ImageView target = first.rows(first.first + first.count, first.first + first.count + rows,
+                                            width, channels, row_size);
+        source.readRows(target);
+        first.count += rows;
+        ++stats.strips;
+        
+        if (stages.empty()) {
+            sink.writeRows(target);
+            first.first += first.count;
+            first.count = 0;
+        } else {
+            pump(0, pump);
+        }
+    }
+    sink.finish();
+    
+    stats.buffer_bytes = (windows.size() * capacity_rows * row_size) + scratch.size();
+    return stats;
+}
+
+StreamStats FilterPipeline::applyStreaming(const std::string& input_path, const std::string& output_path,
+                                           int strip_rows) const {
+    PnmRowSource source(input_path);
+    PnmRowSink sink(output_path, source.getWidth(), source.getHeight(), source.getChannels());
+    return applyStreaming(source, sink, strip_rows);
+}
+
+const Filter& FilterPipeline::getFilter(size_t index) const {
+    if (index >= filters_.size()) {
+        throw std::out_of_range("Gecersiz filtre indeksi");
+    }
+    return *filters_[index];
 }
 
 std::string FilterPipeline::getFilterName(size_t index) const {
@@ -56,8 +793,13 @@ std::unique_ptr<FilterPipeline> FilterPipeline::clone() const {
     for (const auto& filter : filters_) {
         cloned_pipeline->addFilter(filter->clone());
     }
+    cloned_pipeline->execution_mode_ = execution_mode_;
+    cloned_pipeline->observer_ = observer_;
+    cloned_pipeline->cache_ = cache_;
+    cloned_pipeline->tile_width_ = tile_width_;
+    cloned_pipeline->tile_height_ = tile_height_;
     
     return cloned_pipeline;
 }
 
-} // namespace GorselIsleme
\ No newline at end of file
+} // namespace GorselIsleme
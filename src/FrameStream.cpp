@@ -0,0 +1,339 @@
+#include "FrameStream.h"
+#include "PointOp.h"
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <stdexcept>
+
+namespace GorselIsleme {
+
+namespace {
+
+// Uyumadan once bosa donme sayisi; her turda thread birakilir
+constexpr int kSpinCount = 64;
+
+uint64_t nanosecondsSince(std::chrono::steady_clock::time_point start) {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+}
+
+void copyFrame(const ConstImageView& source, const ImageView& destination) {
+    const size_t row_bytes = source.getRowSize();
+    for (int y = 0; y < source.getHeight(); ++y) {
+        std::copy(source.row(y), source.row(y) + row_bytes, destination.row(y));
+    }
+}
+
+} // namespace
+
+// Tek uretici/tek tuketici halkasi. Yuvalar bastan ayrilir; uretici
+// tail_'i, tuketici head_'i ilerletir, veri yolu kilitsizdir. Bekleyen
+// taraf kisa bir donmeden sonra uyur: waiters_ ve indeksler seq_cst
+// oldugundan ilerleten taraf uyuyani mutlaka gorur (Dekker).
+class FrameStream::Ring {
+public:
+    Ring(size_t capacity, int width, int height, int channels) : capacity_(capacity) {
+        slots_.reserve(capacity);
+        for (size_t i = 0; i < capacity; ++i) {
+            slots_.emplace_back(width, height, channels, Image::Uninitialized);
+        }
+    }
+
+    size_t size() const {
+        // Once head: okunan tail ondan geri kalamaz
+        const uint64_t head = head_.load();
+        return static_cast<size_t>(tail_.load() - head);
+    }
+    size_t getMaxDepth() const { return max_depth_.load(std::memory_order_relaxed); }
+    uint64_t getProduced() const { return tail_.load(std::memory_order_relaxed); }
+    uint64_t getConsumed() const { return head_.load(std::memory_order_relaxed); }
+
+    // Uretici: bos yuva; halka dolu ve wait ise bekler. Kapaliysa nullptr.
+    Image* acquire(bool wait, std::atomic<uint64_t>& stall_ns) {
+        const auto ready = [this]() { return closed_.load() || size() < capacity_; };
+        if (!ready() && (!wait || !block(ready, stall_ns))) {
+            return nullptr;
+        }
+        return closed_.load() ? nullptr : &slots_[tail_.load(std::memory_order_relaxed) % capacity_];
+    }
+
+    void publish() {
+        const uint64_t tail = tail_.load(std::memory_order_relaxed) + 1;
+        tail_.store(tail);
+        const size_t depth = static_cast<size_t>(tail - head_.load());
+        if (depth > max_depth_.load(std::memory_order_relaxed)) {
+            max_depth_.store(depth, std::memory_order_relaxed);
+        }
+        wake();
+    }
+
+    // Tuketici: en eski kare; bossa ve wait ise bekler. Kapanip bosaldiysa
+    // veya iptal edildiyse nullptr.
+    const Image* front(bool wait, std::atomic<uint64_t>& stall_ns) {
+        const auto ready = [this]() { return closed_.load() || size() > 0; };
+        if (!ready() && (!wait || !block(ready, stall_ns))) {
+            return nullptr;
+        }
+        if (aborted_.load() || size() == 0) {
+            return nullptr;
+        }
+        return &slots_[head_.load(std::memory_order_relaxed) % capacity_];
+    }
+
+    void release() {
+        head_.store(head_.load(std::memory_order_relaxed) + 1);
+        wake();
+    }
+
+    // Uretici: kare gelmeyecek; tuketici kalanlari alir
+    void close() {
+        closed_.store(true);
+        wake();
+    }
+
+    // Iki taraf da hemen birakir
+    void abort() {
+        aborted_.store(true);
+        close();
+    }
+
+private:
+    template <typename Ready>
+    bool block(const Ready& ready, std::atomic<uint64_t>& stall_ns) {
+        const auto start = std::chrono::steady_clock::now();
+        for (int spin = 0; spin < kSpinCount && !ready(); ++spin) {
+            std::this_thread::yield();
+        }
+        if (!ready()) {
+            std::unique_lock<std::mutex> lock(mutex_);
+            waiters_.fetch_add(1);
+            condition_.wait(lock, ready);
+            waiters_.fetch_sub(1);
+        }
+        stall_ns.fetch_add(nanosecondsSince(start), std::memory_order_relaxed);
+        return true;
+    }
+
+    void wake() {
+        if (waiters_.load() > 0) {
+            // Kilit: bekleyen ya kosulu henuz kontrol etmedi ya da uyuyor
+            std::lock_guard<std::mutex> lock(mutex_);
+            condition_.notify_all();
+        }
+    }
+
+    std::vector<Image> slots_;
+    const size_t capacity_;
+    alignas(64) std::atomic<uint64_t> head_{0};
+    alignas(64) std::atomic<uint64_t> tail_{0};
+    alignas(64) std::atomic<bool> closed_{false};
+    std::atomic<bool> aborted_{false};
+    std::atomic<int> waiters_{0};
+    std::atomic<size_t> max_depth_{0};
+    std::mutex mutex_;
+    std::condition_variable condition_;
+};
+
+struct FrameStream::Stage {
+    std::unique_ptr<FilterPipeline> pipeline;
+    std::string name;
+    std::thread thread;
+    std::atomic<uint64_t> frames{0};
+    std::atomic<uint64_t> busy_ns{0};
+    std::atomic<uint64_t> input_stall_ns{0};
+    std::atomic<uint64_t> output_stall_ns{0};
+};
+
+FrameStream::FrameStream(const FilterPipeline& pipeline, int width, int height, int channels,
+                         const FrameStreamOptions& options)
+    : width_(width), height_(height), channels_(channels) {
+    if (width <= 0 || height <= 0 || channels <= 0) {
+        throw std::invalid_argument("Gecersiz boyutlar");
+    }
+    if (options.ring_capacity == 0) {
+        throw std::invalid_argument("Halka kapasitesi pozitif olmali");
+    }
+
+    const size_t filter_count = pipeline.getFilterCount();
+    std::vector<size_t> groups = options.stage_groups;
+    if (groups.empty()) {
+        for (size_t i = 0; i < filter_count; ++i) {
+            const bool point_op = dynamic_cast<const PointOp*>(&pipeline.getFilter(i)) != nullptr;
+            const bool previous_point_op =
+                i > 0 && dynamic_cast<const PointOp*>(&pipeline.getFilter(i - 1)) != nullptr;
+            if (point_op && previous_point_op) {
+                ++groups.back();
+            } else {
+                groups.push_back(1);
+            }
+        }
+    } else {
+        size_t total = 0;
+        for (size_t count : groups) {
+            if (count == 0) {
+                throw std::invalid_argument("Bos asama grubu");
+            }
+            total += count;
+        }
+        if (total != filter_count) {
+            throw std::invalid_argument("Asama gruplari filtre sayisiyla uyusmuyor");
+        }
+    }
+
+    size_t first = 0;
+    for (size_t count : groups) {
+        auto stage = std::make_unique<Stage>();
+        stage->pipeline = std::make_unique<FilterPipeline>();
+        for (size_t i = first; i < first + count; ++i) {
+            stage->pipeline->addFilter(pipeline.getFilter(i).clone());
+            stage->name += (i == first ? "" : "+") + pipeline.getFilterName(i);
+        }
+        stage->pipeline->setExecutionMode(pipeline.getExecutionMode());
+        stage->pipeline->setTileSize(pipeline.getTileWidth(), pipeline.getTileHeight());
+        stage->pipeline->prepare(width, height, channels);
+        stages_.push_back(std::move(stage));
+        first += count;
+    }
+    for (size_t i = 0; i <= stages_.size(); ++i) {
+        rings_.push_back(std::make_unique<Ring>(options.ring_capacity, width, height, channels));
+    }
+    for (size_t i = 0; i < stages_.size(); ++i) {
+        stages_[i]->thread = std::thread(&FrameStream::runStage, this, i);
+    }
+}
+
+FrameStream::~FrameStream() {
+    for (auto& ring : rings_) {
+        ring->abort();
+    }
+    for (auto& stage : stages_) {
+        stage->thread.join();
+    }
+}
+
+void FrameStream::runStage(size_t index) {
+    Stage& stage = *stages_[index];
+    Ring& input = *rings_[index];
+    Ring& output = *rings_[index + 1];
+    try {
+        for (;;) {
+            const Image* source = input.front(true, stage.input_stall_ns);
+            if (!source) {
+                break;
+            }
+            Image* target = output.acquire(true, stage.output_stall_ns);
+            if (!target) {
+                break;
+            }
+            const auto start = std::chrono::steady_clock::now();
+            stage.pipeline->apply(*source, *target);
+            stage.busy_ns.fetch_add(nanosecondsSince(start), std::memory_order_relaxed);
+            input.release();
+            output.publish();
+            stage.frames.fetch_add(1, std::memory_order_relaxed);
+        }
+        output.close();
+    } catch (...) {
+        fail(std::current_exception());
+    }
+}
+
+void FrameStream::fail(std::exception_ptr error) {
+    {
+        std::lock_guard<std::mutex> lock(error_mutex_);
+        if (!error_) {
+            error_ = error;
+        }
+    }
+    for (auto& ring : rings_) {
+        ring->abort();
+    }
+}
+
+void FrameStream::rethrowError() {
+    std::lock_guard<std::mutex> lock(error_mutex_);
+    if (error_) {
+        std::rethrow_exception(error_);
+    }
+}
+
+void FrameStream::checkFrame(const Image& frame) const {
+    if (frame.getWidth() != width_ || frame.getHeight() != height_ || frame.getChannels() != channels_) {
+        throw std::invalid_argument("Kare boyutu akisla uyusmuyor");
+    }
+}
+
+void FrameStream::push(const Image& frame) {
+    if (!pushFrame(frame, true)) {
+        throw std::runtime_error("Akis kapatildi");
+    }
+}
+
+bool FrameStream::tryPush(const Image& frame) {
+    return pushFrame(frame, false);
+}
+
+bool FrameStream::pushFrame(const Image& frame, bool wait) {
+    checkFrame(frame);
+    Ring& ring = *rings_.front();
+    Image* slot = ring.acquire(wait, push_stall_ns_);
+    if (!slot) {
+        rethrowError();
+        return false;
+    }
+    copyFrame(frame.view(), slot->view());
+    ring.publish();
+    return true;
+}
+
+void FrameStream::close() {
+    rings_.front()->close();
+}
+
+bool FrameStream::pop(Image& output) {
+    return popFrame(output, true);
+}
+
+bool FrameStream::tryPop(Image& output) {
+    return popFrame(output, false);
+}
+
+bool FrameStream::popFrame(Image& output, bool wait) {
+    Ring& ring = *rings_.back();
+    const Image* result = ring.front(wait, pop_stall_ns_);
+    if (!result) {
+        rethrowError();
+        return false;
+    }
+    if (output.getWidth() != width_ || output.getHeight() != height_ || output.getChannels() != channels_) {
+        output = Image(width_, height_, channels_, Image::Uninitialized, output.getLayout());
+    }
+    copyFrame(result->view(), output.view());
+    ring.release();
+    return true;
+}
+
+FrameStreamStats FrameStream::getStats() const {
+    FrameStreamStats stats;
+    for (size_t i = 0; i < stages_.size(); ++i) {
+        const Stage& stage = *stages_[i];
+        FrameStageStats entry;
+        entry.name = stage.name;
+        entry.frames = stage.frames.load(std::memory_order_relaxed);
+        entry.busy_ms = stage.busy_ns.load(std::memory_order_relaxed) / 1e6;
+        entry.input_stall_ms = stage.input_stall_ns.load(std::memory_order_relaxed) / 1e6;
+        entry.output_stall_ms = stage.output_stall_ns.load(std::memory_order_relaxed) / 1e6;
+        entry.input_depth = rings_[i]->size();
+        entry.max_input_depth = rings_[i]->getMaxDepth();
+        stats.stages.push_back(entry);
+    }
+    stats.frames_in = rings_.front()->getProduced();
+    stats.frames_out = rings_.back()->getConsumed();
+    stats.push_stall_ms = push_stall_ns_.load(std::memory_order_relaxed) / 1e6;
+    stats.pop_stall_ms = pop_stall_ns_.load(std::memory_order_relaxed) / 1e6;
+    stats.output_depth = rings_.back()->size();
+    stats.max_output_depth = rings_.back()->getMaxDepth();
+    return stats;
+}
+
+} // namespace GorselIsleme
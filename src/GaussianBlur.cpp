@@ -1,59 +1,300 @@
 #include "GaussianBlur.h"
+#include "Border.h"
+#include "KernelCore.h"
+#include "Scratch.h"
+#include "Simd.h"
+#include "ThreadPool.h"
 #include <cmath>
+#include <cstdio>
 #include <algorithm>
 #include <stdexcept>
 
 namespace GorselIsleme {
 
-GaussianBlur::GaussianBlur(double sigma, int kernel_size)
-    : sigma_(sigma), kernel_size_(kernel_size) {
+namespace {
+
+// Yatay gecis sonucu 8 kesir bitiyle 16 bitte tutulur (255 << 8 sigar)
+constexpr int kTempBits = 8;
+constexpr int kHorizontalShift = GaussianBlur::kWeightBits - kTempBits;
+constexpr int kVerticalShift = GaussianBlur::kWeightBits + kTempBits;
+
+constexpr int kBoxPasses = 3;
+
+// ScratchBuffer etiketleri
+struct BandTempTag;
+struct AccumulatorTag;
+struct LineTag;
+struct PlaneTag;
+struct ConstantRowTag;
+
+// Kutu gecislerinin kenar modu; deger 8 kesir bitli
+struct BoxBorder {
+    Filter::BorderMode mode;
+    uint16_t value;
+};
+
+inline uint16_t roundedMean(uint32_t sum, uint32_t count, const uint64_t* reciprocals) {
+    return static_cast<uint16_t>(((uint64_t(sum) + count / 2) * reciprocals[count]) >> 32);
+}
+
+// Tek satir/sutun uzerinde kayan toplamli kutu ortalamasi. Renormalize'da
+// kenarda yalnizca gecerli ornekler sayilir (Exact moddaki normalize
+// davranisi ile ayni); diger modlarda pencere hep 2r + 1 ornektir ve yalnizca
+// kenara degen adimlar eslemeden gecer.
+void boxPassLine(const uint16_t* src, uint16_t* dst, int length, int step, int radius,
+                 const uint64_t* reciprocals, const BoxBorder& border) {
+    if (border.mode != Filter::Renormalize) {
+        const auto sample = [&](int i) -> uint32_t {
+            const int index = borderIndex(i, length, border.mode);
+            return index < 0 ? border.value : src[index * step];
+        };
+        const uint32_t count = 2 * radius + 1;
+        uint32_t sum = 0;
+        for (int i = -radius; i <= radius; ++i) {
+            sum += sample(i);
+        }
+        const int inner_begin = std::min(radius, length);
+        const int inner_end = std::max(inner_begin, length - radius - 1);
+        int x = 0;
+        for (; x < inner_begin; ++x) {
+            dst[x * step] = roundedMean(sum, count, reciprocals);
+            sum += sample(x + radius + 1);
+            sum -= sample(x - radius);
+        }
+        for (; x < inner_end; ++x) {
+            dst[x * step] = roundedMean(sum, count, reciprocals);
+            sum += src[(x + radius + 1) * step];
+            sum -= src[(x - radius) * step];
+        }
+        for (; x < length; ++x) {
+            dst[x * step] = roundedMean(sum, count, reciprocals);
+            sum += sample(x + radius + 1);
+            sum -= sample(x - radius);
+        }
+        return;
+    }
+
+    uint32_t sum = 0;
+    int lo = 0;
+    int hi = std::min(radius, length - 1);
+    for (int i = 0; i <= hi; ++i) {
+        sum += src[i * step];
+    }
+    for (int x = 0; x < length; ++x) {
+        dst[x * step] = roundedMean(sum, hi - lo + 1, reciprocals);
+        if (x + radius + 1 < length) {
+            sum += src[(x + radius + 1) * step];
+            ++hi;
+        }
+        if (x - radius >= 0) {
+            sum -= src[(x - radius) * step];
+            ++lo;
+        }
+    }
+}
+
+// Satir vektorleri uzerinde dikey kutu gecisi; ic dongu vektorlesir
+// Sutun araligi [column_begin, column_end) bagimsiz islenir; paralel bolunebilir
+void boxPassVertical(const uint16_t* src, uint16_t* dst, int height, size_t row_size,
+                     size_t column_begin, size_t column_end, int radius, const uint64_t* reciprocals,
+                     const BoxBorder& border) {
+    const size_t columns = column_end - column_begin;
+    ScratchBuffer<uint32_t, AccumulatorTag> acc_buffer(columns);
+    uint32_t* acc = acc_buffer.data();
+    std::fill(acc, acc + columns, 0u);
+    src += column_begin;
+    dst += column_begin;
+
+    if (border.mode != Filter::Renormalize) {
+        // Kenar modu satir isaretcisi seciminde uygulanir; ic donguler kontrolsuz
+        const size_t constant_columns = border.mode == Filter::Constant ? columns : 0;
+        ScratchBuffer<uint16_t, ConstantRowTag> constant_row(constant_columns);
+        std::fill(constant_row.data(), constant_row.data() + constant_columns, border.value);
+        const auto rowAt = [&](int y) {
+            const int index = borderIndex(y, height, border.mode);
+            return index < 0 ? constant_row.data() : src + index * row_size;
+        };
+        const uint32_t count = 2 * radius + 1;
+        const uint64_t reciprocal = reciprocals[count];
+        for (int y = -radius; y <= radius; ++y) {
+            const uint16_t* row = rowAt(y);
+            for (size_t i = 0; i < columns; ++i) {
+                acc[i] += row[i];
+            }
+        }
+        for (int y = 0; y < height; ++y) {
+            uint16_t* out = dst + y * row_size;
+            for (size_t i = 0; i < columns; ++i) {
+                out[i] = static_cast<uint16_t>(((uint64_t(acc[i]) + count / 2) * reciprocal) >> 32);
+            }
+            const uint16_t* added = rowAt(y + radius + 1);
+            const uint16_t* removed = rowAt(y - radius);
+            for (size_t i = 0; i < columns; ++i) {
+                acc[i] += added[i] - removed[i];
+            }
+        }
+        return;
+    }
+
+    int lo = 0;
+    int hi = std::min(radius, height - 1);
+    for (int y = 0; y <= hi; ++y) {
+        const uint16_t* row = src + y * row_size;
+        for (size_t i = 0; i < columns; ++i) {
+            acc[i] += row[i];
+        }
+    }
+    for (int y = 0; y < height; ++y) {
+        const uint32_t count = hi - lo + 1;
+        const uint64_t reciprocal = reciprocals[count];
+        uint16_t* out = dst + y * row_size;
+        for (size_t i = 0; i < columns; ++i) {
+            out[i] = static_cast<uint16_t>(((uint64_t(acc[i]) + count / 2) * reciprocal) >> 32);
+        }
+        if (y + radius + 1 < height) {
+            const uint16_t* row = src + (y + radius + 1) * row_size;
+            for (size_t i = 0; i < columns; ++i) {
+                acc[i] += row[i];
+            }
+            ++hi;
+        }
+        if (y - radius >= 0) {
+            const uint16_t* row = src + (y - radius) * row_size;
+            for (size_t i = 0; i < columns; ++i) {
+                acc[i] -= row[i];
+            }
+            ++lo;
+        }
+    }
+}
+
+// Ic sutunlarin yatay tap'leri, yaricap ve kanal derleme zamani sabiti.
+// Agirliklar simetrik (w[r - k] == w[r + k]); esler tek carpimla toplanir,
+// toplam yazmacta kalir ve dongu acilip vektorlesir. Agirliklar (<= 1 << 14)
+// ve piksel ciftleri 16 bite sigdigindan carpim 16x16 -> 32 genisletmedir.
+template <int Radius, int Channels>
+GORSEL_INLINE void horizontalTaps(const Image::Pixel* src, const int32_t* weights, uint16_t* dst, size_t begin,
+                                  size_t end) {
+    uint16_t w[Radius + 1];
+    for (int k = 0; k <= Radius; ++k) {
+        w[k] = static_cast<uint16_t>(weights[Radius + k]);
+    }
+    for (size_t i = begin; i < end; ++i) {
+        uint32_t sum = uint32_t(w[0]) * uint16_t(src[i]);
+        for (int k = 1; k <= Radius; ++k) {
+            const uint16_t pair = static_cast<uint16_t>(src[i - k * Channels] + src[i + k * Channels]);
+            sum += uint32_t(w[k]) * pair;
+        }
+        dst[i] = static_cast<uint16_t>((sum + (1u << (kHorizontalShift - 1))) >> kHorizontalShift);
+    }
+}
+
+// Ic satirlarin dikey tap'leri; rows[k] = temp satiri y + k - Radius
+template <int Radius>
+GORSEL_INLINE void verticalTaps(const uint16_t* const* rows, const int32_t* weights, Image::Pixel* dst,
+                                size_t count) {
+    uint16_t w[Radius + 1];
+    const uint16_t* above[Radius + 1];
+    const uint16_t* below[Radius + 1];
+    for (int k = 0; k <= Radius; ++k) {
+        w[k] = static_cast<uint16_t>(weights[Radius + k]);
+        above[k] = rows[Radius - k];
+        below[k] = rows[Radius + k];
+    }
+    for (size_t i = 0; i < count; ++i) {
+        uint32_t sum = uint32_t(w[0]) * above[0][i];
+        for (int k = 1; k <= Radius; ++k) {
+            sum += uint32_t(w[k]) * above[k][i] + uint32_t(w[k]) * below[k][i];
+        }
+        dst[i] = static_cast<Image::Pixel>((sum + (1u << (kVerticalShift - 1))) >> kVerticalShift);
+    }
+}
+
+#if GORSEL_X86_SIMD
+// Ayni cekirdekler AVX2 ile derlenir (16 lane); CPU destekliyorsa secilir
+template <int Radius, int Channels>
+GORSEL_TARGET("avx2")
+void horizontalTapsAvx2(const Image::Pixel* src, const int32_t* weights, uint16_t* dst, size_t begin, size_t end) {
+    horizontalTaps<Radius, Channels>(src, weights, dst, begin, end);
+}
+
+template <int Radius>
+GORSEL_TARGET("avx2")
+void verticalTapsAvx2(const uint16_t* const* rows, const int32_t* weights, Image::Pixel* dst, size_t count) {
+    verticalTaps<Radius>(rows, weights, dst, count);
+}
+#endif
+
+} // namespace
+
+GaussianBlur::GaussianBlur(double sigma, int kernel_size, Mode mode)
+    : sigma_(sigma), kernel_size_(kernel_size), mode_(mode) {
     if (sigma <= 0 || kernel_size <= 0 || kernel_size % 2 == 0) {
         throw std::invalid_argument("Gecersiz parametreler");
     }
     generateKernel();
 }
 
-std::unique_ptr<Image> GaussianBlur::apply(const Image& input) const {
-    auto output = std::make_unique<Image>(input.getWidth(), input.getHeight(), input.getChannels());
-    
-    int half_kernel = kernel_size_ / 2;
-    
-    for (int y = 0; y < input.getHeight(); ++y) {
-        for (int x = 0; x < input.getWidth(); ++x) {
-            for (int channel = 0; channel < input.getChannels(); ++channel) {
-                double sum = 0.0;
-                double weight_sum = 0.0;
-                
-                for (int ky = -half_kernel; ky <= half_kernel; ++ky) {
-                    for (int kx = -half_kernel; kx <= half_kernel; ++kx) {
-                        int nx = x + kx;
-                        int ny = y + ky;
-                        
-                        if (nx >= 0 && nx < input.getWidth() && 
-                            ny >= 0 && ny < input.getHeight()) {
-                            
-                            double weight = kernel_[ky + half_kernel][kx + half_kernel];
-                            sum += input.at(nx, ny, channel) * weight;
-                            weight_sum += weight;
-                        }
-                    }
-                }
-                
-                if (weight_sum > 0) {
-                    output->at(x, y, channel) = static_cast<Image::Pixel>(
-                        std::min(255.0, std::max(0.0, sum / weight_sum)));
-                }
-            }
-        }
+void GaussianBlur::apply(const ConstImageView& input, const ImageView& output) const {
+    checkViews(input, output);
+
+    if (usesStackedBox()) {
+        applyStackedBox(input, output);
+        return;
+    }
+
+    // Her bant yatay gecisi kendi halo satirlariyla ([y0 - r, y1 + r)) yapar;
+    // satir sonuclari banttan bagimsiz oldugu icin cikti seri yolla ayni.
+    // Renormalize disindaki modlarda goruntu disindaki halo satirlari da
+    // kenar moduna gore doldurulur ve dikey gecis hep tam kernel kullanir.
+    const int height = input.getHeight();
+    const int half_kernel = kernel_size_ / 2;
+    const bool renormalize = border_mode_ == Renormalize;
+    ThreadPool::global().parallelRows(height, input.getRowSize(), [&](int y_begin, int y_end) {
+        const int temp_begin = renormalize ? std::max(0, y_begin - half_kernel) : y_begin - half_kernel;
+        const int temp_end = renormalize ? std::min(height, y_end + half_kernel) : y_end + half_kernel;
+        ScratchBuffer<uint16_t, BandTempTag> temp(input.getRowSize() * (temp_end - temp_begin));
+        horizontalPass(input, temp.data(), temp_begin, temp_end);
+        verticalPass(temp.data(), temp_begin, output, y_begin, y_end);
+    }, 8 * kernel_size_);
+}
+
+bool GaussianBlur::usesStackedBox() const {
+    if (mode_ != Auto) {
+        return mode_ == StackedBox;
     }
-    
-    return output;
+    return sigma_ >= kAutoSigmaThreshold && kernel_size_ / 2 >= 3.0 * sigma_;
+}
+
+int GaussianBlur::getRadius() const {
+    if (!usesStackedBox()) {
+        return kernel_size_ / 2;
+    }
+    // Ardisik kutu gecislerinin yaricaplari toplanir
+    int radius = 0;
+    for (int box_radius : box_radii_) {
+        radius += box_radius;
+    }
+    return radius;
 }
 
 std::unique_ptr<Filter> GaussianBlur::clone() const {
     return std::make_unique<GaussianBlur>(*this);
 }
 
+std::string GaussianBlur::getFingerprint() const {
+    // Auto cozulmus yol yazilir; sigma tam (onaltilik) gosterimle
+    char buffer[128];
+    std::snprintf(buffer, sizeof(buffer), "GaussianBlur:%a:%d:%s:%d:%d", sigma_, kernel_size_,
+                  usesStackedBox() ? "box" : "exact", static_cast<int>(border_mode_), static_cast<int>(border_value_));
+    return buffer;
+}
+
+void GaussianBlur::setBorderMode(BorderMode mode, Image::Pixel value) {
+    border_mode_ = mode;
+    border_value_ = value;
+}
+
 void GaussianBlur::setSigma(double sigma) {
     if (sigma <= 0) {
         throw std::invalid_argument("Sigma pozitif olmali");
@@ -71,30 +312,283 @@ void GaussianBlur::setKernelSize(int size) {
 }
 
 void GaussianBlur::generateKernel() {
-    kernel_.assign(kernel_size_, std::vector<double>(kernel_size_, 0.0));
-    
+    // 2D Gauss ayrilabilir; normalize 1D kernel 2D kernelin satir toplamlarina esittir
+    kernel_.assign(kernel_size_, 0.0);
+
     int half_kernel = kernel_size_ / 2;
     double sum = 0.0;
-    
-    for (int y = 0; y < kernel_size_; ++y) {
-        for (int x = 0; x < kernel_size_; ++x) {
-            double dx = x - half_kernel;
-            double dy = y - half_kernel;
-            kernel_[y][x] = gaussianFunction(dx, dy);
-            sum += kernel_[y][x];
+
+    for (int i = 0; i < kernel_size_; ++i) {
+        kernel_[i] = gaussianFunction(i - half_kernel);
+        sum += kernel_[i];
+    }
+
+    for (auto& value : kernel_) {
+        value /= sum;
+    }
+
+    generateWeights();
+    generateBoxRadii();
+}
+
+void GaussianBlur::generateWeights() {
+    const int32_t one = 1 << kWeightBits;
+    weights_.assign(kernel_size_, 0);
+
+    int32_t total = 0;
+    for (int i = 0; i < kernel_size_; ++i) {
+        weights_[i] = static_cast<int32_t>(std::lround(kernel_[i] * one));
+        total += weights_[i];
+    }
+
+    // Yuvarlama hatasini merkeze ekle, toplam tam olarak 1.0 olsun
+    weights_[kernel_size_ / 2] += one - total;
+}
+
+void GaussianBlur::generateBoxRadii() {
+    // Kesilmis kernelin gercek varyansi; kutular buna esitlenir, boylece
+    // kucuk kernel_size_ ile verilen buyuk sigma da dogru yaklasiklanir
+    int half_kernel = kernel_size_ / 2;
+    double variance = 0.0;
+    for (int i = 0; i < kernel_size_; ++i) {
+        variance += kernel_[i] * (i - half_kernel) * (i - half_kernel);
+    }
+
+    // n kutunun varyans toplami: sum((w^2 - 1) / 12) = variance
+    double ideal_width = std::sqrt(12.0 * variance / kBoxPasses + 1.0);
+    int lower = static_cast<int>(std::floor(ideal_width));
+    if (lower % 2 == 0) {
+        --lower;
+    }
+    lower = std::max(lower, 1);
+    int upper = lower + 2;
+    int lower_count = static_cast<int>(std::lround(
+        (12.0 * variance - kBoxPasses * lower * lower - 4.0 * kBoxPasses * lower - 3.0 * kBoxPasses) /
+        (-4.0 * lower - 4.0)));
+    lower_count = std::min(std::max(lower_count, 0), kBoxPasses);
+
+    box_radii_.clear();
+    for (int i = 0; i < kBoxPasses; ++i) {
+        box_radii_.push_back((i < lower_count ? lower : upper) / 2);
+    }
+
+    // count -> ceil(2^32 / count); bolme yerine carpma ile yuvarlanmis ortalama
+    // En genis kutu upper ornek sayar
+    reciprocals_.assign(upper + 1, 0);
+    for (int count = 1; count <= upper; ++count) {
+        reciprocals_[count] = ((uint64_t(1) << 32) + count - 1) / count;
+    }
+}
+
+double GaussianBlur::gaussianFunction(double x) const {
+    // Normalizasyon generateKernel'de yapilir
+    return std::exp(-(x * x) / (2.0 * sigma_ * sigma_));
+}
+
+void GaussianBlur::horizontalPass(const ConstImageView& input, uint16_t* temp,
+                                  int y_begin, int y_end) const {
+    const int width = input.getWidth();
+    const int channels = input.getChannels();
+    const int half_kernel = kernel_size_ / 2;
+    const size_t row_size = static_cast<size_t>(width) * channels;
+
+    // Kenarlara degmeyen sutun araligi; burada sinir kontrolu gerekmez
+    const int inner_begin = std::min(half_kernel, width);
+    const int inner_end = std::max(inner_begin, width - half_kernel);
+
+    ScratchBuffer<uint32_t, AccumulatorTag> acc(row_size);
+
+    for (int y = y_begin; y < y_end; ++y) {
+        uint16_t* dst = temp + (y - y_begin) * row_size;
+        const int source_row = borderIndex(y, input.getHeight(), border_mode_);
+        if (source_row < 0) {
+            // Constant: sabit satirin yatay gecisi yine sabittir
+            std::fill(dst, dst + row_size, static_cast<uint16_t>(border_value_ << kTempBits));
+            continue;
+        }
+        const Image::Pixel* src = input.row(source_row);
+
+        const size_t begin = static_cast<size_t>(inner_begin) * channels;
+        const size_t end = static_cast<size_t>(inner_end) * channels;
+        const bool specialized = kernels::withRadiusAndChannels(half_kernel, channels, [&](auto radius, auto step) {
+#if GORSEL_X86_SIMD
+            if (simd::hasAvx2()) {
+                horizontalTapsAvx2<radius(), step()>(src, weights_.data(), dst, begin, end);
+                return;
+            }
+#endif
+            horizontalTaps<radius(), step()>(src, weights_.data(), dst, begin, end);
+        });
+        if (!specialized) {
+            std::fill(acc.data() + begin, acc.data() + end, 0u);
+            for (int k = 0; k < kernel_size_; ++k) {
+                const uint32_t w = static_cast<uint32_t>(weights_[k]);
+                const Image::Pixel* tap = src + (k - half_kernel) * channels;
+                for (size_t i = begin; i < end; ++i) {
+                    acc[i] += w * tap[i];
+                }
+            }
+            for (size_t i = begin; i < end; ++i) {
+                dst[i] = static_cast<uint16_t>((acc[i] + (1u << (kHorizontalShift - 1))) >> kHorizontalShift);
+            }
+        }
+
+        // Kenar sutunlari: Renormalize'da yalnizca gecerli tap'ler, agirlik
+        // toplamina gore normalize; diger modlarda tap konumu eslenir
+        for (int x = 0; x < width; ++x) {
+            if (x == inner_begin) {
+                x = inner_end;
+                if (x >= width) {
+                    break;
+                }
+            }
+            if (border_mode_ != Renormalize) {
+                for (int channel = 0; channel < channels; ++channel) {
+                    uint32_t sum = 0;
+                    for (int k = 0; k < kernel_size_; ++k) {
+                        const int column = borderIndex(x + k - half_kernel, width, border_mode_);
+                        const uint32_t value = column < 0 ? border_value_ : src[column * channels + channel];
+                        sum += static_cast<uint32_t>(weights_[k]) * value;
+                    }
+                    dst[x * channels + channel] =
+                        static_cast<uint16_t>((sum + (1u << (kHorizontalShift - 1))) >> kHorizontalShift);
+                }
+                continue;
+            }
+            const int k_begin = std::max(0, half_kernel - x);
+            const int k_end = std::min(kernel_size_, width - x + half_kernel);
+            uint64_t weight_sum = 0;
+            for (int k = k_begin; k < k_end; ++k) {
+                weight_sum += weights_[k];
+            }
+            for (int channel = 0; channel < channels; ++channel) {
+                uint64_t sum = 0;
+                for (int k = k_begin; k < k_end; ++k) {
+                    sum += static_cast<uint64_t>(weights_[k]) *
+                           src[(x + k - half_kernel) * channels + channel];
+                }
+                dst[x * channels + channel] = static_cast<uint16_t>(
+                    ((sum << kTempBits) + weight_sum / 2) / weight_sum);
+            }
         }
     }
-    
-    for (auto& row : kernel_) {
-        for (auto& value : row) {
-            value /= sum;
+}
+
+void GaussianBlur::verticalPass(const uint16_t* temp, int temp_begin,
+                                const ImageView& output, int y_begin, int y_end) const {
+    const int width = output.getWidth();
+    const int height = output.getHeight();
+    const int channels = output.getChannels();
+    const int half_kernel = kernel_size_ / 2;
+    const size_t row_size = static_cast<size_t>(width) * channels;
+
+    ScratchBuffer<uint32_t, AccumulatorTag> acc(row_size);
+
+    const bool renormalize = border_mode_ == Renormalize;
+    for (int y = y_begin; y < y_end; ++y) {
+        const int k_begin = renormalize ? std::max(0, half_kernel - y) : 0;
+        const int k_end = renormalize ? std::min(kernel_size_, height - y + half_kernel) : kernel_size_;
+        const bool inner = (k_begin == 0 && k_end == kernel_size_);
+        Image::Pixel* dst = output.row(y);
+
+        if (inner && half_kernel <= kernels::kMaxSpecializedRadius) {
+            const uint16_t* rows[2 * kernels::kMaxSpecializedRadius + 1];
+            for (int k = 0; k < kernel_size_; ++k) {
+                rows[k] = temp + (y + k - half_kernel - temp_begin) * row_size;
+            }
+            const bool specialized = kernels::withRadius(half_kernel, [&](auto radius) {
+#if GORSEL_X86_SIMD
+                if (simd::hasAvx2()) {
+                    verticalTapsAvx2<radius()>(rows, weights_.data(), dst, row_size);
+                    return;
+                }
+#endif
+                verticalTaps<radius()>(rows, weights_.data(), dst, row_size);
+            });
+            if (specialized) {
+                continue;
+            }
+        }
+
+        std::fill(acc.data(), acc.data() + row_size, 0u);
+        uint64_t weight_sum = 0;
+        for (int k = k_begin; k < k_end; ++k) {
+            const uint32_t w = static_cast<uint32_t>(weights_[k]);
+            const uint16_t* tap = temp + (y + k - half_kernel - temp_begin) * row_size;
+            for (size_t i = 0; i < row_size; ++i) {
+                acc[i] += w * tap[i];
+            }
+            weight_sum += w;
+        }
+
+        if (inner) {
+            for (size_t i = 0; i < row_size; ++i) {
+                dst[i] = static_cast<Image::Pixel>((acc[i] + (1u << (kVerticalShift - 1))) >> kVerticalShift);
+            }
+        } else {
+            const uint64_t divisor = weight_sum << kTempBits;
+            for (size_t i = 0; i < row_size; ++i) {
+                dst[i] = static_cast<Image::Pixel>((acc[i] + divisor / 2) / divisor);
+            }
         }
     }
 }
 
-double GaussianBlur::gaussianFunction(double x, double y) const {
-    double exponent = -(x * x + y * y) / (2.0 * sigma_ * sigma_);
-    return std::exp(exponent) / (2.0 * M_PI * sigma_ * sigma_);
+void GaussianBlur::applyStackedBox(const ConstImageView& input, const ImageView& output) const {
+    const int width = input.getWidth();
+    const int height = input.getHeight();
+    const int channels = input.getChannels();
+    const size_t row_size = static_cast<size_t>(width) * channels;
+
+    const size_t plane_size = row_size * height;
+    ScratchBuffer<uint16_t, PlaneTag> planes(2 * plane_size);
+    uint16_t* front = planes.data();
+    uint16_t* back = planes.data() + plane_size;
+
+    ThreadPool& pool = ThreadPool::global();
+    const BoxBorder border{border_mode_, static_cast<uint16_t>(border_value_ << kTempBits)};
+
+    // Yatay gecisler satir basina iki satirlik tamponda yapilir
+    pool.parallelRows(height, row_size, [&](int y_begin, int y_end) {
+        ScratchBuffer<uint16_t, LineTag> lines(2 * row_size);
+        uint16_t* line_a = lines.data();
+        uint16_t* line_b = lines.data() + row_size;
+        for (int y = y_begin; y < y_end; ++y) {
+            const Image::Pixel* src = input.row(y);
+            for (size_t i = 0; i < row_size; ++i) {
+                line_a[i] = static_cast<uint16_t>(src[i] << kTempBits);
+            }
+            for (int pass = 0; pass < kBoxPasses; ++pass) {
+                uint16_t* dst = (pass == kBoxPasses - 1) ? front + y * row_size : line_b;
+                for (int channel = 0; channel < channels; ++channel) {
+                    boxPassLine(line_a + channel, dst + channel, width, channels,
+                                box_radii_[pass], reciprocals_.data(), border);
+                }
+                std::swap(line_a, line_b);
+            }
+        }
+    });
+
+    // Dikey gecisler sutun gruplarina bolunur
+    const int column_grain = static_cast<int>(std::max<size_t>(
+        64, row_size / (pool.getThreadCount() * 4) + 1));
+    for (int pass = 0; pass < kBoxPasses; ++pass) {
+        pool.parallelFor(0, static_cast<int>(row_size), column_grain, [&](int column_begin, int column_end) {
+            boxPassVertical(front, back, height, row_size, column_begin, column_end,
+                            box_radii_[pass], reciprocals_.data(), border);
+        });
+        std::swap(front, back);
+    }
+
+    pool.parallelRows(height, row_size, [&](int y_begin, int y_end) {
+        for (int y = y_begin; y < y_end; ++y) {
+            const uint16_t* src = front + y * row_size;
+            Image::Pixel* dst = output.row(y);
+            for (size_t i = 0; i < row_size; ++i) {
+                dst[i] = static_cast<Image::Pixel>((src[i] + (1u << (kTempBits - 1))) >> kTempBits);
+            }
+        }
+    });
 }
 
-} // namespace GorselIsleme
\ No newline at end of file
+} // namespace GorselIsleme
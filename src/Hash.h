@@ -0,0 +1,67 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// Dahili 64 bit icerik ozeti (onbellek anahtarlari). Kriptografik degildir;
+// rastgele olmayan veride carpisma olasiligi ~2^-64. Dort bagimsiz serit
+// bellek bant genisligine yakin hizda calisir.
+
+namespace GorselIsleme {
+
+namespace hash {
+
+constexpr uint64_t kPrime1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t kPrime2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint64_t kPrime3 = 0x165667B19E3779F9ULL;
+
+inline uint64_t rotl(uint64_t value, int bits) {
+    return (value << bits) | (value >> (64 - bits));
+}
+
+inline uint64_t step(uint64_t accumulator, uint64_t word) {
+    return rotl(accumulator + word * kPrime2, 31) * kPrime1;
+}
+
+inline uint64_t load64(const unsigned char* bytes) {
+    uint64_t word;
+    std::memcpy(&word, bytes, sizeof(word));
+    return word;
+}
+
+// Son karistirma: tum bitler tum cikti bitlerini etkiler
+inline uint64_t mix(uint64_t value) {
+    value ^= value >> 33;
+    value *= kPrime2;
+    value ^= value >> 29;
+    value *= kPrime3;
+    value ^= value >> 32;
+    return value;
+}
+
+inline uint64_t combine(uint64_t seed, uint64_t value) {
+    return mix(seed ^ (value + kPrime1 + (seed << 6) + (seed >> 2)));
+}
+
+inline uint64_t bytes(const void* data, size_t size, uint64_t seed = 0) {
+    const unsigned char* input = static_cast<const unsigned char*>(data);
+    uint64_t lanes[4] = {seed + kPrime1 + kPrime2, seed + kPrime2, seed, seed - kPrime1};
+    size_t offset = 0;
+    for (; offset + 32 <= size; offset += 32) {
+        for (int lane = 0; lane < 4; ++lane) {
+            lanes[lane] = step(lanes[lane], load64(input + offset + 8 * lane));
+        }
+    }
+    uint64_t result = rotl(lanes[0], 1) + rotl(lanes[1], 7) + rotl(lanes[2], 12) + rotl(lanes[3], 18);
+    for (; offset + 8 <= size; offset += 8) {
+        result = rotl(result ^ step(0, load64(input + offset)), 27) * kPrime1 + kPrime3;
+    }
+    for (; offset < size; ++offset) {
+        result = rotl(result ^ (input[offset] * kPrime3), 11) * kPrime1;
+    }
+    return mix(result + size);
+}
+
+} // namespace hash
+
+} // namespace GorselIsleme
@@ -1,23 +1,52 @@
 #include "Image.h"
+#include "JpegDecoder.h"
+#include "PnmFormat.h"
 #include <fstream>
 #include <cmath>
 #include <stdexcept>
-#include <cstdlib>
-#include <sstream>
+#include <algorithm>
 
 namespace GorselIsleme {
 
 Image::Image(int width, int height, int channels)
-    : width_(width), height_(height), channels_(channels) {
+    : Image(width, height, channels, Zeroed) {
+}
+
+Image::Image(int width, int height, int channels, Initialization init, Layout layout)
+    : width_(width), height_(height), channels_(channels), layout_(layout) {
     if (width <= 0 || height <= 0 || channels <= 0) {
         throw std::invalid_argument("Gecersiz boyutlar");
     }
-    data_.resize(width * height * channels, 0);
+    
+    const size_t row_size = static_cast<size_t>(width) * channels;
+    const size_t stride = layout == PaddedRows
+        ? (row_size + BufferPool::kAlignment - 1) / BufferPool::kAlignment * BufferPool::kAlignment
+        : row_size;
+    stride_ = static_cast<std::ptrdiff_t>(stride);
+    
+    if (init == Zeroed) {
+        data_.resize(stride * height, 0);
+        return;
+    }
+    data_.resize(stride * height);
+    if (stride != row_size) {
+        for (int y = 0; y < height; ++y) {
+            std::fill(data_.data() + y * stride + row_size, data_.data() + (y + 1) * stride, 0);
+        }
+    }
+}
+
+Image::Image(const ConstImageView& view, Layout layout)
+    : Image(view.getWidth(), view.getHeight(), view.getChannels(), Uninitialized, layout) {
+    const size_t row_size = view.getRowSize();
+    for (int y = 0; y < height_; ++y) {
+        std::copy(view.row(y), view.row(y) + row_size, data_.data() + y * stride_);
+    }
 }
 
 Image::Image(const Image& other)
-    : width_(other.width_), height_(other.height_), 
-      channels_(other.channels_), data_(other.data_) {
+    : width_(other.width_), height_(other.height_), channels_(other.channels_),
+      layout_(other.layout_), stride_(other.stride_), data_(other.data_) {
 }
 
 Image& Image::operator=(const Image& other) {
@@ -25,11 +54,36 @@ Image& Image::operator=(const Image& other) {
         width_ = other.width_;
         height_ = other.height_;
         channels_ = other.channels_;
+        layout_ = other.layout_;
+        stride_ = other.stride_;
         data_ = other.data_;
     }
     return *this;
 }
 
+Image::Image(Image&& other) noexcept
+    : width_(other.width_), height_(other.height_), channels_(other.channels_),
+      layout_(other.layout_), stride_(other.stride_), data_(std::move(other.data_)) {
+    other.width_ = other.height_ = 0;
+    other.stride_ = 0;
+    other.data_.clear();
+}
+
+Image& Image::operator=(Image&& other) noexcept {
+    if (this != &other) {
+        width_ = other.width_;
+        height_ = other.height_;
+        channels_ = other.channels_;
+        layout_ = other.layout_;
+        stride_ = other.stride_;
+        data_ = std::move(other.data_);
+        other.width_ = other.height_ = 0;
+        other.stride_ = 0;
+        other.data_.clear();
+    }
+    return *this;
+}
+
 Image::Pixel& Image::at(int x, int y, int channel) {
     if (!isValidCoordinate(x, y, channel)) {
         throw std::out_of_range("Gecersiz koordinatlar");
@@ -44,65 +98,57 @@ const Image::Pixel& Image::at(int x, int y, int channel) const {
     return data_[calculateIndex(x, y, channel)];
 }
 
+ImageView Image::view() {
+    return ImageView(data_.data(), width_, height_, channels_, stride_);
+}
+
+ConstImageView Image::view() const {
+    return ConstImageView(data_.data(), width_, height_, channels_, stride_);
+}
+
+ImageView Image::view(int x, int y, int width, int height) {
+    return view().subView(x, y, width, height);
+}
+
+ConstImageView Image::view(int x, int y, int width, int height) const {
+    return view().subView(x, y, width, height);
+}
+
 bool Image::save(const std::string& filename) const {
-    std::ofstream file(filename, std::ios::binary);
-    if (!file.is_open()) {
-        return false;
-    }
-    
-    file << "P5\n" << width_ << " " << height_ << "\n255\n";
-    file.write(reinterpret_cast<const char*>(data_.data()), data_.size());
-    
-    return file.good();
+    // 1 kanal P5, 3 kanal P6; baslik ve veri tek writev ile yazilir
+    return !empty() && writePnmFile(filename, view());
 }
 
 std::unique_ptr<Image> Image::load(const std::string& filename) {
     std::ifstream file(filename, std::ios::binary);
-    if (!file.is_open()) {
+    PnmHeader header;
+    if (!file.is_open() || !readPnmHeader(file, header)) {
         return nullptr;
     }
     
-    std::string format;
-    file >> format;
-    if (format != "P5") {
-        return nullptr;
+    auto image = std::make_unique<Image>(header.width, header.height, header.channels, Uninitialized);
+    char* pixels = reinterpret_cast<char*>(image->data_.data());
+    if (header.bytesPerSample() == 1) {
+        file.read(pixels, image->data_.size());
+        return file ? std::move(image) : nullptr;
     }
     
-    int width, height, max_value;
-    file >> width >> height >> max_value;
-    file.ignore();
-    
-    auto image = std::make_unique<Image>(width, height);
-    file.read(reinterpret_cast<char*>(image->data_.data()), image->data_.size());
-    
-    return file.good() ? std::move(image) : nullptr;
-}
-
-std::unique_ptr<Image> Image::loadJPEG(const std::string& filename) {
-    // Python PIL kullanarak JPEG'i PGM'e çevir
-    std::string temp_pgm = "temp_" + filename.substr(0, filename.find_last_of('.')) + ".pgm";
-    
-    std::stringstream cmd;
-    cmd << "python3 -c \""
-        << "from PIL import Image; "
-        << "img = Image.open('" << filename << "').convert('L'); "
-        << "img.save('" << temp_pgm << "', 'PPM'); "
-        << "print('JPEG converted to PGM')\"";
-    
-    int result = std::system(cmd.str().c_str());
-    if (result != 0) {
-        return nullptr;
+    // 16 bit: satir satir okunup 8 bite olceklenir
+    const size_t samples = image->data_.size() / header.height;
+    std::vector<unsigned char> row(samples * 2);
+    for (int y = 0; y < header.height; ++y) {
+        if (!file.read(reinterpret_cast<char*>(row.data()), row.size())) {
+            return nullptr;
+        }
+        convertPnmSamples16(row.data(), image->data_.data() + y * samples, samples, header.max_value);
     }
-    
-    // PGM dosyasını yükle
-    auto image = load(temp_pgm);
-    
-    // Geçici dosyayı sil
-    std::remove(temp_pgm.c_str());
-    
     return image;
 }
 
+std::unique_ptr<Image> Image::loadJPEG(const std::string& filename, int scale_denominator, int channels) {
+    return decodeJpegFile(filename, scale_denominator, channels);
+}
+
 bool Image::isValidCoordinate(int x, int y, int channel) const {
     return x >= 0 && x < width_ && 
            y >= 0 && y < height_ && 
@@ -110,7 +156,7 @@ bool Image::isValidCoordinate(int x, int y, int channel) const {
 }
 
 size_t Image::calculateIndex(int x, int y, int channel) const {
-    return (y * width_ + x) * channels_ + channel;
+    return y * stride_ + x * channels_ + channel;
 }
 
 } // namespace GorselIsleme
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "ImageViewer.h"
+#include "RgbaConvert.h"
 #include <iostream>
 #include <algorithm>
 
@@ -6,9 +7,16 @@ namespace GorselIsleme {
 
 class ImageViewer::WindowData {
 public:
-    std::map<std::string, std::unique_ptr<sf::RenderWindow>> windows;
-    std::map<std::string, sf::Texture> textures;
-    std::map<std::string, sf::Sprite> sprites;
+    struct Window {
+        std::unique_ptr<sf::RenderWindow> window;
+        sf::Texture texture;
+        sf::Sprite sprite;
+        std::vector<sf::Uint8> staging;
+        int width = 0;
+        int height = 0;
+    };
+    
+    std::map<std::string, Window> windows;
 };
 
 ImageViewer::ImageViewer() : window_data_(std::make_unique<WindowData>()) {
@@ -19,6 +27,11 @@ ImageViewer::~ImageViewer() {
 }
 
 void ImageViewer::goster(const std::string& window_name, const Image& image) {
+    goster(window_name, image, 0, 0, image.getWidth(), image.getHeight());
+}
+
+void ImageViewer::goster(const std::string& window_name, const Image& image, int x, int y, int width,
+                         int height) {
     if (image.empty()) {
         std::cerr << "Bos gorsel gosterilemez" << std::endl;
         return;
@@ -27,27 +40,37 @@ void ImageViewer::goster(const std::string& window_name, const Image& image) {
     if (window_data_->windows.find(window_name) == window_data_->windows.end()) {
         createWindow(window_name, image.getWidth(), image.getHeight());
     }
+    WindowData::Window& data = window_data_->windows[window_name];
     
-    sf::Texture& texture = window_data_->textures[window_name];
-    sf::Sprite& sprite = window_data_->sprites[window_name];
+    int x0 = std::max(0, x);
+    int y0 = std::max(0, y);
+    int x1 = std::min(image.getWidth(), x + width);
+    int y1 = std::min(image.getHeight(), y + height);
     
-    texture.create(image.getWidth(), image.getHeight());
-    
-    std::vector<sf::Uint8> pixels;
-    pixels.reserve(image.getWidth() * image.getHeight() * 4);
-    
-    for (int y = 0; y < image.getHeight(); ++y) {
-        for (int x = 0; x < image.getWidth(); ++x) {
-            unsigned char gray = image.at(x, y);
-            pixels.push_back(gray);
-            pixels.push_back(gray);
-            pixels.push_back(gray);
-            pixels.push_back(255);
+    if (data.width != image.getWidth() || data.height != image.getHeight()) {
+        if (!data.texture.create(image.getWidth(), image.getHeight())) {
+            std::cerr << "Doku olusturulamadi" << std::endl;
+            return;
         }
+        data.width = image.getWidth();
+        data.height = image.getHeight();
+        data.staging.resize(static_cast<size_t>(data.width) * data.height * 4);
+        data.sprite.setTexture(data.texture, true);
+        data.window->setSize(sf::Vector2u(data.width, data.height));
+        data.window->setView(sf::View(sf::FloatRect(0.0f, 0.0f, static_cast<float>(data.width),
+                                                    static_cast<float>(data.height))));
+        x0 = 0;
+        y0 = 0;
+        x1 = data.width;
+        y1 = data.height;
     }
     
-    texture.update(pixels.data());
-    sprite.setTexture(texture);
+    // Bolge ara tamponun basina bitisik yazilir; update ofsetle yalnizca onu yukler
+    if (x1 > x0 && y1 > y0) {
+        convertToRgba(image.view(x0, y0, x1 - x0, y1 - y0), data.staging.data(),
+                      static_cast<std::ptrdiff_t>(x1 - x0) * 4);
+        data.texture.update(data.staging.data(), x1 - x0, y1 - y0, x0, y0);
+    }
     
     renderWindow(window_name);
 }
@@ -66,30 +89,26 @@ void ImageViewer::waitKey(int delay_ms) {
 void ImageViewer::destroyWindow(const std::string& window_name) {
     auto it = window_data_->windows.find(window_name);
     if (it != window_data_->windows.end()) {
-        it->second->close();
+        it->second.window->close();
         window_data_->windows.erase(it);
-        window_data_->textures.erase(window_name);
-        window_data_->sprites.erase(window_name);
     }
 }
 
 void ImageViewer::destroyAllWindows() {
     for (auto& pair : window_data_->windows) {
-        pair.second->close();
+        pair.second.window->close();
     }
     window_data_->windows.clear();
-    window_data_->textures.clear();
-    window_data_->sprites.clear();
 }
 
 bool ImageViewer::isWindowOpen(const std::string& window_name) const {
     auto it = window_data_->windows.find(window_name);
-    return it != window_data_->windows.end() && it->second->isOpen();
+    return it != window_data_->windows.end() && it->second.window->isOpen();
 }
 
 bool ImageViewer::hasOpenWindows() const {
     for (const auto& pair : window_data_->windows) {
-        if (pair.second->isOpen()) {
+        if (pair.second.window->isOpen()) {
             return true;
         }
     }
@@ -99,15 +118,15 @@ bool ImageViewer::hasOpenWindows() const {
 void ImageViewer::createWindow(const std::string& window_name, int width, int height) {
     auto window = std::make_unique<sf::RenderWindow>(
         sf::VideoMode(width, height), window_name);
-    window_data_->windows[window_name] = std::move(window);
+    window_data_->windows[window_name].window = std::move(window);
 }
 
 void ImageViewer::handleEvents() {
     for (auto& pair : window_data_->windows) {
         sf::Event event;
-        while (pair.second->pollEvent(event)) {
+        while (pair.second.window->pollEvent(event)) {
             if (event.type == sf::Event::Closed) {
-                pair.second->close();
+                pair.second.window->close();
             }
         }
     }
@@ -115,10 +134,11 @@ void ImageViewer::handleEvents() {
 
 void ImageViewer::renderWindow(const std::string& window_name) {
     auto it = window_data_->windows.find(window_name);
-    if (it != window_data_->windows.end() && it->second->isOpen()) {
-        it->second->clear();
-        it->second->draw(window_data_->sprites[window_name]);
-        it->second->display();
+    if (it != window_data_->windows.end() && it->second.window->isOpen()) {
+        sf::RenderWindow& window = *it->second.window;
+        window.clear();
+        window.draw(it->second.sprite);
+        window.display();
     }
 }
 
@@ -0,0 +1,111 @@
+#include "JpegDecoder.h"
+#include <algorithm>
+#include <csetjmp>
+#include <cstdio>
+#include <stdexcept>
+// jpeglib.h FILE ve size_t tanimlarina ihtiyac duyar
+#include <jpeglib.h>
+
+namespace GorselIsleme {
+
+namespace {
+
+// libjpeg'in varsayilan hata isleyicisi exit() cagirir; bunun yerine
+// setjmp noktasina donulur. C kodunun ustunden istisna firlatilmaz.
+struct ErrorManager {
+    jpeg_error_mgr manager;
+    std::jmp_buf jump;
+};
+
+void onError(j_common_ptr info) {
+    std::longjmp(reinterpret_cast<ErrorManager*>(info->err)->jump, 1);
+}
+
+// Uyarilar (ornegin eksik dosya sonu) stderr'e yazilmaz
+void onMessage(j_common_ptr) {}
+
+struct Decoder {
+    jpeg_decompress_struct info;
+    ErrorManager error;
+    std::FILE* file = nullptr;
+    bool created = false;
+
+    ~Decoder() {
+        if (created) {
+            jpeg_destroy_decompress(&info);
+        }
+        if (file) {
+            std::fclose(file);
+        }
+    }
+};
+
+// setjmp kullanan fonksiyonlarda yikicisi olan yerel nesne bulunmaz;
+// Image ayirmasi iki asamanin arasinda yapilir.
+bool readHeader(Decoder& decoder, int scale_denominator, int channels) {
+    jpeg_decompress_struct& info = decoder.info;
+    info.err = jpeg_std_error(&decoder.error.manager);
+    decoder.error.manager.error_exit = onError;
+    decoder.error.manager.output_message = onMessage;
+    if (setjmp(decoder.error.jump)) {
+        return false;
+    }
+
+    jpeg_create_decompress(&info);
+    decoder.created = true;
+    jpeg_stdio_src(&info, decoder.file);
+    jpeg_read_header(&info, TRUE);
+
+    info.scale_num = 1;
+    info.scale_denom = static_cast<unsigned int>(scale_denominator);
+    info.out_color_space = channels == 1 ? JCS_GRAYSCALE : JCS_RGB;
+    jpeg_start_decompress(&info);
+    return static_cast<int>(info.output_components) == channels;
+}
+
+bool readPixels(Decoder& decoder, const ImageView& output) {
+    jpeg_decompress_struct& info = decoder.info;
+    if (setjmp(decoder.error.jump)) {
+        return false;
+    }
+
+    // Satirlar dogrudan Image tamponuna cozulur
+    JSAMPROW rows[8];
+    while (info.output_scanline < info.output_height) {
+        const int first = static_cast<int>(info.output_scanline);
+        const int count = std::min<int>(8, output.getHeight() - first);
+        for (int i = 0; i < count; ++i) {
+            rows[i] = output.row(first + i);
+        }
+        jpeg_read_scanlines(&info, rows, static_cast<JDIMENSION>(count));
+    }
+    jpeg_finish_decompress(&info);
+    return true;
+}
+
+} // namespace
+
+std::unique_ptr<Image> decodeJpegFile(const std::string& filename, int scale_denominator, int channels) {
+    if (scale_denominator != 1 && scale_denominator != 2 && scale_denominator != 4 && scale_denominator != 8) {
+        throw std::invalid_argument("JPEG olcegi 1, 2, 4 veya 8 olmali");
+    }
+    if (channels != 1 && channels != 3) {
+        throw std::invalid_argument("JPEG yalnizca 1 veya 3 kanal cozulebilir");
+    }
+
+    Decoder decoder;
+    decoder.file = std::fopen(filename.c_str(), "rb");
+    if (!decoder.file || !readHeader(decoder, scale_denominator, channels)) {
+        return nullptr;
+    }
+
+    auto image = std::make_unique<Image>(static_cast<int>(decoder.info.output_width),
+                                         static_cast<int>(decoder.info.output_height), channels,
+                                         Image::Uninitialized);
+    if (!readPixels(decoder, image->view())) {
+        return nullptr;
+    }
+    return image;
+}
+
+} // namespace GorselIsleme
@@ -0,0 +1,15 @@
+#pragma once
+#include "Image.h"
+#include <memory>
+#include <string>
+
+// Dahili libjpeg sarmalayicisi; her cagri kendi cozucu durumunu kullanir,
+// bu yuzden farkli thread'lerden ayni anda cagrilabilir.
+
+namespace GorselIsleme {
+
+// scale_denominator: 1, 2, 4 veya 8 (DCT alaninda kucultme);
+// channels: 1 gri, 3 RGB. Okuma veya cozme hatasinda nullptr.
+std::unique_ptr<Image> decodeJpegFile(const std::string& filename, int scale_denominator, int channels);
+
+} // namespace GorselIsleme
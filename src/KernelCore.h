@@ -0,0 +1,118 @@
+#pragma once
+#include "Image.h"
+#include "Simd.h"
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// Dahili derleme zamani ozellestirilmis konvolusyon cekirdekleri. Yaricap,
+// kanal sayisi ve katsayilar sablon parametresi oldugunda tap dongusu acilir,
+// sifir katsayilar derlemede duser ve ic dongu vektorlesir. Desteklenmeyen
+// boyutlar cagiranin genel (calisma zamani) yoluna duser.
+
+namespace GorselIsleme {
+namespace kernels {
+
+constexpr int kMaxSpecializedRadius = 4;
+
+// Sablon parametresi olarak kullanilan 3x3 tam sayi kernel
+struct Kernel3x3 {
+    int taps[3][3];
+};
+
+constexpr Kernel3x3 kSobelX{{{-1, 0, 1}, {-2, 0, 2}, {-1, 0, 1}}};
+constexpr Kernel3x3 kSobelY{{{-1, -2, -1}, {0, 0, 0}, {1, 2, 1}}};
+constexpr Kernel3x3 kScharrX{{{-3, 0, 3}, {-10, 0, 10}, {-3, 0, 3}}};
+constexpr Kernel3x3 kScharrY{{{-3, -10, -3}, {0, 0, 0}, {3, 10, 3}}};
+constexpr Kernel3x3 kLaplacian{{{0, 1, 0}, {1, -4, 1}, {0, 1, 0}}};
+
+// Mutlak katsayi toplami x 255; sonucun int16'ya sigdigini derlemede dogrular
+constexpr int maxResponse(const Kernel3x3& kernel) {
+    int sum = 0;
+    for (const auto& row : kernel.taps) {
+        for (int tap : row) {
+            sum += tap < 0 ? -tap : tap;
+        }
+    }
+    return sum * 255;
+}
+
+template <const Kernel3x3& K, int Row, int Column>
+GORSEL_INLINE int tap(const Image::Pixel* row, std::ptrdiff_t step) {
+    if constexpr (K.taps[Row][Column] == 0) {
+        return 0;
+    } else {
+        return K.taps[Row][Column] * row[(Column - 1) * step];
+    }
+}
+
+// Tek pikselde 3x3 yanit; komsu pikselin ayni kanali +-step uzakliktadir
+template <const Kernel3x3& K>
+GORSEL_INLINE int response3x3(const Image::Pixel* top, const Image::Pixel* middle, const Image::Pixel* bottom,
+                       std::ptrdiff_t step) {
+    static_assert(maxResponse(K) <= 32767, "3x3 yanit int16'ya sigmali");
+    return tap<K, 0, 0>(top, step) + tap<K, 0, 1>(top, step) + tap<K, 0, 2>(top, step) +
+           tap<K, 1, 0>(middle, step) + tap<K, 1, 1>(middle, step) + tap<K, 1, 2>(middle, step) +
+           tap<K, 2, 0>(bottom, step) + tap<K, 2, 1>(bottom, step) + tap<K, 2, 2>(bottom, step);
+}
+
+// Duz satir indeksi [begin, end) uzerinde 3x3 yanit. Channels 0 ise adim
+// calisma aninda verilen kanal sayisidir.
+template <const Kernel3x3& K, int Channels>
+GORSEL_INLINE void kernelRow3x3(const Image::Pixel* top, const Image::Pixel* middle, const Image::Pixel* bottom,
+                  int16_t* output, size_t begin, size_t end, int channels) {
+    const std::ptrdiff_t step = Channels ? Channels : channels;
+    for (size_t i = begin; i < end; ++i) {
+        output[i] = static_cast<int16_t>(response3x3<K>(top + i, middle + i, bottom + i, step));
+    }
+}
+
+// Kanal sayisini derleme zamani sabitine cevirir (1, 3, 4; digerleri 0)
+template <typename Function>
+void withChannels(int channels, Function&& function) {
+    switch (channels) {
+    case 1: function(std::integral_constant<int, 1>()); break;
+    case 3: function(std::integral_constant<int, 3>()); break;
+    case 4: function(std::integral_constant<int, 4>()); break;
+    default: function(std::integral_constant<int, 0>()); break;
+    }
+}
+
+template <int Radius, typename Function>
+bool withSpecializedChannels(int channels, Function& function) {
+    using R = std::integral_constant<int, Radius>;
+    switch (channels) {
+    case 1: function(R(), std::integral_constant<int, 1>()); return true;
+    case 3: function(R(), std::integral_constant<int, 3>()); return true;
+    case 4: function(R(), std::integral_constant<int, 4>()); return true;
+    default: return false;
+    }
+}
+
+// Yaricap 1..4 ve kanal 1/3/4 icin function(radius, channels) cagirir ve
+// true doner; diger boyutlarda hicbir sey yapmaz ve false doner
+template <typename Function>
+bool withRadiusAndChannels(int radius, int channels, Function&& function) {
+    switch (radius) {
+    case 1: return withSpecializedChannels<1>(channels, function);
+    case 2: return withSpecializedChannels<2>(channels, function);
+    case 3: return withSpecializedChannels<3>(channels, function);
+    case 4: return withSpecializedChannels<4>(channels, function);
+    default: return false;
+    }
+}
+
+// Yaricap 1..4 icin function(radius) cagirir; diger yaricaplarda false
+template <typename Function>
+bool withRadius(int radius, Function&& function) {
+    switch (radius) {
+    case 1: function(std::integral_constant<int, 1>()); return true;
+    case 2: function(std::integral_constant<int, 2>()); return true;
+    case 3: function(std::integral_constant<int, 3>()); return true;
+    case 4: function(std::integral_constant<int, 4>()); return true;
+    default: return false;
+    }
+}
+
+} // namespace kernels
+} // namespace GorselIsleme
@@ -0,0 +1,29 @@
+#include "MappedImage.h"
+#include "FileMapping.h"
+#include "PnmFormat.h"
+
+namespace GorselIsleme {
+
+std::unique_ptr<MappedImage> MappedImage::open(const std::string& filename) {
+    std::unique_ptr<MappedImage> image(new MappedImage());
+    image->mapping_ = std::make_unique<FileMapping>();
+    if (!image->mapping_->open(filename)) {
+        return nullptr;
+    }
+    const unsigned char* data = image->mapping_->data();
+    const size_t size = image->mapping_->size();
+    
+    PnmHeader header;
+    size_t header_size = 0;
+    if (!parsePnmHeader(data, size, header, header_size) || header.bytesPerSample() != 1 ||
+        size - header_size < header.payloadSize()) {
+        return nullptr;
+    }
+    const std::ptrdiff_t row_size = static_cast<std::ptrdiff_t>(header.width) * header.channels;
+    image->view_ = ConstImageView(data + header_size, header.width, header.height, header.channels, row_size);
+    return image;
+}
+
+MappedImage::~MappedImage() = default;
+
+} // namespace GorselIsleme
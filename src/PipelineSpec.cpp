@@ -0,0 +1,211 @@
+#include "PipelineSpec.h"
+#include "BrightnessAdjust.h"
+#include "EdgeDetection.h"
+#include "GaussianBlur.h"
+#include "PointOp.h"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace GorselIsleme {
+
+namespace {
+
+std::vector<std::string> split(const std::string& text, char separator) {
+    std::vector<std::string> parts;
+    std::string current;
+    for (char c : text) {
+        if (c == separator) {
+            parts.push_back(current);
+            current.clear();
+        } else if (!std::isspace(static_cast<unsigned char>(c))) {
+            current += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+        }
+    }
+    parts.push_back(current);
+    return parts;
+}
+
+[[noreturn]] void fail(const std::string& stage, const std::string& reason) {
+    throw std::invalid_argument("Gecersiz pipeline tanimi '" + stage + "': " + reason);
+}
+
+double toNumber(const std::string& stage, const std::string& text) {
+    size_t used = 0;
+    double value = 0.0;
+    try {
+        value = std::stod(text, &used);
+    } catch (const std::exception&) {
+        fail(stage, "sayi bekleniyor");
+    }
+    if (used != text.size() || !std::isfinite(value)) {
+        fail(stage, "sayi bekleniyor");
+    }
+    return value;
+}
+
+int toInteger(const std::string& stage, const std::string& text) {
+    const double value = toNumber(stage, text);
+    if (value != std::floor(value) || std::abs(value) > 1e9) {
+        fail(stage, "tam sayi bekleniyor");
+    }
+    return static_cast<int>(value);
+}
+
+void expectArguments(const std::string& stage, size_t count, size_t min_count, size_t max_count) {
+    if (count < min_count || count > max_count) {
+        fail(stage, "parametre sayisi hatali");
+    }
+}
+
+std::unique_ptr<Filter> parseFilter(const std::string& stage, const std::string& body) {
+    const auto parts = split(body, ':');
+    const std::string& name = parts[0];
+    const size_t arguments = parts.size() - 1;
+
+    try {
+        if (name == "blur") {
+            expectArguments(stage, arguments, 1, 3);
+            const double sigma = toNumber(stage, parts[1]);
+            int kernel = 2 * static_cast<int>(std::ceil(3.0 * sigma)) + 1;
+            if (arguments >= 2) {
+                kernel = toInteger(stage, parts[2]);
+            }
+            GaussianBlur::Mode mode = GaussianBlur::Auto;
+            if (arguments == 3) {
+                if (parts[3] == "exact") {
+                    mode = GaussianBlur::Exact;
+                } else if (parts[3] == "box") {
+                    mode = GaussianBlur::StackedBox;
+                } else if (parts[3] != "auto") {
+                    fail(stage, "mod exact, box veya auto olmali");
+                }
+            }
+            return std::make_unique<GaussianBlur>(sigma, kernel, mode);
+        }
+        if (name == "edge") {
+            expectArguments(stage, arguments, 0, 3);
+            EdgeDetection::Direction direction = EdgeDetection::Both;
+            EdgeDetection::Magnitude magnitude = EdgeDetection::L2;
+            EdgeDetection::Operator op = EdgeDetection::Sobel;
+            if (arguments >= 1) {
+                if (parts[1] == "horizontal" || parts[1] == "h") {
+                    direction = EdgeDetection::Horizontal;
+                } else if (parts[1] == "vertical" || parts[1] == "v") {
+                    direction = EdgeDetection::Vertical;
+                } else if (parts[1] != "both") {
+                    fail(stage, "yon both, horizontal veya vertical olmali");
+                }
+            }
+            if (arguments >= 2) {
+                if (parts[2] == "l1") {
+                    magnitude = EdgeDetection::L1;
+                } else if (parts[2] == "max") {
+                    magnitude = EdgeDetection::Max;
+                } else if (parts[2] != "l2") {
+                    fail(stage, "buyukluk l2, l1 veya max olmali");
+                }
+            }
+            if (arguments == 3) {
+                if (parts[3] == "scharr") {
+                    op = EdgeDetection::Scharr;
+                } else if (parts[3] == "laplacian") {
+                    op = EdgeDetection::Laplacian;
+                } else if (parts[3] != "sobel") {
+                    fail(stage, "operator sobel, scharr veya laplacian olmali");
+                }
+            }
+            return std::make_unique<EdgeDetection>(direction, magnitude, op);
+        }
+        if (name == "brightness") {
+            expectArguments(stage, arguments, 1, 1);
+            return std::make_unique<BrightnessAdjust>(toNumber(stage, parts[1]));
+        }
+        if (name == "contrast") {
+            expectArguments(stage, arguments, 1, 1);
+            return std::make_unique<ContrastAdjust>(toNumber(stage, parts[1]));
+        }
+        if (name == "gamma") {
+            expectArguments(stage, arguments, 1, 1);
+            return std::make_unique<GammaCorrection>(toNumber(stage, parts[1]));
+        }
+        if (name == "threshold") {
+            expectArguments(stage, arguments, 1, 1);
+            return std::make_unique<Threshold>(toInteger(stage, parts[1]));
+        }
+        if (name == "invert") {
+            expectArguments(stage, arguments, 0, 0);
+            return std::make_unique<Invert>();
+        }
+    } catch (const std::invalid_argument& error) {
+        // Filtre kurucularinin parametre hatalari asama adiyla bildirilir
+        if (std::string(error.what()).rfind("Gecersiz pipeline tanimi", 0) == 0) {
+            throw;
+        }
+        fail(stage, error.what());
+    }
+    fail(stage, "bilinmeyen filtre");
+}
+
+// "@mod" soneki: renormalize, clamp, reflect, wrap veya constant[=deger]
+void parseBorder(const std::string& stage, const std::string& text, Filter& filter) {
+    Filter::BorderMode mode = Filter::Renormalize;
+    int value = 0;
+    const size_t equals = text.find('=');
+    const std::string name = text.substr(0, equals);
+    if (name == "clamp") {
+        mode = Filter::Clamp;
+    } else if (name == "reflect") {
+        mode = Filter::Reflect;
+    } else if (name == "wrap") {
+        mode = Filter::Wrap;
+    } else if (name == "constant") {
+        mode = Filter::Constant;
+    } else if (name != "renormalize") {
+        fail(stage, "kenar modu renormalize, clamp, reflect, wrap veya constant olmali");
+    }
+    if (equals != std::string::npos) {
+        if (mode != Filter::Constant) {
+            fail(stage, "yalnizca constant kenar modu deger alir");
+        }
+        value = toInteger(stage, text.substr(equals + 1));
+        if (value < 0 || value > 255) {
+            fail(stage, "kenar degeri 0-255 araliginda olmali");
+        }
+    }
+
+    const auto pixel = static_cast<Image::Pixel>(value);
+    if (auto* blur = dynamic_cast<GaussianBlur*>(&filter)) {
+        blur->setBorderMode(mode, pixel);
+    } else if (auto* edge = dynamic_cast<EdgeDetection*>(&filter)) {
+        edge->setBorderMode(mode, pixel);
+    } else {
+        fail(stage, "kenar modu yalnizca komsuluk filtrelerinde kullanilabilir");
+    }
+}
+
+std::unique_ptr<Filter> parseStage(const std::string& stage) {
+    const size_t at = stage.find('@');
+    auto filter = parseFilter(stage, stage.substr(0, at));
+    if (at != std::string::npos) {
+        parseBorder(stage, stage.substr(at + 1), *filter);
+    }
+    return filter;
+}
+
+} // namespace
+
+std::unique_ptr<FilterPipeline> parsePipelineSpec(const std::string& spec) {
+    auto pipeline = std::make_unique<FilterPipeline>();
+    for (const auto& stage : split(spec, ',')) {
+        if (stage.empty()) {
+            fail(spec, "bos asama");
+        }
+        pipeline->addFilter(parseStage(stage));
+    }
+    return pipeline;
+}
+
+} // namespace GorselIsleme
@@ -0,0 +1,251 @@
+#include "PipelineTrace.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdarg>
+#include <cstdio>
+#include <fstream>
+#include <ostream>
+
+namespace GorselIsleme {
+
+namespace {
+
+// JSON dizesi icin kacis
+std::string escapeJson(const std::string& text) {
+    std::string result;
+    result.reserve(text.size() + 2);
+    for (const char c : text) {
+        switch (c) {
+        case '"': result += "\\\""; break;
+        case '\\': result += "\\\\"; break;
+        case '\n': result += "\\n"; break;
+        case '\t': result += "\\t"; break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                char escaped[8];
+                std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                result += escaped;
+            } else {
+                result += c;
+            }
+        }
+    }
+    return result;
+}
+
+// printf bicimli yazim; cikti yigin tamponuna sigmazsa snprintf'in
+// dondurdugu boyutla yeniden bicimlenir (uzun asama adlari kesilmez)
+void writeFormatted(std::ostream& out, const char* format, ...) {
+    char buffer[512];
+    va_list args;
+    va_start(args, format);
+    va_list retry;
+    va_copy(retry, args);
+    const int length = std::vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    if (length < 0) {
+        va_end(retry);
+        out.setstate(std::ios::failbit);
+        return;
+    }
+    if (static_cast<size_t>(length) < sizeof(buffer)) {
+        out.write(buffer, length);
+    } else {
+        std::string text(static_cast<size_t>(length) + 1, '\0');
+        std::vsnprintf(&text[0], text.size(), format, retry);
+        out.write(text.data(), length);
+    }
+    va_end(retry);
+}
+
+// Tiled asama toplamlarinin gosterildigi izler, cagiran thread izinden ayrilir
+constexpr uint32_t kFusedTrackOffset = 1000;
+
+} // namespace
+
+double traceTimestampUs() {
+    static const auto epoch = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - epoch).count();
+}
+
+uint32_t traceThreadId() {
+    static std::atomic<uint32_t> next{1};
+    thread_local const uint32_t id = next.fetch_add(1, std::memory_order_relaxed);
+    return id;
+}
+
+void ChromeTraceRecorder::onStage(const StageEvent& event) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stages_.push_back(event);
+}
+
+void ChromeTraceRecorder::onApply(const ApplyEvent& event) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    applies_.push_back(event);
+}
+
+void ChromeTraceRecorder::write(std::ostream& out) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    bool first = true;
+    const auto separator = [&]() {
+        out << (first ? "\n" : ",\n");
+        first = false;
+    };
+
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    std::map<uint32_t, bool> tracks; // thread kimligi -> Tiled izi mi
+    for (const ApplyEvent& event : applies_) {
+        separator();
+        writeFormatted(out,
+                       "{\"name\":\"apply %dx%dx%d\",\"cat\":\"pipeline\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,"
+                       "\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"apply_id\":%llu,\"mode\":\"%s\",\"stages\":%zu,"
+                       "\"allocated_bytes\":%llu,\"thread_utilization\":%.3f}}",
+                       event.width, event.height, event.channels, event.thread_id, event.start_us,
+                       event.duration_us, static_cast<unsigned long long>(event.apply_id),
+                       event.tiled ? "tiled" : "sequential", event.stage_count,
+                       static_cast<unsigned long long>(event.allocated_bytes), event.thread_utilization);
+        tracks.emplace(event.thread_id, false);
+    }
+
+    // Tiled toplamlari ayni apply icinde art arda dizilir
+    std::map<uint64_t, double> fused_cursor;
+    for (const StageEvent& event : stages_) {
+        uint32_t tid = event.thread_id;
+        double start = event.start_us;
+        if (event.fused) {
+            tid += kFusedTrackOffset;
+            auto cursor = fused_cursor.emplace(event.apply_id, event.start_us).first;
+            start = cursor->second;
+            cursor->second += event.duration_us;
+            tracks[tid] = true;
+        } else {
+            tracks.emplace(tid, false);
+        }
+        separator();
+        writeFormatted(out,
+                       "{\"name\":\"%s\",\"cat\":\"stage\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,"
+                       "\"dur\":%.3f,\"args\":{\"apply_id\":%llu,\"stage\":%zu,\"pixels\":%llu,"
+                       "\"allocated_bytes\":%llu,\"thread_utilization\":%.3f}}",
+                       escapeJson(event.name).c_str(), tid, start, event.duration_us,
+                       static_cast<unsigned long long>(event.apply_id), event.stage_index,
+                       static_cast<unsigned long long>(event.pixels),
+                       static_cast<unsigned long long>(event.allocated_bytes), event.thread_utilization);
+    }
+
+    for (const auto& track : tracks) {
+        separator();
+        if (track.second) {
+            writeFormatted(out,
+                           "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,"
+                           "\"args\":{\"name\":\"thread %u (karo toplamlari)\"}}",
+                           track.first, track.first - kFusedTrackOffset);
+        } else {
+            writeFormatted(out,
+                           "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,"
+                           "\"args\":{\"name\":\"thread %u\"}}",
+                           track.first, track.first);
+        }
+    }
+    out << "\n]}\n";
+}
+
+bool ChromeTraceRecorder::save(const std::string& filename) const {
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        return false;
+    }
+    write(file);
+    return file.good();
+}
+
+void ChromeTraceRecorder::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stages_.clear();
+    applies_.clear();
+}
+
+size_t ChromeTraceRecorder::getEventCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stages_.size() + applies_.size();
+}
+
+double PipelineStats::Entry::megapixelsPerSecond() const {
+    return total_ms > 0.0 ? static_cast<double>(pixels) / 1e6 / (total_ms / 1000.0) : 0.0;
+}
+
+void PipelineStats::onStage(const StageEvent& event) {
+    // Kova b: [2^(b/8), 2^((b+1)/8)) mikrosaniye (+1 kaydirmali)
+    const double scaled = std::log2(event.duration_us + 1.0) * kBucketsPerOctave;
+    const int bucket = std::min(kBucketCount - 1, std::max(0, static_cast<int>(scaled)));
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    Accumulator& accumulator = entries_[event.name];
+    ++accumulator.count;
+    accumulator.total_us += event.duration_us;
+    accumulator.max_us = std::max(accumulator.max_us, event.duration_us);
+    accumulator.pixels += event.pixels;
+    accumulator.allocated_bytes += event.allocated_bytes;
+    ++accumulator.buckets[bucket];
+}
+
+double PipelineStats::percentile(const Accumulator& accumulator, double fraction) {
+    const uint64_t rank = std::max<uint64_t>(
+        1, static_cast<uint64_t>(std::ceil(fraction * static_cast<double>(accumulator.count))));
+    uint64_t seen = 0;
+    for (int bucket = 0; bucket < kBucketCount; ++bucket) {
+        seen += accumulator.buckets[bucket];
+        if (seen >= rank) {
+            // Kovanin geometrik ortasi; en buyuk gozlemi asamaz
+            const double middle = std::exp2((bucket + 0.5) / kBucketsPerOctave) - 1.0;
+            return std::min(middle, accumulator.max_us);
+        }
+    }
+    return accumulator.max_us;
+}
+
+std::vector<PipelineStats::Entry> PipelineStats::snapshot() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<Entry> result;
+    result.reserve(entries_.size());
+    for (const auto& item : entries_) {
+        const Accumulator& accumulator = item.second;
+        Entry entry;
+        entry.name = item.first;
+        entry.count = accumulator.count;
+        entry.total_ms = accumulator.total_us / 1000.0;
+        entry.p50_ms = percentile(accumulator, 0.50) / 1000.0;
+        entry.p99_ms = percentile(accumulator, 0.99) / 1000.0;
+        entry.max_ms = accumulator.max_us / 1000.0;
+        entry.pixels = accumulator.pixels;
+        entry.allocated_bytes = accumulator.allocated_bytes;
+        result.push_back(entry);
+    }
+    return result;
+}
+
+void PipelineStats::reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+}
+
+void ObserverGroup::add(std::shared_ptr<PipelineObserver> observer) {
+    if (observer) {
+        observers_.push_back(std::move(observer));
+    }
+}
+
+void ObserverGroup::onStage(const StageEvent& event) {
+    for (const auto& observer : observers_) {
+        observer->onStage(event);
+    }
+}
+
+void ObserverGroup::onApply(const ApplyEvent& event) {
+    for (const auto& observer : observers_) {
+        observer->onApply(event);
+    }
+}
+
+} // namespace GorselIsleme
@@ -0,0 +1,201 @@
+#include "PnmFormat.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <fstream>
+#include <ostream>
+#include <stdexcept>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <cerrno>
+#include <climits>
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#define GORSEL_HAS_WRITEV 1
+#endif
+
+namespace GorselIsleme {
+
+namespace {
+
+constexpr int kEnd = std::char_traits<char>::eof();
+
+// Ayristiricinin okudugu iki kaynak: akis ve bellek
+struct StreamCursor {
+    std::istream& in;
+    
+    int peek() { return in.peek(); }
+    int get() { return in.get(); }
+    bool read(char* output, size_t count) {
+        return static_cast<bool>(in.read(output, static_cast<std::streamsize>(count)));
+    }
+};
+
+struct MemoryCursor {
+    const unsigned char* data;
+    size_t size;
+    size_t position = 0;
+    
+    int peek() const { return position < size ? data[position] : kEnd; }
+    int get() { return position < size ? data[position++] : kEnd; }
+    bool read(char* output, size_t count) {
+        if (size - position < count) {
+            return false;
+        }
+        std::copy(data + position, data + position + count, output);
+        position += count;
+        return true;
+    }
+};
+
+// Bosluk ve yorumlari atlayip pozitif bir tam sayi okur
+template <typename Cursor>
+bool readHeaderNumber(Cursor& in, int& value) {
+    for (;;) {
+        const int c = in.peek();
+        if (c == kEnd) {
+            return false;
+        }
+        if (c == '#') {
+            while (in.peek() != kEnd && in.get() != '\n') {
+            }
+        } else if (std::isspace(c)) {
+            in.get();
+        } else {
+            break;
+        }
+    }
+    long long number = 0;
+    bool any = false;
+    for (int c = in.peek(); c != kEnd && std::isdigit(c); c = in.peek()) {
+        number = number * 10 + (in.get() - '0');
+        if (number > std::numeric_limits<int>::max()) {
+            return false;
+        }
+        any = true;
+    }
+    value = static_cast<int>(number);
+    return any && value > 0;
+}
+
+template <typename Cursor>
+bool parseHeader(Cursor& in, PnmHeader& header) {
+    char magic[2] = {};
+    if (!in.read(magic, 2) || magic[0] != 'P' || (magic[1] != '5' && magic[1] != '6')) {
+        return false;
+    }
+    header.channels = magic[1] == '5' ? 1 : 3;
+    if (!readHeaderNumber(in, header.width) || !readHeaderNumber(in, header.height) ||
+        !readHeaderNumber(in, header.max_value) || header.max_value > 65535) {
+        return false;
+    }
+    // Maksimum degerden sonra tek bir bosluk karakteri gelir
+    const int separator = in.get();
+    return separator != kEnd && std::isspace(separator);
+}
+
+} // namespace
+
+bool readPnmHeader(std::istream& in, PnmHeader& header) {
+    StreamCursor cursor{in};
+    return parseHeader(cursor, header);
+}
+
+bool parsePnmHeader(const unsigned char* data, size_t size, PnmHeader& header, size_t& header_size) {
+    MemoryCursor cursor{data, size};
+    if (!parseHeader(cursor, header)) {
+        return false;
+    }
+    header_size = cursor.position;
+    return true;
+}
+
+void convertPnmSamples16(const unsigned char* samples, unsigned char* output, size_t count, int max_value) {
+    const uint32_t half = static_cast<uint32_t>(max_value) / 2;
+    for (size_t i = 0; i < count; ++i) {
+        const uint32_t value = std::min<uint32_t>((samples[2 * i] << 8) | samples[2 * i + 1], max_value);
+        output[i] = static_cast<unsigned char>((value * 255 + half) / static_cast<uint32_t>(max_value));
+    }
+}
+
+std::string formatPnmHeader(int width, int height, int channels) {
+    if (channels != 1 && channels != 3) {
+        throw std::invalid_argument("PNM yalnizca 1 veya 3 kanal destekler");
+    }
+    return (channels == 1 ? "P5\n" : "P6\n") + std::to_string(width) + " " + std::to_string(height) + "\n255\n";
+}
+
+void writePnmHeader(std::ostream& out, int width, int height, int channels) {
+    out << formatPnmHeader(width, height, channels);
+}
+
+bool writePnmFile(const std::string& filename, const ConstImageView& image) {
+    if (image.getChannels() != 1 && image.getChannels() != 3) {
+        return false;
+    }
+    const std::string header = formatPnmHeader(image.getWidth(), image.getHeight(), image.getChannels());
+    const size_t row_size = image.getRowSize();
+    
+#ifdef GORSEL_HAS_WRITEV
+    // Bitisik gorunumde baslik + tek parca, aksi halde satir basina bir parca
+    std::vector<iovec> parts;
+    parts.push_back({const_cast<char*>(header.data()), header.size()});
+    if (image.isContiguous()) {
+        parts.push_back({const_cast<unsigned char*>(image.data()), row_size * image.getHeight()});
+    } else {
+        parts.reserve(static_cast<size_t>(image.getHeight()) + 1);
+        for (int y = 0; y < image.getHeight(); ++y) {
+            parts.push_back({const_cast<unsigned char*>(image.row(y)), row_size});
+        }
+    }
+    
+    const int fd = ::open(filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        return false;
+    }
+    size_t index = 0;
+    bool ok = true;
+    while (index < parts.size()) {
+        const int count = static_cast<int>(std::min<size_t>(parts.size() - index, IOV_MAX));
+        const ssize_t written = ::writev(fd, parts.data() + index, count);
+        if (written <= 0) {
+            if (written < 0 && errno == EINTR) {
+                continue;
+            }
+            ok = false;
+            break;
+        }
+        // Kismi yazimda kalan parcalardan devam edilir
+        size_t remaining = static_cast<size_t>(written);
+        while (index < parts.size() && remaining >= parts[index].iov_len) {
+            remaining -= parts[index].iov_len;
+            ++index;
+        }
+        if (remaining > 0) {
+            parts[index].iov_base = static_cast<char*>(parts[index].iov_base) + remaining;
+            parts[index].iov_len -= remaining;
+        }
+    }
+    return ::close(fd) == 0 && ok;
+#else
+    std::ofstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+    file << header;
+    if (image.isContiguous()) {
+        file.write(reinterpret_cast<const char*>(image.data()), row_size * image.getHeight());
+    } else {
+        for (int y = 0; y < image.getHeight(); ++y) {
+            file.write(reinterpret_cast<const char*>(image.row(y)), row_size);
+        }
+    }
+    return file.good();
+#endif
+}
+
+} // namespace GorselIsleme
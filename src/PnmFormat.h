@@ -0,0 +1,40 @@
+#pragma once
+#include "ImageView.h"
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+
+// Dahili PNM (P5/P6) baslik okuma/yazma yardimcilari
+
+namespace GorselIsleme {
+
+struct PnmHeader {
+    int width = 0;
+    int height = 0;
+    int channels = 0;   // P5: 1, P6: 3
+    int max_value = 0;  // 1..65535; 255'ten buyukse ornekler 2 bayt (big-endian)
+    
+    int bytesPerSample() const { return max_value > 255 ? 2 : 1; }
+    size_t payloadSize() const {
+        return static_cast<size_t>(width) * height * channels * bytesPerSample();
+    }
+};
+
+// Sihirli sayi, boyutlar ve maksimum deger; '#' yorumlari atlanir. Basarida
+// akis ilk piksel baytinda kalir. Desteklenmeyen veya bozuk baslikta false.
+bool readPnmHeader(std::istream& in, PnmHeader& header);
+// Bellekteki dosya icin ayni ayristirici; header_size ilk piksel baytinin ofseti
+bool parsePnmHeader(const unsigned char* data, size_t size, PnmHeader& header, size_t& header_size);
+
+// 16 bit ornekleri 8 bite olcekler (yuvarlayarak); count ornek sayisidir
+void convertPnmSamples16(const unsigned char* samples, unsigned char* output, size_t count, int max_value);
+
+// 1 kanal P5, 3 kanal P6; diger kanal sayilari std::invalid_argument
+std::string formatPnmHeader(int width, int height, int channels);
+void writePnmHeader(std::ostream& out, int width, int height, int channels);
+
+// Baslik ve tum satirlar tek writev cagrisiyla (satir dolgusu atlanarak)
+// yazilir. 1 veya 3 kanal disinda ya da yazma hatasinda false.
+bool writePnmFile(const std::string& filename, const ConstImageView& image);
+
+} // namespace GorselIsleme
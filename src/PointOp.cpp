@@ -0,0 +1,237 @@
+#include "PointOp.h"
+#include "Hash.h"
+#include "Simd.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <stdexcept>
+
+namespace GorselIsleme {
+
+namespace {
+
+void applyLutScalar(const PointOp::Lut& lut, const Image::Pixel* src, Image::Pixel* dst, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        dst[i] = lut[src[i]];
+    }
+}
+
+#if GORSEL_X86_SIMD
+
+// 256 girdilik tablo 16 adet 16 baytlik dilime bolunur; alt dortlu pshufb
+// indeksi, ust dortlu dilim secicidir
+GORSEL_TARGET("avx2")
+void applyLutAvx2(const PointOp::Lut& lut, const Image::Pixel* src, Image::Pixel* dst, size_t count) {
+    __m256i tables[16];
+    for (int k = 0; k < 16; ++k) {
+        tables[k] = _mm256_broadcastsi128_si256(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(lut.data() + 16 * k)));
+    }
+    const __m256i low_mask = _mm256_set1_epi8(0x0F);
+
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        __m256i low = _mm256_and_si256(value, low_mask);
+        __m256i high = _mm256_and_si256(_mm256_srli_epi16(value, 4), low_mask);
+        __m256i result = _mm256_setzero_si256();
+        for (int k = 0; k < 16; ++k) {
+            __m256i selected = _mm256_cmpeq_epi8(high, _mm256_set1_epi8(static_cast<char>(k)));
+            result = _mm256_blendv_epi8(result, _mm256_shuffle_epi8(tables[k], low), selected);
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), result);
+    }
+    applyLutScalar(lut, src + i, dst + i, count - i);
+}
+
+GORSEL_TARGET("ssse3")
+void applyLutSsse3(const PointOp::Lut& lut, const Image::Pixel* src, Image::Pixel* dst, size_t count) {
+    __m128i tables[16];
+    for (int k = 0; k < 16; ++k) {
+        tables[k] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lut.data() + 16 * k));
+    }
+    const __m128i low_mask = _mm_set1_epi8(0x0F);
+
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m128i low = _mm_and_si128(value, low_mask);
+        __m128i high = _mm_and_si128(_mm_srli_epi16(value, 4), low_mask);
+        __m128i result = _mm_setzero_si128();
+        for (int k = 0; k < 16; ++k) {
+            __m128i selected = _mm_cmpeq_epi8(high, _mm_set1_epi8(static_cast<char>(k)));
+            result = _mm_or_si128(result, _mm_and_si128(selected, _mm_shuffle_epi8(tables[k], low)));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), result);
+    }
+    applyLutScalar(lut, src + i, dst + i, count - i);
+}
+
+#endif
+
+void applyLutRow(const PointOp::Lut& lut, const Image::Pixel* src, Image::Pixel* dst, size_t count) {
+#if GORSEL_X86_SIMD
+    if (simd::hasAvx2()) {
+        applyLutAvx2(lut, src, dst, count);
+        return;
+    }
+    if (simd::hasSsse3()) {
+        applyLutSsse3(lut, src, dst, count);
+        return;
+    }
+#endif
+    applyLutScalar(lut, src, dst, count);
+}
+
+Image::Pixel clampToPixel(double value) {
+    return static_cast<Image::Pixel>(std::min(255.0, std::max(0.0, value)));
+}
+
+} // namespace
+
+void PointOp::apply(const ConstImageView& input, const ImageView& output) const {
+    checkViews(input, output);
+    applyLut(lut_, input, output);
+}
+
+std::string PointOp::getFingerprint() const {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "Lut:%016llx",
+                  static_cast<unsigned long long>(hash::bytes(lut_.data(), lut_.size())));
+    return buffer;
+}
+
+PointOp::Lut PointOp::compose(const Lut& first, const Lut& second) {
+    Lut result;
+    for (int v = 0; v < 256; ++v) {
+        result[v] = second[first[v]];
+    }
+    return result;
+}
+
+PointOp::Lut PointOp::identity() {
+    Lut result;
+    for (int v = 0; v < 256; ++v) {
+        result[v] = static_cast<Image::Pixel>(v);
+    }
+    return result;
+}
+
+void PointOp::applyLut(const Lut& lut, const ConstImageView& input, const ImageView& output) {
+    const size_t row_size = input.getRowSize();
+    const bool contiguous = input.isContiguous() && output.isContiguous();
+    ThreadPool::global().parallelRows(input.getHeight(), row_size, [&](int y_begin, int y_end) {
+        if (contiguous) {
+            applyLutRow(lut, input.row(y_begin), output.row(y_begin), row_size * (y_end - y_begin));
+            return;
+        }
+        for (int y = y_begin; y < y_end; ++y) {
+            applyLutRow(lut, input.row(y), output.row(y), row_size);
+        }
+    });
+}
+
+ContrastAdjust::ContrastAdjust(double factor) : factor_(factor) {
+    if (factor < 0) {
+        throw std::invalid_argument("Kontrast faktoru negatif olamaz");
+    }
+    updateLut();
+}
+
+std::unique_ptr<Filter> ContrastAdjust::clone() const {
+    return std::make_unique<ContrastAdjust>(*this);
+}
+
+void ContrastAdjust::setFactor(double factor) {
+    if (factor < 0) {
+        throw std::invalid_argument("Kontrast faktoru negatif olamaz");
+    }
+    factor_ = factor;
+    updateLut();
+}
+
+void ContrastAdjust::updateLut() {
+    for (int v = 0; v < 256; ++v) {
+        lut_[v] = clampToPixel(std::round((v - 128) * factor_ + 128));
+    }
+}
+
+GammaCorrection::GammaCorrection(double gamma) : gamma_(gamma) {
+    if (gamma <= 0) {
+        throw std::invalid_argument("Gamma pozitif olmali");
+    }
+    updateLut();
+}
+
+std::unique_ptr<Filter> GammaCorrection::clone() const {
+    return std::make_unique<GammaCorrection>(*this);
+}
+
+void GammaCorrection::setGamma(double gamma) {
+    if (gamma <= 0) {
+        throw std::invalid_argument("Gamma pozitif olmali");
+    }
+    gamma_ = gamma;
+    updateLut();
+}
+
+void GammaCorrection::updateLut() {
+    for (int v = 0; v < 256; ++v) {
+        lut_[v] = clampToPixel(std::round(255.0 * std::pow(v / 255.0, 1.0 / gamma_)));
+    }
+}
+
+Invert::Invert() {
+    for (int v = 0; v < 256; ++v) {
+        lut_[v] = static_cast<Image::Pixel>(255 - v);
+    }
+}
+
+std::unique_ptr<Filter> Invert::clone() const {
+    return std::make_unique<Invert>(*this);
+}
+
+Threshold::Threshold(int threshold) : threshold_(threshold) {
+    if (threshold < 0 || threshold > 255) {
+        throw std::invalid_argument("Esik 0-255 araliginda olmali");
+    }
+    updateLut();
+}
+
+std::unique_ptr<Filter> Threshold::clone() const {
+    return std::make_unique<Threshold>(*this);
+}
+
+void Threshold::setThreshold(int threshold) {
+    if (threshold < 0 || threshold > 255) {
+        throw std::invalid_argument("Esik 0-255 araliginda olmali");
+    }
+    threshold_ = threshold;
+    updateLut();
+}
+
+void Threshold::updateLut() {
+    for (int v = 0; v < 256; ++v) {
+        lut_[v] = v > threshold_ ? 255 : 0;
+    }
+}
+
+CurveAdjust::CurveAdjust(const Lut& lut) {
+    lut_ = lut;
+}
+
+CurveAdjust::CurveAdjust(const std::function<Image::Pixel(Image::Pixel)>& curve) {
+    if (!curve) {
+        throw std::invalid_argument("Egri fonksiyonu bos olamaz");
+    }
+    for (int v = 0; v < 256; ++v) {
+        lut_[v] = curve(static_cast<Image::Pixel>(v));
+    }
+}
+
+std::unique_ptr<Filter> CurveAdjust::clone() const {
+    return std::make_unique<CurveAdjust>(*this);
+}
+
+} // namespace GorselIsleme
@@ -0,0 +1,98 @@
+#include "ResultCache.h"
+#include "Hash.h"
+
+namespace GorselIsleme {
+
+namespace {
+
+size_t imageBytes(const Image& image) {
+    return image.getData().size() * sizeof(Image::Pixel);
+}
+
+} // namespace
+
+ResultCache::ResultCache(size_t byte_budget) : byte_budget_(byte_budget) {
+}
+
+std::shared_ptr<const Image> ResultCache::find(const Key& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto found = index_.find(key);
+    if (found == index_.end()) {
+        ++stats_.misses;
+        return nullptr;
+    }
+    ++stats_.hits;
+    entries_.splice(entries_.begin(), entries_, found->second);
+    return found->second->image;
+}
+
+void ResultCache::insert(const Key& key, std::shared_ptr<const Image> image) {
+    if (!image) {
+        return;
+    }
+    const size_t bytes = imageBytes(*image);
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (bytes > byte_budget_) {
+        return;
+    }
+    const auto found = index_.find(key);
+    if (found != index_.end()) {
+        stats_.bytes -= found->second->bytes;
+        entries_.erase(found->second);
+        index_.erase(found);
+    }
+    evictTo(byte_budget_ - bytes);
+    entries_.push_front(Entry{key, std::move(image), bytes});
+    index_[key] = entries_.begin();
+    stats_.bytes += bytes;
+    ++stats_.insertions;
+}
+
+void ResultCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    index_.clear();
+    stats_.bytes = 0;
+}
+
+void ResultCache::setByteBudget(size_t byte_budget) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    byte_budget_ = byte_budget;
+    evictTo(byte_budget_);
+}
+
+size_t ResultCache::getByteBudget() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return byte_budget_;
+}
+
+ResultCache::Stats ResultCache::getStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Stats stats = stats_;
+    stats.entries = entries_.size();
+    return stats;
+}
+
+void ResultCache::evictTo(size_t byte_budget) {
+    while (stats_.bytes > byte_budget && !entries_.empty()) {
+        stats_.bytes -= entries_.back().bytes;
+        index_.erase(entries_.back().key);
+        entries_.pop_back();
+        ++stats_.evictions;
+    }
+}
+
+uint64_t ResultCache::hashImage(const Image& image) {
+    uint64_t seed = hash::combine(hash::combine(static_cast<uint64_t>(image.getWidth()),
+                                                static_cast<uint64_t>(image.getHeight())),
+                                  static_cast<uint64_t>(image.getChannels()));
+    // Satir satir: ayni pikseller farkli duzende (Packed/PaddedRows) ayni ozeti verir
+    const ConstImageView view = image.view();
+    const size_t row_bytes = view.getRowSize();
+    for (int y = 0; y < view.getHeight(); ++y) {
+        seed = hash::bytes(view.row(y), row_bytes, seed);
+    }
+    return seed;
+}
+
+} // namespace GorselIsleme
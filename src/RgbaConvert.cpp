@@ -0,0 +1,167 @@
+#include "RgbaConvert.h"
+#include "Simd.h"
+#include "ThreadPool.h"
+#include <cstring>
+#include <stdexcept>
+
+namespace GorselIsleme {
+
+namespace {
+
+using RowFunction = void (*)(const uint8_t* src, uint8_t* dst, int width);
+
+void grayRowScalar(const uint8_t* src, uint8_t* dst, int width) {
+    for (int x = 0; x < width; ++x) {
+        dst[4 * x] = dst[4 * x + 1] = dst[4 * x + 2] = src[x];
+        dst[4 * x + 3] = 255;
+    }
+}
+
+void grayAlphaRowScalar(const uint8_t* src, uint8_t* dst, int width) {
+    for (int x = 0; x < width; ++x) {
+        dst[4 * x] = dst[4 * x + 1] = dst[4 * x + 2] = src[2 * x];
+        dst[4 * x + 3] = src[2 * x + 1];
+    }
+}
+
+void rgbRowScalar(const uint8_t* src, uint8_t* dst, int width) {
+    for (int x = 0; x < width; ++x) {
+        dst[4 * x] = src[3 * x];
+        dst[4 * x + 1] = src[3 * x + 1];
+        dst[4 * x + 2] = src[3 * x + 2];
+        dst[4 * x + 3] = 255;
+    }
+}
+
+void rgbaRow(const uint8_t* src, uint8_t* dst, int width) {
+    std::memcpy(dst, src, static_cast<size_t>(width) * 4);
+}
+
+#if GORSEL_X86_SIMD
+
+// pshufb maskesinde -1 hedef bayti sifirlar; alfa sonra OR ile eklenir
+
+GORSEL_TARGET("avx2")
+void grayRowAvx2(const uint8_t* src, uint8_t* dst, int width) {
+    // Iki serit ayni 16 gri pikseli tasir; her serit 4'unu genisletir
+    const __m256i low = _mm256_setr_epi8(0, 0, 0, -1, 1, 1, 1, -1, 2, 2, 2, -1, 3, 3, 3, -1,
+                                         4, 4, 4, -1, 5, 5, 5, -1, 6, 6, 6, -1, 7, 7, 7, -1);
+    const __m256i high = _mm256_add_epi8(low, _mm256_set1_epi8(8));
+    const __m256i alpha = _mm256_set1_epi32(static_cast<int>(0xFF000000u));
+    int x = 0;
+    for (; x + 16 <= width; x += 16) {
+        const __m128i gray = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x));
+        const __m256i value = _mm256_broadcastsi128_si256(gray);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 4 * x),
+                            _mm256_or_si256(_mm256_shuffle_epi8(value, low), alpha));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 4 * x + 32),
+                            _mm256_or_si256(_mm256_shuffle_epi8(value, high), alpha));
+    }
+    grayRowScalar(src + x, dst + 4 * x, width - x);
+}
+
+GORSEL_TARGET("avx2")
+void rgbRowAvx2(const uint8_t* src, uint8_t* dst, int width) {
+    // Her serit 12 baytlik 4 pikseli okur; 16 bayt yuklendiginden son
+    // 4 bayt satir sonunu asmamali
+    const __m256i shuffle = _mm256_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1,
+                                             0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    const __m256i alpha = _mm256_set1_epi32(static_cast<int>(0xFF000000u));
+    int x = 0;
+    for (; 3 * x + 28 <= 3 * width; x += 8) {
+        const __m128i first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 3 * x));
+        const __m128i second = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 3 * x + 12));
+        const __m256i value = _mm256_inserti128_si256(_mm256_castsi128_si256(first), second, 1);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 4 * x),
+                            _mm256_or_si256(_mm256_shuffle_epi8(value, shuffle), alpha));
+    }
+    rgbRowScalar(src + 3 * x, dst + 4 * x, width - x);
+}
+
+GORSEL_TARGET("ssse3")
+void grayRowSsse3(const uint8_t* src, uint8_t* dst, int width) {
+    const __m128i masks[4] = {
+        _mm_setr_epi8(0, 0, 0, -1, 1, 1, 1, -1, 2, 2, 2, -1, 3, 3, 3, -1),
+        _mm_setr_epi8(4, 4, 4, -1, 5, 5, 5, -1, 6, 6, 6, -1, 7, 7, 7, -1),
+        _mm_setr_epi8(8, 8, 8, -1, 9, 9, 9, -1, 10, 10, 10, -1, 11, 11, 11, -1),
+        _mm_setr_epi8(12, 12, 12, -1, 13, 13, 13, -1, 14, 14, 14, -1, 15, 15, 15, -1),
+    };
+    const __m128i alpha = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+    int x = 0;
+    for (; x + 16 <= width; x += 16) {
+        const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x));
+        for (int k = 0; k < 4; ++k) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 4 * x + 16 * k),
+                             _mm_or_si128(_mm_shuffle_epi8(value, masks[k]), alpha));
+        }
+    }
+    grayRowScalar(src + x, dst + 4 * x, width - x);
+}
+
+GORSEL_TARGET("ssse3")
+void rgbRowSsse3(const uint8_t* src, uint8_t* dst, int width) {
+    const __m128i shuffle = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    const __m128i alpha = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+    int x = 0;
+    for (; 3 * x + 16 <= 3 * width; x += 4) {
+        const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 3 * x));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 4 * x),
+                         _mm_or_si128(_mm_shuffle_epi8(value, shuffle), alpha));
+    }
+    rgbRowScalar(src + 3 * x, dst + 4 * x, width - x);
+}
+
+#endif
+
+RowFunction selectRow(int channels) {
+    switch (channels) {
+    case 1:
+#if GORSEL_X86_SIMD
+        if (simd::hasAvx2()) {
+            return grayRowAvx2;
+        }
+        if (simd::hasSsse3()) {
+            return grayRowSsse3;
+        }
+#endif
+        return grayRowScalar;
+    case 2:
+        return grayAlphaRowScalar;
+    case 3:
+#if GORSEL_X86_SIMD
+        if (simd::hasAvx2()) {
+            return rgbRowAvx2;
+        }
+        if (simd::hasSsse3()) {
+            return rgbRowSsse3;
+        }
+#endif
+        return rgbRowScalar;
+    case 4:
+        return rgbaRow;
+    default:
+        throw std::invalid_argument("RGBA donusumu 1-4 kanal destekler");
+    }
+}
+
+} // namespace
+
+void convertToRgba(const ConstImageView& input, uint8_t* output, std::ptrdiff_t output_stride) {
+    if (input.empty() || !output) {
+        throw std::invalid_argument("Girdi ve cikti bos olamaz");
+    }
+    const int width = input.getWidth();
+    if (output_stride < static_cast<std::ptrdiff_t>(width) * 4) {
+        throw std::invalid_argument("Cikti satir araligi 4 * genislikten kucuk");
+    }
+    const RowFunction row = selectRow(input.getChannels());
+
+    const size_t row_bytes = static_cast<size_t>(width) * 4;
+    ThreadPool::global().parallelRows(input.getHeight(), row_bytes, [&](int y_begin, int y_end) {
+        for (int y = y_begin; y < y_end; ++y) {
+            row(input.row(y), output + y * output_stride, width);
+        }
+    });
+}
+
+} // namespace GorselIsleme
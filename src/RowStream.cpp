@@ -0,0 +1,119 @@
+#include "RowStream.h"
+#include "PnmFormat.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace GorselIsleme {
+
+namespace {
+
+void copyRows(const ConstImageView& source, const ImageView& destination) {
+    const size_t row_size = source.getRowSize();
+    for (int y = 0; y < source.getHeight(); ++y) {
+        std::copy(source.row(y), source.row(y) + row_size, destination.row(y));
+    }
+}
+
+void checkShape(const ConstImageView& rows, int width, int channels) {
+    if (rows.getWidth() != width || rows.getChannels() != channels) {
+        throw std::invalid_argument("Girdi ve cikti boyutlari uyusmuyor");
+    }
+}
+
+void checkRows(int next_row, int rows, int height) {
+    if (rows > height - next_row) {
+        throw std::out_of_range("Goruntu sonundan sonra satir istendi");
+    }
+}
+
+} // namespace
+
+PnmRowSource::PnmRowSource(const std::string& filename) : file_(filename, std::ios::binary) {
+    PnmHeader header;
+    if (!file_.is_open() || !readPnmHeader(file_, header)) {
+        throw std::runtime_error("Dosya okunamadi: " + filename);
+    }
+    width_ = header.width;
+    height_ = header.height;
+    channels_ = header.channels;
+    max_value_ = header.max_value;
+}
+
+void PnmRowSource::readRows(const ImageView& destination) {
+    checkShape(destination, width_, channels_);
+    checkRows(next_row_, destination.getHeight(), height_);
+
+    const size_t row_size = destination.getRowSize();
+    if (max_value_ > 255) {
+        samples_.resize(row_size * 2);
+        for (int y = 0; y < destination.getHeight() && file_; ++y) {
+            if (file_.read(reinterpret_cast<char*>(samples_.data()), samples_.size())) {
+                convertPnmSamples16(samples_.data(), destination.row(y), row_size, max_value_);
+            }
+        }
+    } else if (destination.isContiguous()) {
+        file_.read(reinterpret_cast<char*>(destination.data()), row_size * destination.getHeight());
+    } else {
+        for (int y = 0; y < destination.getHeight() && file_; ++y) {
+            file_.read(reinterpret_cast<char*>(destination.row(y)), row_size);
+        }
+    }
+    if (!file_) {
+        throw std::runtime_error("Dosya beklenenden kisa");
+    }
+    next_row_ += destination.getHeight();
+}
+
+PnmRowSink::PnmRowSink(const std::string& filename, int width, int height, int channels)
+    : file_(filename, std::ios::binary), filename_(filename), width_(width), height_(height),
+      channels_(channels) {
+    if (!file_.is_open()) {
+        throw std::runtime_error("Dosya yazilamadi: " + filename);
+    }
+    writePnmHeader(file_, width, height, channels);
+}
+
+void PnmRowSink::writeRows(const ConstImageView& rows) {
+    checkShape(rows, width_, channels_);
+    checkRows(written_rows_, rows.getHeight(), height_);
+
+    const size_t row_size = rows.getRowSize();
+    if (rows.isContiguous()) {
+        file_.write(reinterpret_cast<const char*>(rows.data()), row_size * rows.getHeight());
+    } else {
+        for (int y = 0; y < rows.getHeight(); ++y) {
+            file_.write(reinterpret_cast<const char*>(rows.row(y)), row_size);
+        }
+    }
+    written_rows_ += rows.getHeight();
+}
+
+void PnmRowSink::finish() {
+    file_.flush();
+    if (written_rows_ != height_ || !file_) {
+        throw std::runtime_error("Dosya yazilamadi: " + filename_);
+    }
+    file_.close();
+}
+
+void ImageRowSource::readRows(const ImageView& destination) {
+    checkShape(destination, image_.getWidth(), image_.getChannels());
+    checkRows(next_row_, destination.getHeight(), image_.getHeight());
+    if (destination.getHeight() == 0) {
+        return;
+    }
+    copyRows(image_.view(0, next_row_, image_.getWidth(), destination.getHeight()), destination);
+    next_row_ += destination.getHeight();
+}
+
+void ImageRowSink::writeRows(const ConstImageView& rows) {
+    checkShape(rows, image_.getWidth(), image_.getChannels());
+    checkRows(next_row_, rows.getHeight(), image_.getHeight());
+    if (rows.getHeight() == 0) {
+        return;
+    }
+    copyRows(rows, image_.view(0, next_row_, image_.getWidth(), rows.getHeight()));
+    next_row_ += rows.getHeight();
+}
+
+} // namespace GorselIsleme
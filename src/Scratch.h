@@ -0,0 +1,214 @@
+#pragma once
+#include "TraceCounters.h"
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+// Dahili gecici tampon yardimcisi. Filtrelerin her cagrida ayirdigi ara
+// tamponlar thread basina saklanip tekrar kullanilir; ayni boyutlu karelerde
+// kararli durumda yigin ayirmasi olmaz. Buyuk tamponlar thread onbelleginde
+// tutulmaz; hazirlanmis FilterPipeline bunlari kendi ScratchArena'sinda tutar.
+
+namespace GorselIsleme {
+
+// Surec genelinde thread_local onbelleklerde bekleyen bayt sayaci. Havuz,
+// toplu isleme, FrameStream ve AsyncExecutor thread'leri ile birden cok tag
+// bir araya geldiginde bosta tutulan bellek bu butceyle sinirlanir.
+class ScratchBudget {
+public:
+    static constexpr size_t kMaxRetainedBytes = size_t(128) << 20;
+
+    // Butce yetiyorsa bytes'i ayirip true dondurur
+    static bool tryRetain(size_t bytes) {
+        size_t current = retained().load(std::memory_order_relaxed);
+        do {
+            if (current + bytes > kMaxRetainedBytes) {
+                return false;
+            }
+        } while (!retained().compare_exchange_weak(current, current + bytes, std::memory_order_relaxed));
+        return true;
+    }
+
+    static void release(size_t bytes) {
+        retained().fetch_sub(bytes, std::memory_order_relaxed);
+    }
+
+    static size_t getRetainedBytes() { return retained().load(std::memory_order_relaxed); }
+
+private:
+    static std::atomic<size_t>& retained() {
+        static std::atomic<size_t> bytes{0};
+        return bytes;
+    }
+};
+
+// Hazirlanmis FilterPipeline'in sahip oldugu gecici bellek alani. Etkinken
+// (ScratchArenaScope; ThreadPool parallelFor yardimcilarina tasir)
+// ScratchBuffer'lar thread onbellegi yerine buradan alinir. Yuvalar
+// kMaxCachedBytes ve ScratchBudget sinirina tabi degildir, alan yok edilene
+// kadar tutulur. Ayni tag'i es zamanli kullanan her govde ayri yuva alir;
+// yuva sayisi ve boyutlari ilk cagrilarda oturur, sonra ayirma olmaz.
+class ScratchArena {
+public:
+    ScratchArena() = default;
+    ScratchArena(const ScratchArena&) = delete;
+    ScratchArena& operator=(const ScratchArena&) = delete;
+
+    // key icin bos bir yuvayi en az bytes boyutunda dondurur; yetmeyen yuva
+    // sifirlanmadan yeniden ayrilir
+    size_t acquire(const void* key, size_t bytes, void*& data) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        size_t chosen = slots_.size();
+        for (size_t i = 0; i < slots_.size(); ++i) {
+            const Slot& slot = slots_[i];
+            if (slot.in_use || slot.key != key) {
+                continue;
+            }
+            // Yetenler arasinda ilki, yoksa en buyugu
+            if (chosen == slots_.size() || (slots_[chosen].bytes < bytes && slot.bytes > slots_[chosen].bytes)) {
+                chosen = i;
+            }
+        }
+        if (chosen == slots_.size()) {
+            slots_.push_back(Slot{key, nullptr, 0, false});
+        }
+        Slot& slot = slots_[chosen];
+        if (slot.bytes < bytes) {
+            slot.data.reset(new unsigned char[bytes]);
+            slot.bytes = bytes;
+            TraceCounters::addAllocated(bytes);
+        }
+        slot.in_use = true;
+        data = slot.data.get();
+        return chosen;
+    }
+
+    void release(size_t slot) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        slots_[slot].in_use = false;
+    }
+
+    // Yuvalarda tutulan toplam bayt
+    size_t getReservedBytes() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        size_t bytes = 0;
+        for (const Slot& slot : slots_) {
+            bytes += slot.bytes;
+        }
+        return bytes;
+    }
+
+    // Bu thread'de etkin alan (yoksa nullptr)
+    static ScratchArena*& current() {
+        thread_local ScratchArena* arena = nullptr;
+        return arena;
+    }
+
+private:
+    struct Slot {
+        const void* key;
+        std::unique_ptr<unsigned char[]> data;
+        size_t bytes;
+        bool in_use;
+    };
+
+    mutable std::mutex mutex_;
+    std::vector<Slot> slots_;
+};
+
+// Kapsam boyunca thread'in etkin alanini degistirir
+class ScratchArenaScope {
+public:
+    explicit ScratchArenaScope(ScratchArena* arena) : previous_(ScratchArena::current()) {
+        ScratchArena::current() = arena;
+    }
+    ~ScratchArenaScope() { ScratchArena::current() = previous_; }
+
+    ScratchArenaScope(const ScratchArenaScope&) = delete;
+    ScratchArenaScope& operator=(const ScratchArenaScope&) = delete;
+
+private:
+    ScratchArena* previous_;
+};
+
+// Tag, ayni thread'de birlikte yasayan tamponlari ayirir. Ic ice kullanimda
+// ikinci nesne bos tamponla baslar (guvenli, yalnizca onbellek kacirir).
+// kMaxCachedBytes'tan buyuk tamponlar ve ScratchBudget'i asacak tamponlar
+// saklanmaz, serbest birakilir. Etkin bir ScratchArena varsa tampon ondan
+// alinir ve bu sinirlar uygulanmaz.
+template <typename T, typename Tag>
+class ScratchBuffer {
+    static_assert(std::is_trivial<T>::value, "ScratchBuffer yalnizca basit tipleri tutar");
+
+public:
+    static constexpr size_t kMaxCachedBytes = size_t(16) << 20;
+
+    explicit ScratchBuffer(size_t size) : arena_(ScratchArena::current()) {
+        if (arena_) {
+            void* data = nullptr;
+            slot_ = arena_->acquire(key(), size * sizeof(T), data);
+            data_ = static_cast<T*>(data);
+            return;
+        }
+        Cache& cached = cache();
+        buffer_.swap(cached.buffer);
+        ScratchBudget::release(cached.bytes);
+        cached.bytes = 0;
+        if (buffer_.size() < size) {
+            const size_t capacity = buffer_.capacity();
+            buffer_.resize(size);
+            if (buffer_.capacity() != capacity) {
+                TraceCounters::addAllocated(buffer_.capacity() * sizeof(T));
+            }
+        }
+        data_ = buffer_.data();
+    }
+
+    ~ScratchBuffer() {
+        if (arena_) {
+            arena_->release(slot_);
+            return;
+        }
+        const size_t bytes = buffer_.capacity() * sizeof(T);
+        Cache& cached = cache();
+        if (bytes <= kMaxCachedBytes && cached.bytes == 0 && ScratchBudget::tryRetain(bytes)) {
+            cached.buffer.swap(buffer_);
+            cached.bytes = bytes;
+        }
+    }
+
+    ScratchBuffer(const ScratchBuffer&) = delete;
+    ScratchBuffer& operator=(const ScratchBuffer&) = delete;
+
+    T* data() { return data_; }
+    T& operator[](size_t index) { return data_[index]; }
+
+private:
+    // Thread sonlaninca saklanan bayt butceye geri verilir
+    struct Cache {
+        std::vector<T> buffer;
+        size_t bytes = 0;
+        ~Cache() { ScratchBudget::release(bytes); }
+    };
+
+    ScratchArena* arena_;
+    size_t slot_ = 0;
+    T* data_ = nullptr;
+    std::vector<T> buffer_;
+
+    // Alan yuvalarini tag'e gore ayiran anahtar
+    static const void* key() {
+        static const char id = 0;
+        return &id;
+    }
+
+    static Cache& cache() {
+        thread_local Cache cached;
+        return cached;
+    }
+};
+
+} // namespace GorselIsleme
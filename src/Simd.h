@@ -0,0 +1,45 @@
+#pragma once
+
+// Dahili SIMD yardimcilari. Vektor kodu target ozelligi ile derlenir ve
+// calisma aninda CPU destegine gore secilir; ek derleyici bayragi gerekmez.
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define GORSEL_X86_SIMD 1
+#include <immintrin.h>
+#define GORSEL_TARGET(isa) __attribute__((target(isa)))
+#else
+#define GORSEL_X86_SIMD 0
+#define GORSEL_TARGET(isa)
+#endif
+
+// Sablon cekirdekleri GORSEL_TARGET'li sarmalayicilara acilir; boylece ayni
+// govde her hedef icin ayrica vektorlestirilir
+#if defined(__GNUC__) || defined(__clang__)
+#define GORSEL_INLINE inline __attribute__((always_inline))
+#else
+#define GORSEL_INLINE inline
+#endif
+
+namespace GorselIsleme {
+namespace simd {
+
+inline bool hasAvx2() {
+#if GORSEL_X86_SIMD
+    static const bool supported = __builtin_cpu_supports("avx2");
+    return supported;
+#else
+    return false;
+#endif
+}
+
+inline bool hasSsse3() {
+#if GORSEL_X86_SIMD
+    static const bool supported = __builtin_cpu_supports("ssse3");
+    return supported;
+#else
+    return false;
+#endif
+}
+
+} // namespace simd
+} // namespace GorselIsleme
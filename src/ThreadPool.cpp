@@ -0,0 +1,263 @@
+#include "ThreadPool.h"
+#include "Scratch.h"
+#include "TraceCounters.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+
+namespace GorselIsleme {
+
+namespace {
+
+constexpr size_t kMinBandBytes = 64 * 1024;
+constexpr int kBandsPerThread = 4;
+
+size_t resolveThreadCount(size_t thread_count) {
+    if (thread_count == 0) {
+        thread_count = std::thread::hardware_concurrency();
+    }
+    return std::max<size_t>(thread_count, 1);
+}
+
+} // namespace
+
+// parallelFor durumu cagiranin yiginindadir. Cagiran, parcalar bittikten
+// sonra kuyrukta bekleyen yardimcilarini geri alir ve calismakta olanlarin
+// (active) cikmasini bekler; boylece yigin ayirmasi gerekmez.
+struct ThreadPool::ParallelForState {
+    std::atomic<int> next{0};
+    int end = 0;
+    int grain = 1;
+    int chunk_count = 0;
+    const RangeTask* body = nullptr;
+    ThreadPool* pool = nullptr;
+    TraceCounters* counters = nullptr; // cagiranin izleme sayaci
+    ScratchArena* arena = nullptr;     // cagiranin gecici bellek alani
+
+    std::mutex mutex;
+    std::condition_variable done;
+    int finished = 0;
+    int active = 0;
+    std::exception_ptr error;
+
+    void run() {
+        for (;;) {
+            int chunk_begin = next.fetch_add(grain);
+            if (chunk_begin >= end) {
+                return;
+            }
+            try {
+                pool->runBody(*body, chunk_begin, std::min(end, chunk_begin + grain));
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+            std::lock_guard<std::mutex> lock(mutex);
+            if (++finished == chunk_count) {
+                done.notify_all();
+            }
+        }
+    }
+
+    // Yardimci thread'den: run() bitti, state'e bir daha dokunulmaz
+    void leave() {
+        std::lock_guard<std::mutex> lock(mutex);
+        --active;
+        done.notify_all();
+    }
+};
+
+ThreadPool::ThreadPool(size_t thread_count) {
+    startWorkers(resolveThreadCount(thread_count));
+}
+
+ThreadPool::~ThreadPool() {
+    stopWorkers();
+}
+
+size_t ThreadPool::getThreadCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return thread_count_;
+}
+
+void ThreadPool::setThreadCount(size_t thread_count) {
+    stopWorkers();
+    startWorkers(resolveThreadCount(thread_count));
+}
+
+void ThreadPool::submit(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!workers_.empty()) {
+            tasks_.push_back(Task{std::move(task), nullptr});
+            condition_.notify_one();
+            return;
+        }
+    }
+    task();
+}
+
+void ThreadPool::parallelFor(int begin, int end, int grain, RangeTask body) {
+    if (begin >= end) {
+        return;
+    }
+    grain = std::max(grain, 1);
+    const int chunk_count = static_cast<int>((static_cast<long long>(end) - begin + grain - 1) / grain);
+
+    size_t helpers = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        helpers = std::min(workers_.size(), static_cast<size_t>(chunk_count - 1));
+    }
+    if (helpers == 0) {
+        for (int chunk_begin = begin; chunk_begin < end; chunk_begin += grain) {
+            runBody(body, chunk_begin, std::min(end, chunk_begin + grain));
+        }
+        return;
+    }
+
+    ParallelForState state;
+    state.next = begin;
+    state.end = end;
+    state.grain = grain;
+    state.chunk_count = chunk_count;
+    state.body = &body;
+    state.pool = this;
+    state.counters = TraceCounters::current();
+    state.arena = ScratchArena::current();
+
+    enqueueHelpers(&state, helpers);
+    state.run();
+    // Tum parcalar alindi; henuz baslamamis yardimcilarin yapacagi is kalmadi
+    cancelHelpers(&state);
+
+    std::unique_lock<std::mutex> lock(state.mutex);
+    state.done.wait(lock, [&]() { return state.finished == state.chunk_count && state.active == 0; });
+    if (state.error) {
+        std::rethrow_exception(state.error);
+    }
+}
+
+void ThreadPool::parallelRows(int rows, size_t bytes_per_row, RangeTask body, int min_rows) {
+    if (rows <= 0) {
+        return;
+    }
+    const size_t thread_count = getThreadCount();
+    if (thread_count == 1) {
+        runBody(body, 0, rows);
+        return;
+    }
+    const size_t byte_rows = (kMinBandBytes + std::max<size_t>(bytes_per_row, 1) - 1) /
+                             std::max<size_t>(bytes_per_row, 1);
+    const size_t bands = thread_count * kBandsPerThread;
+    const size_t balanced_rows = (static_cast<size_t>(rows) + bands - 1) / bands;
+    const size_t band_rows = std::max({byte_rows, balanced_rows, static_cast<size_t>(std::max(min_rows, 1))});
+    parallelFor(0, rows, static_cast<int>(std::min<size_t>(band_rows, rows)), body);
+}
+
+void ThreadPool::runBody(const RangeTask& body, int begin, int end) {
+    // Ic ice govdeler dis govdenin suresine zaten dahildir, yalnizca en dis olculur
+    thread_local bool in_body = false;
+    if (!TraceCounters::current() || in_body) {
+        body(begin, end);
+        return;
+    }
+    in_body = true;
+    const auto start = std::chrono::steady_clock::now();
+    try {
+        body(begin, end);
+    } catch (...) {
+        in_body = false;
+        throw;
+    }
+    in_body = false;
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    TraceCounters::addBusy(
+        static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+}
+
+ThreadPool& ThreadPool::global() {
+    static ThreadPool pool;
+    return pool;
+}
+
+void ThreadPool::setGlobalThreadCount(size_t thread_count) {
+    global().setThreadCount(thread_count);
+}
+
+void ThreadPool::enqueueHelpers(ParallelForState* state, size_t count) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (size_t i = 0; i < count; ++i) {
+        tasks_.push_back(Task{nullptr, state});
+    }
+    condition_.notify_all();
+}
+
+void ThreadPool::cancelHelpers(ParallelForState* state) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto first = tasks_.begin() + task_head_;
+    tasks_.erase(std::remove_if(first, tasks_.end(),
+                                [state](const Task& task) { return task.parallel_for == state; }),
+                 tasks_.end());
+}
+
+void ThreadPool::startWorkers(size_t thread_count) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = false;
+    thread_count_ = thread_count;
+    for (size_t i = 1; i < thread_count; ++i) {
+        workers_.emplace_back(&ThreadPool::workerLoop, this);
+    }
+}
+
+void ThreadPool::stopWorkers() {
+    std::vector<std::thread> workers;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+        workers.swap(workers_);
+        condition_.notify_all();
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::workerLoop() {
+    for (;;) {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            condition_.wait(lock, [this]() { return stopping_ || task_head_ < tasks_.size(); });
+            if (task_head_ == tasks_.size()) {
+                return;
+            }
+            task = std::move(tasks_[task_head_++]);
+            if (task.parallel_for) {
+                // Kuyruk kilidi altinda: cagiranin cancelHelpers'i bunu gorur
+                std::lock_guard<std::mutex> state_lock(task.parallel_for->mutex);
+                ++task.parallel_for->active;
+            }
+            if (task_head_ == tasks_.size()) {
+                tasks_.clear();
+                task_head_ = 0;
+            } else if (task_head_ * 2 > tasks_.size()) {
+                tasks_.erase(tasks_.begin(), tasks_.begin() + task_head_);
+                task_head_ = 0;
+            }
+        }
+        if (task.parallel_for) {
+            TraceCountersScope scope(task.parallel_for->counters);
+            ScratchArenaScope arena_scope(task.parallel_for->arena);
+            task.parallel_for->run();
+            task.parallel_for->leave();
+        } else {
+            task.function();
+        }
+    }
+}
+
+} // namespace GorselIsleme
@@ -0,0 +1,442 @@
+#include "TiledImage.h"
+#include "FileMapping.h"
+#include "Scratch.h"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace GorselIsleme {
+
+namespace {
+
+const char kMagic[8] = {'G', 'R', 'S', 'L', 'T', 'I', 'L', 'E'};
+constexpr uint32_t kVersion = 1;
+constexpr size_t kHeaderSize = 40;
+constexpr size_t kLevelEntrySize = 8;
+constexpr size_t kTileEntrySize = 16;
+constexpr uint64_t kTileAlignment = 4096;
+constexpr int kMaxLevels = 32;
+
+constexpr uint32_t kRaw = 0;
+constexpr uint32_t kPackBits = 1;
+
+struct TileDecodeTag;
+
+struct LevelSize {
+    int width;
+    int height;
+};
+
+// Seviye boyutlari: her seviye bir oncekinin yarisi (yukari yuvarlanir).
+// requested 0 ise en kucuk seviye tek karoya sigana kadar.
+std::vector<LevelSize> levelSizes(int width, int height, int tile_size, int requested) {
+    std::vector<LevelSize> sizes = {{width, height}};
+    for (;;) {
+        const LevelSize last = sizes.back();
+        const bool more = requested == 0 ? (last.width > tile_size || last.height > tile_size)
+                                         : static_cast<int>(sizes.size()) < requested;
+        if (!more || (last.width == 1 && last.height == 1) || sizes.size() == kMaxLevels) {
+            return sizes;
+        }
+        sizes.push_back({(last.width + 1) / 2, (last.height + 1) / 2});
+    }
+}
+
+int tileCount(int size, int tile_size) {
+    return (size + tile_size - 1) / tile_size;
+}
+
+void put32(std::vector<unsigned char>& out, uint32_t value) {
+    for (int i = 0; i < 4; ++i) {
+        out.push_back(static_cast<unsigned char>(value >> (8 * i)));
+    }
+}
+
+void put64(std::vector<unsigned char>& out, uint64_t value) {
+    for (int i = 0; i < 8; ++i) {
+        out.push_back(static_cast<unsigned char>(value >> (8 * i)));
+    }
+}
+
+uint32_t get32(const unsigned char* data) {
+    uint32_t value = 0;
+    for (int i = 3; i >= 0; --i) {
+        value = (value << 8) | data[i];
+    }
+    return value;
+}
+
+uint64_t get64(const unsigned char* data) {
+    uint64_t value = 0;
+    for (int i = 7; i >= 0; --i) {
+        value = (value << 8) | data[i];
+    }
+    return value;
+}
+
+// PackBits: kontrol bayti n < 128 ise n + 1 ham bayt, n > 128 ise sonraki
+// bayt 257 - n kez tekrarlanir
+void encodePackBits(const unsigned char* data, size_t size, std::vector<unsigned char>& out) {
+    out.clear();
+    size_t i = 0;
+    while (i < size) {
+        size_t run = 1;
+        while (i + run < size && run < 128 && data[i + run] == data[i]) {
+            ++run;
+        }
+        if (run >= 2) {
+            out.push_back(static_cast<unsigned char>(257 - run));
+            out.push_back(data[i]);
+            i += run;
+            continue;
+        }
+        const size_t start = i;
+        while (i < size && i - start < 128 && !(i + 1 < size && data[i] == data[i + 1])) {
+            ++i;
+        }
+        out.push_back(static_cast<unsigned char>(i - start - 1));
+        out.insert(out.end(), data + start, data + i);
+    }
+}
+
+bool decodePackBits(const unsigned char* data, size_t size, unsigned char* out, size_t out_size) {
+    size_t in = 0;
+    size_t produced = 0;
+    while (in < size && produced < out_size) {
+        const unsigned int control = data[in++];
+        if (control < 128) {
+            const size_t length = control + 1;
+            if (size - in < length || out_size - produced < length) {
+                return false;
+            }
+            std::memcpy(out + produced, data + in, length);
+            in += length;
+            produced += length;
+        } else if (control > 128) {
+            const size_t length = 257 - control;
+            if (in >= size || out_size - produced < length) {
+                return false;
+            }
+            std::memset(out + produced, data[in++], length);
+            produced += length;
+        }
+    }
+    return produced == out_size && in == size;
+}
+
+} // namespace
+
+TiledImageWriter::TiledImageWriter(const std::string& filename, int width, int height, int channels)
+    : TiledImageWriter(filename, width, height, channels, Options()) {
+}
+
+TiledImageWriter::TiledImageWriter(const std::string& filename, int width, int height, int channels,
+                                   const Options& options)
+    : filename_(filename), channels_(channels), options_(options) {
+    if (width <= 0 || height <= 0 || channels <= 0 || channels > 4) {
+        throw std::invalid_argument("Gecersiz boyutlar");
+    }
+    if (options.tile_size < 16 || options.tile_size > 4096 || options.tile_size % 16 != 0) {
+        throw std::invalid_argument("Karo boyutu 16'nin kati ve 16..4096 araliginda olmali");
+    }
+    if (options.levels < 0 || options.levels > kMaxLevels) {
+        throw std::invalid_argument("Gecersiz seviye sayisi");
+    }
+
+    const int tile_size = options.tile_size;
+    size_t tiles = 0;
+    for (const LevelSize& size : levelSizes(width, height, tile_size, options.levels)) {
+        Level level;
+        level.width = size.width;
+        level.height = size.height;
+        level.tiles_x = tileCount(size.width, tile_size);
+        level.first_tile = tiles;
+        level.band.resize(static_cast<size_t>(tile_size) * size.width * channels);
+        tiles += static_cast<size_t>(level.tiles_x) * tileCount(size.height, tile_size);
+        levels_.push_back(std::move(level));
+    }
+    index_.resize(tiles);
+    tile_.resize(static_cast<size_t>(tile_size) * tile_size * channels);
+    downsampled_.resize(static_cast<size_t>(levels_.size() > 1 ? levels_[1].width : 0) * channels);
+
+    file_.open(filename, std::ios::binary);
+    if (!file_.is_open()) {
+        throw std::runtime_error("Dosya yazilamadi: " + filename);
+    }
+    // Baslik ve indeks finish()'te yazilir; karolar hizali ilk ofsetten baslar
+    const uint64_t header_bytes = kHeaderSize + kLevelEntrySize * levels_.size() + kTileEntrySize * tiles;
+    const std::vector<unsigned char> placeholder(
+        static_cast<size_t>((header_bytes + kTileAlignment - 1) / kTileAlignment * kTileAlignment), 0);
+    writeBytes(placeholder.data(), placeholder.size());
+}
+
+TiledImageWriter::~TiledImageWriter() = default;
+
+void TiledImageWriter::writeRows(const ConstImageView& rows) {
+    Level& base = levels_[0];
+    if (rows.getWidth() != base.width || rows.getChannels() != channels_) {
+        throw std::invalid_argument("Girdi ve cikti boyutlari uyusmuyor");
+    }
+    if (rows.getHeight() > base.height - base.received_rows) {
+        throw std::out_of_range("Goruntu sonundan sonra satir istendi");
+    }
+    for (int y = 0; y < rows.getHeight(); ++y) {
+        pushRow(0, rows.row(y));
+    }
+}
+
+void TiledImageWriter::pushRow(size_t index, const Image::Pixel* row) {
+    Level& level = levels_[index];
+    const size_t row_size = static_cast<size_t>(level.width) * channels_;
+    std::copy(row, row + row_size, level.band.data() + level.band_rows * row_size);
+    ++level.band_rows;
+    ++level.received_rows;
+    if (level.band_rows == options_.tile_size || level.received_rows == level.height) {
+        flushBand(index);
+    }
+}
+
+void TiledImageWriter::flushBand(size_t index) {
+    Level& level = levels_[index];
+    const int tile_y = (level.received_rows - level.band_rows) / options_.tile_size;
+    for (int tile_x = 0; tile_x < level.tiles_x; ++tile_x) {
+        writeTile(index, tile_x, tile_y);
+    }
+
+    // Seridin 2x2 ortalamasi bir sonraki seviyeye satir olarak verilir;
+    // karo boyutu cift oldugundan satir ciftleri seritler arasinda bolunmez
+    if (index + 1 < levels_.size()) {
+        const size_t row_size = static_cast<size_t>(level.width) * channels_;
+        const int next_width = levels_[index + 1].width;
+        for (int y = 0; y < level.band_rows; y += 2) {
+            const Image::Pixel* top = level.band.data() + y * row_size;
+            const Image::Pixel* bottom = level.band.data() + std::min(y + 1, level.band_rows - 1) * row_size;
+            for (int x = 0; x < next_width; ++x) {
+                const size_t left = static_cast<size_t>(2 * x) * channels_;
+                const size_t right = static_cast<size_t>(std::min(2 * x + 1, level.width - 1)) * channels_;
+                for (int c = 0; c < channels_; ++c) {
+                    const int sum = top[left + c] + top[right + c] + bottom[left + c] + bottom[right + c];
+                    downsampled_[x * channels_ + c] = static_cast<unsigned char>((sum + 2) >> 2);
+                }
+            }
+            pushRow(index + 1, downsampled_.data());
+        }
+    }
+    level.band_rows = 0;
+}
+
+void TiledImageWriter::writeTile(size_t index, int tile_x, int tile_y) {
+    const Level& level = levels_[index];
+    const int tile_size = options_.tile_size;
+    const size_t row_size = static_cast<size_t>(level.width) * channels_;
+    const size_t tile_row_size = static_cast<size_t>(tile_size) * channels_;
+    const int x0 = tile_x * tile_size;
+    const size_t copy_size = static_cast<size_t>(std::min(tile_size, level.width - x0)) * channels_;
+
+    // Kenar karolari sifirla doldurulur
+    std::fill(tile_.begin(), tile_.end(), 0);
+    for (int y = 0; y < level.band_rows; ++y) {
+        const Image::Pixel* source = level.band.data() + y * row_size + static_cast<size_t>(x0) * channels_;
+        std::copy(source, source + copy_size, tile_.data() + y * tile_row_size);
+    }
+
+    TileEntry& entry = index_[level.first_tile + static_cast<size_t>(tile_y) * level.tiles_x + tile_x];
+    if (options_.compress) {
+        encodePackBits(tile_.data(), tile_.size(), encoded_);
+        if (encoded_.size() < tile_.size()) {
+            entry = {position_, static_cast<uint32_t>(encoded_.size()), kPackBits};
+            writeBytes(encoded_.data(), encoded_.size());
+            return;
+        }
+    }
+
+    // Ham karo eslenmis dosyadan dogrudan okunabilsin diye hizalanir
+    const uint64_t padding = (kTileAlignment - position_ % kTileAlignment) % kTileAlignment;
+    if (padding > 0) {
+        encoded_.assign(static_cast<size_t>(padding), 0);
+        writeBytes(encoded_.data(), encoded_.size());
+    }
+    entry = {position_, static_cast<uint32_t>(tile_.size()), kRaw};
+    writeBytes(tile_.data(), tile_.size());
+}
+
+void TiledImageWriter::writeBytes(const unsigned char* data, size_t size) {
+    file_.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(size));
+    position_ += size;
+}
+
+void TiledImageWriter::finish() {
+    if (finished_) {
+        return;
+    }
+    if (levels_[0].received_rows != levels_[0].height) {
+        throw std::runtime_error("Dosya yazilamadi (eksik satir): " + filename_);
+    }
+
+    std::vector<unsigned char> header(kMagic, kMagic + sizeof(kMagic));
+    put32(header, kVersion);
+    put32(header, static_cast<uint32_t>(levels_[0].width));
+    put32(header, static_cast<uint32_t>(levels_[0].height));
+    put32(header, static_cast<uint32_t>(channels_));
+    put32(header, static_cast<uint32_t>(options_.tile_size));
+    put32(header, static_cast<uint32_t>(levels_.size()));
+    put32(header, options_.compress ? 1u : 0u);
+    put32(header, 0);
+    for (const Level& level : levels_) {
+        put32(header, static_cast<uint32_t>(level.width));
+        put32(header, static_cast<uint32_t>(level.height));
+    }
+    for (const TileEntry& entry : index_) {
+        put64(header, entry.offset);
+        put32(header, entry.size);
+        put32(header, entry.encoding);
+    }
+
+    file_.seekp(0);
+    file_.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()));
+    file_.close();
+    if (!file_) {
+        throw std::runtime_error("Dosya yazilamadi: " + filename_);
+    }
+    finished_ = true;
+}
+
+std::unique_ptr<TiledImageReader> TiledImageReader::open(const std::string& filename) {
+    std::unique_ptr<TiledImageReader> reader(new TiledImageReader());
+    reader->mapping_ = std::make_unique<FileMapping>();
+    if (!reader->mapping_->open(filename, FileMapping::Random)) {
+        return nullptr;
+    }
+    const unsigned char* data = reader->mapping_->data();
+    const size_t size = reader->mapping_->size();
+    if (size < kHeaderSize || std::memcmp(data, kMagic, sizeof(kMagic)) != 0 || get32(data + 8) != kVersion) {
+        return nullptr;
+    }
+
+    const uint32_t width = get32(data + 12);
+    const uint32_t height = get32(data + 16);
+    const uint32_t channels = get32(data + 20);
+    const uint32_t tile_size = get32(data + 24);
+    const uint32_t level_count = get32(data + 28);
+    if (width == 0 || width > 0x7FFFFFFF || height == 0 || height > 0x7FFFFFFF || channels == 0 ||
+        channels > 4 || tile_size < 16 || tile_size > 4096 || tile_size % 16 != 0 || level_count == 0 ||
+        level_count > kMaxLevels) {
+        return nullptr;
+    }
+    reader->channels_ = static_cast<int>(channels);
+    reader->tile_size_ = static_cast<int>(tile_size);
+
+    // Seviye tablosu yazicinin kuralina uymali
+    const auto sizes = levelSizes(static_cast<int>(width), static_cast<int>(height), reader->tile_size_,
+                                  static_cast<int>(level_count));
+    if (sizes.size() != level_count || size < kHeaderSize + kLevelEntrySize * level_count) {
+        return nullptr;
+    }
+    size_t tiles = 0;
+    for (uint32_t i = 0; i < level_count; ++i) {
+        const unsigned char* entry = data + kHeaderSize + kLevelEntrySize * i;
+        Level level;
+        level.width = static_cast<int>(get32(entry));
+        level.height = static_cast<int>(get32(entry + 4));
+        if (level.width != sizes[i].width || level.height != sizes[i].height) {
+            return nullptr;
+        }
+        level.tiles_x = tileCount(level.width, reader->tile_size_);
+        level.first_tile = tiles;
+        tiles += static_cast<size_t>(level.tiles_x) * tileCount(level.height, reader->tile_size_);
+        reader->levels_.push_back(level);
+    }
+
+    const size_t index_offset = kHeaderSize + kLevelEntrySize * level_count;
+    if ((size - index_offset) / kTileEntrySize < tiles) {
+        return nullptr;
+    }
+    const uint64_t tile_bytes = static_cast<uint64_t>(tile_size) * tile_size * channels;
+    reader->index_.resize(tiles);
+    for (size_t i = 0; i < tiles; ++i) {
+        const unsigned char* entry = data + index_offset + kTileEntrySize * i;
+        TileEntry& tile = reader->index_[i];
+        tile.offset = get64(entry);
+        tile.size = get32(entry + 8);
+        tile.encoding = get32(entry + 12);
+        const bool valid_encoding = tile.encoding == kRaw ? tile.size == tile_bytes
+                                                          : tile.encoding == kPackBits && tile.size > 0;
+        if (!valid_encoding || tile.offset > size || size - tile.offset < tile.size) {
+            return nullptr;
+        }
+    }
+    return reader;
+}
+
+TiledImageReader::~TiledImageReader() = default;
+
+const TiledImageReader::Level& TiledImageReader::level(int level) const {
+    if (level < 0 || level >= getLevelCount()) {
+        throw std::out_of_range("Gecersiz seviye");
+    }
+    return levels_[level];
+}
+
+int TiledImageReader::getWidth(int level) const {
+    return this->level(level).width;
+}
+
+int TiledImageReader::getHeight(int level) const {
+    return this->level(level).height;
+}
+
+void TiledImageReader::readRegion(int level_index, int x, int y, const ImageView& output) const {
+    const Level& level = this->level(level_index);
+    if (output.getChannels() != channels_) {
+        throw std::invalid_argument("Girdi ve cikti boyutlari uyusmuyor");
+    }
+    const int width = output.getWidth();
+    const int height = output.getHeight();
+    if (x < 0 || y < 0 || width < 0 || height < 0 || width > level.width - x || height > level.height - y) {
+        throw std::out_of_range("Bolge goruntu disinda");
+    }
+    if (width == 0 || height == 0) {
+        return;
+    }
+
+    const int tile_size = tile_size_;
+    const size_t tile_row_size = static_cast<size_t>(tile_size) * channels_;
+    ScratchBuffer<Image::Pixel, TileDecodeTag> decoded(tile_row_size * tile_size);
+
+    for (int tile_y = y / tile_size; tile_y <= (y + height - 1) / tile_size; ++tile_y) {
+        for (int tile_x = x / tile_size; tile_x <= (x + width - 1) / tile_size; ++tile_x) {
+            const TileEntry& entry = index_[level.first_tile + static_cast<size_t>(tile_y) * level.tiles_x + tile_x];
+            const unsigned char* stored = mapping_->data() + entry.offset;
+            const Image::Pixel* tile = stored;
+            if (entry.encoding == kPackBits) {
+                if (!decodePackBits(stored, entry.size, decoded.data(), tile_row_size * tile_size)) {
+                    throw std::runtime_error("Bozuk karo verisi");
+                }
+                tile = decoded.data();
+            }
+            tile_reads_.fetch_add(1, std::memory_order_relaxed);
+
+            // Karonun bolgeyle kesisimi kopyalanir
+            const int tile_left = tile_x * tile_size;
+            const int tile_top = tile_y * tile_size;
+            const int x0 = std::max(x, tile_left);
+            const int x1 = std::min(x + width, tile_left + tile_size);
+            const int y0 = std::max(y, tile_top);
+            const int y1 = std::min(y + height, tile_top + tile_size);
+            const size_t copy_size = static_cast<size_t>(x1 - x0) * channels_;
+            for (int row = y0; row < y1; ++row) {
+                const Image::Pixel* source = tile + (row - tile_top) * tile_row_size +
+                                             static_cast<size_t>(x0 - tile_left) * channels_;
+                std::copy(source, source + copy_size, output.row(row - y) + static_cast<size_t>(x0 - x) * channels_);
+            }
+        }
+    }
+}
+
+std::unique_ptr<Image> TiledImageReader::readRegion(int level, int x, int y, int width, int height) const {
+    auto image = std::make_unique<Image>(width, height, channels_, Image::Uninitialized);
+    readRegion(level, x, y, image->view());
+    return image;
+}
+
+} // namespace GorselIsleme
@@ -0,0 +1,52 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+
+// Dahili izleme sayaclari. Izlenen bir apply kendi sayacini cagiran thread'e
+// baglar; ThreadPool parallelFor yardimcilarina ayni sayaci tasir. Boylece
+// ayirmalar ve mesgul sure es zamanli apply'lar arasinda karismaz.
+
+namespace GorselIsleme {
+
+struct TraceCounters {
+    std::atomic<uint64_t> allocated_bytes{0}; // BufferPool ve ScratchBuffer ayirmalari
+    std::atomic<uint64_t> busy_ns{0};         // havuz govdelerinde gecen sure
+    TraceCounters* parent = nullptr;          // ic ice apply: dis sayac da artar
+
+    // Bu thread'de etkin sayac (yoksa nullptr)
+    static TraceCounters*& current() {
+        thread_local TraceCounters* counters = nullptr;
+        return counters;
+    }
+
+    static void addAllocated(uint64_t bytes) {
+        for (TraceCounters* counters = current(); counters; counters = counters->parent) {
+            counters->allocated_bytes.fetch_add(bytes, std::memory_order_relaxed);
+        }
+    }
+
+    static void addBusy(uint64_t nanoseconds) {
+        for (TraceCounters* counters = current(); counters; counters = counters->parent) {
+            counters->busy_ns.fetch_add(nanoseconds, std::memory_order_relaxed);
+        }
+    }
+};
+
+// Kapsam boyunca thread'in etkin sayacini degistirir
+class TraceCountersScope {
+public:
+    explicit TraceCountersScope(TraceCounters* counters) : previous_(TraceCounters::current()) {
+        TraceCounters::current() = counters;
+    }
+    ~TraceCountersScope() { TraceCounters::current() = previous_; }
+
+    TraceCounters* previous() const { return previous_; }
+
+    TraceCountersScope(const TraceCountersScope&) = delete;
+    TraceCountersScope& operator=(const TraceCountersScope&) = delete;
+
+private:
+    TraceCounters* previous_;
+};
+
+} // namespace GorselIsleme
@@ -0,0 +1,198 @@
+#include "BatchProcessor.h"
+#include "PipelineSpec.h"
+#include "ThreadPool.h"
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace GorselIsleme;
+
+namespace {
+
+void printUsage(const char* program) {
+    std::cerr << "Kullanim: " << program << " -p TANIM [secenekler] <dizin | dosya | @liste>...\n"
+              << "  -p, --pipeline TANIM   ornek: \"blur:1.5:5,brightness:1.2,edge\"\n"
+              << "  -o, --output DIZIN     sonuclarin yazilacagi dizin (yoksa yalnizca islenir)\n"
+              << "  -s, --suffix EK        cikti dosya adi eki (varsayilan: bos)\n"
+              << "  -j, --threads N        thread sayisi (varsayilan: donanim)\n"
+              << "  -t, --tiled [GxY]      karo bazli calisma, istege bagli karo boyutu\n"
+              << "  -q, --quiet            goruntu basina satir yazma\n"
+              << "      --trace DOSYA      asama zamanlarini Chrome trace JSON olarak yaz\n"
+              << "      --stats            filtre basina sure/throughput ozeti yazdir\n"
+              << "  @liste                 her satirda bir dosya yolu olan liste dosyasi\n";
+}
+
+bool parseTileSize(const std::string& text, int& width, int& height) {
+    const size_t separator = text.find('x');
+    if (separator == std::string::npos) {
+        return false;
+    }
+    width = std::atoi(text.substr(0, separator).c_str());
+    height = std::atoi(text.substr(separator + 1).c_str());
+    return width > 0 && height > 0;
+}
+
+bool collectInputs(const std::string& argument, std::vector<std::string>& files) {
+    if (!argument.empty() && argument[0] == '@') {
+        std::ifstream list(argument.substr(1));
+        if (!list.is_open()) {
+            std::cerr << "Liste dosyasi acilamadi: " << argument.substr(1) << "\n";
+            return false;
+        }
+        std::string line;
+        while (std::getline(list, line)) {
+            if (!line.empty() && line.back() == '\r') {
+                line.pop_back();
+            }
+            if (!line.empty()) {
+                files.push_back(line);
+            }
+        }
+        return true;
+    }
+
+    // Dizin degilse dosya kabul edilir; okunamazsa o oge hata olarak raporlanir
+    try {
+        const auto listed = listImageFiles(argument);
+        files.insert(files.end(), listed.begin(), listed.end());
+    } catch (const std::invalid_argument&) {
+        files.push_back(argument);
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::string spec;
+    BatchOptions options;
+    bool tiled = false;
+    int tile_width = 0;
+    int tile_height = 0;
+    bool quiet = false;
+    std::string trace_file;
+    bool print_stats = false;
+    std::vector<std::string> files;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string argument = argv[i];
+        const bool has_value = i + 1 < argc;
+        if ((argument == "-p" || argument == "--pipeline") && has_value) {
+            spec = argv[++i];
+        } else if ((argument == "-o" || argument == "--output") && has_value) {
+            options.output_directory = argv[++i];
+        } else if ((argument == "-s" || argument == "--suffix") && has_value) {
+            options.output_suffix = argv[++i];
+        } else if ((argument == "-j" || argument == "--threads") && has_value) {
+            const int threads = std::atoi(argv[++i]);
+            if (threads <= 0) {
+                std::cerr << "Gecersiz thread sayisi\n";
+                return 2;
+            }
+            ThreadPool::setGlobalThreadCount(static_cast<size_t>(threads));
+        } else if (argument == "-t" || argument == "--tiled") {
+            tiled = true;
+            if (has_value && parseTileSize(argv[i + 1], tile_width, tile_height)) {
+                ++i;
+            }
+        } else if (argument == "-q" || argument == "--quiet") {
+            quiet = true;
+        } else if (argument == "--trace" && has_value) {
+            trace_file = argv[++i];
+        } else if (argument == "--stats") {
+            print_stats = true;
+        } else if (argument == "-h" || argument == "--help") {
+            printUsage(argv[0]);
+            return 0;
+        } else if (!argument.empty() && argument[0] == '-') {
+            std::cerr << "Bilinmeyen secenek: " << argument << "\n";
+            printUsage(argv[0]);
+            return 2;
+        } else if (!collectInputs(argument, files)) {
+            return 2;
+        }
+    }
+
+    if (spec.empty() || files.empty()) {
+        printUsage(argv[0]);
+        return 2;
+    }
+
+    std::unique_ptr<FilterPipeline> pipeline;
+    try {
+        pipeline = parsePipelineSpec(spec);
+    } catch (const std::invalid_argument& error) {
+        std::cerr << error.what() << "\n";
+        return 2;
+    }
+    if (tiled) {
+        pipeline->setExecutionMode(FilterPipeline::Tiled);
+        if (tile_width > 0) {
+            pipeline->setTileSize(tile_width, tile_height);
+        }
+    }
+
+    // Isci kopyalari gozlemciyi paylasir
+    auto stats = std::make_shared<PipelineStats>();
+    auto recorder = std::make_shared<ChromeTraceRecorder>();
+    if (print_stats || !trace_file.empty()) {
+        auto observers = std::make_shared<ObserverGroup>();
+        if (print_stats) {
+            observers->add(stats);
+        }
+        if (!trace_file.empty()) {
+            observers->add(recorder);
+        }
+        pipeline->setObserver(observers);
+    }
+
+    std::mutex output_mutex;
+    options.on_item = [&](const BatchItemResult& item) {
+        if (quiet && item.success) {
+            return;
+        }
+        char line[64];
+        std::snprintf(line, sizeof(line), "%-5s %9.2f ms  %5dx%-5d ", item.success ? "OK" : "HATA",
+                      item.latency_ms, item.width, item.height);
+        std::lock_guard<std::mutex> lock(output_mutex);
+        std::cout << line << item.name;
+        if (!item.success) {
+            std::cout << ": " << item.error;
+        }
+        std::cout << "\n";
+    };
+
+    BatchReport report;
+    try {
+        report = processBatch(files, *pipeline, options);
+    } catch (const std::exception& error) {
+        std::cerr << "Toplu islem basarisiz: " << error.what() << "\n";
+        return 2;
+    }
+
+    char summary[256];
+    std::snprintf(summary, sizeof(summary),
+                  "%zu goruntu, %zu hata, %.1f ms | %.2f goruntu/s, %.2f Mpix/s | gecikme p50 %.2f ms, p99 %.2f ms",
+                  report.items.size(), report.failed, report.wall_ms, report.imagesPerSecond(),
+                  report.megapixelsPerSecond(), report.latencyPercentile(50), report.latencyPercentile(99));
+    std::cout << summary << "\n";
+
+    if (print_stats) {
+        for (const auto& entry : stats->snapshot()) {
+            char line[256];
+            std::snprintf(line, sizeof(line), "  %-32s %6llu x  toplam %9.1f ms  p50 %7.2f ms  p99 %7.2f ms  %8.1f Mpix/s",
+                          entry.name.c_str(), static_cast<unsigned long long>(entry.count), entry.total_ms,
+                          entry.p50_ms, entry.p99_ms, entry.megapixelsPerSecond());
+            std::cout << line << "\n";
+        }
+    }
+    if (!trace_file.empty() && !recorder->save(trace_file)) {
+        std::cerr << "Trace yazilamadi: " << trace_file << "\n";
+    }
+
+    return report.failed == 0 ? 0 : 1;
+}
@@ -3,6 +3,7 @@
 #include "EdgeDetection.h"
 #include "BrightnessAdjust.h"
 #include "FilterPipeline.h"
+#include "FilterGraph.h"
 #include "ImageViewer.h"
 #include <iostream>
 #include <string>
@@ -38,17 +39,18 @@ int main() {
     
     viewer.goster("Orijinal", *gorsel);
     
-    GaussianBlur bulanik_filtresi(10.0, 9);
-    auto bulanik_sonuc = bulanik_filtresi.apply(*gorsel);
-    viewer.goster("Bulanik", *bulanik_sonuc);
-
-    EdgeDetection kenar_filtresi;
-    auto kenar_sonuc = kenar_filtresi.apply(*bulanik_sonuc);
-    viewer.goster("Kenar", *kenar_sonuc);
-
-   BrightnessAdjust parlaklik_filtresi(0.1);
-   auto parlak_sonuc = parlaklik_filtresi.apply(*gorsel);
-   viewer.goster("Parlak", *parlak_sonuc);
+    // Bulanik -> kenar ve parlak dallari tek grafta, eszamanli
+    FilterGraph graf;
+    auto kaynak = graf.addInput();
+    auto bulanik = graf.addNode(std::make_unique<GaussianBlur>(10.0, 9), kaynak);
+    graf.addOutput(bulanik);
+    graf.addOutput(graf.addNode(std::make_unique<EdgeDetection>(), bulanik));
+    graf.addOutput(graf.addNode(std::make_unique<BrightnessAdjust>(0.1), kaynak));
+    auto sonuclar = graf.run({gorsel.get()});
+
+    viewer.goster("Bulanik", *sonuclar[0]);
+    viewer.goster("Kenar", *sonuclar[1]);
+    viewer.goster("Parlak", *sonuclar[2]);
 
     
     std::cout << "Tamamlandi! Cikmak icin bir tusa basin...\n";
@@ -0,0 +1,92 @@
+#pragma once
+#include "Image.h"
+#include "Filter.h"
+#include "GaussianBlur.h"
+#include "ThreadPool.h"
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+// Testler ve olcumler icin ortak yardimcilar
+
+namespace GorselIsleme {
+namespace test {
+
+// Tekrarlanabilir gurultu icin LCG adimi; ust 16 bitin alt bayti piksel olur
+inline unsigned nextRandom(unsigned& seed) {
+    seed = seed * 1103515245u + 12345u;
+    return seed >> 16;
+}
+
+// Ham depolamanin tamamini seed'den uretilen gurultuyle doldurur
+inline void fillNoise(Image& image, unsigned seed) {
+    for (auto& value : image.getData()) {
+        value = static_cast<Image::Pixel>(nextRandom(seed));
+    }
+}
+
+inline Image makeNoiseImage(int width, int height, int channels, unsigned seed) {
+    Image image(width, height, channels, Image::Uninitialized);
+    fillNoise(image, seed);
+    return image;
+}
+
+// Cagrilari ve islenen girdi piksellerini sayan bulaniklastirma; parmak izi
+// GaussianBlur'inki oldugundan onbellek ve ortak alt ifade testlerinde
+// gercek bir GaussianBlur yerine gecer
+class CountingBlur : public GaussianBlur {
+public:
+    struct Counts {
+        std::atomic<int> calls{0};
+        std::atomic<long> pixels{0};
+
+        void reset() {
+            calls = 0;
+            pixels = 0;
+        }
+    };
+
+    explicit CountingBlur(Counts& counts, double sigma = 2.0, int kernel_size = 5)
+        : GaussianBlur(sigma, kernel_size), counts_(counts) {}
+
+    using GaussianBlur::apply;
+    void apply(const ConstImageView& input, const ImageView& output) const override {
+        ++counts_.calls;
+        counts_.pixels += static_cast<long>(input.getWidth()) * input.getHeight();
+        GaussianBlur::apply(input, output);
+    }
+    std::unique_ptr<Filter> clone() const override { return std::make_unique<CountingBlur>(*this); }
+
+private:
+    Counts& counts_;
+};
+
+// Her cagrida std::invalid_argument atar; hata yayilimi testleri icin
+class ThrowingFilter : public Filter {
+public:
+    void apply(const ConstImageView&, const ImageView&) const override {
+        throw std::invalid_argument("bozuk");
+    }
+    std::string getName() const override { return "Throwing"; }
+    std::unique_ptr<Filter> clone() const override { return std::make_unique<ThrowingFilter>(); }
+    int getRadius() const override { return 0; }
+};
+
+// Kapsam boyunca global havuzun thread sayisini degistirir, cikista eskisine doner
+class ThreadCountGuard {
+public:
+    explicit ThreadCountGuard(size_t thread_count) : saved_(ThreadPool::global().getThreadCount()) {
+        ThreadPool::setGlobalThreadCount(thread_count);
+    }
+    ~ThreadCountGuard() { ThreadPool::setGlobalThreadCount(saved_); }
+
+    ThreadCountGuard(const ThreadCountGuard&) = delete;
+    ThreadCountGuard& operator=(const ThreadCountGuard&) = delete;
+
+private:
+    size_t saved_;
+};
+
+} // namespace test
+} // namespace GorselIsleme
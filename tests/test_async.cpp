@@ -0,0 +1,340 @@
+#include <gtest/gtest.h>
+#include "AsyncExecutor.h"
+#include "GaussianBlur.h"
+#include "EdgeDetection.h"
+#include "ThreadPool.h"
+#include "TestUtils.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+using namespace GorselIsleme;
+using namespace GorselIsleme::test;
+
+namespace {
+
+// Acilana kadar calisan isi tutan filtre; kopyalar ayni kapiyi paylasir
+struct Gate {
+    std::mutex mutex;
+    std::condition_variable changed;
+    bool open = false;
+    int entered = 0;
+
+    void release() {
+        std::lock_guard<std::mutex> lock(mutex);
+        open = true;
+        changed.notify_all();
+    }
+
+    void waitEntered(int count) {
+        std::unique_lock<std::mutex> lock(mutex);
+        changed.wait(lock, [&]() { return entered >= count; });
+    }
+};
+
+class GateFilter : public Filter {
+public:
+    explicit GateFilter(std::shared_ptr<Gate> gate) : gate_(std::move(gate)) {}
+
+    void apply(const ConstImageView& input, const ImageView& output) const override {
+        checkViews(input, output);
+        {
+            std::unique_lock<std::mutex> lock(gate_->mutex);
+            ++gate_->entered;
+            gate_->changed.notify_all();
+            gate_->changed.wait(lock, [this]() { return gate_->open; });
+        }
+        for (int y = 0; y < input.getHeight(); ++y) {
+            std::copy(input.row(y), input.row(y) + input.getRowSize(), output.row(y));
+        }
+    }
+
+    std::string getName() const override { return "Gate"; }
+    std::unique_ptr<Filter> clone() const override { return std::make_unique<GateFilter>(gate_); }
+    int getRadius() const override { return 0; }
+
+private:
+    std::shared_ptr<Gate> gate_;
+};
+
+// Cagri sayar; istenirse ilk cagrida verilen token'i iptal eder
+class CountingFilter : public Filter {
+public:
+    CountingFilter(std::atomic<int>& calls, CancellationToken* cancel_on_call = nullptr)
+        : calls_(calls), cancel_on_call_(cancel_on_call) {
+    }
+
+    void apply(const ConstImageView& input, const ImageView& output) const override {
+        checkViews(input, output);
+        ++calls_;
+        if (cancel_on_call_) {
+            cancel_on_call_->cancel();
+        }
+        for (int y = 0; y < input.getHeight(); ++y) {
+            std::copy(input.row(y), input.row(y) + input.getRowSize(), output.row(y));
+        }
+    }
+
+    std::string getName() const override { return "Counting"; }
+    std::unique_ptr<Filter> clone() const override { return std::make_unique<CountingFilter>(calls_, cancel_on_call_); }
+    int getRadius() const override { return 1; }
+
+private:
+    std::atomic<int>& calls_;
+    CancellationToken* cancel_on_call_;
+};
+
+} // namespace
+
+class AsyncExecutorTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        auto blur_edge = std::make_shared<FilterPipeline>();
+        blur_edge->addFilter(std::make_unique<GaussianBlur>(1.5, 5));
+        blur_edge->addFilter(std::make_unique<EdgeDetection>());
+        pipeline = blur_edge;
+
+        gate = std::make_shared<Gate>();
+        auto gated = std::make_shared<FilterPipeline>();
+        gated->addFilter(std::make_unique<GateFilter>(gate));
+        gated_pipeline = gated;
+    }
+
+    void TearDown() override {
+        gate->release();
+    }
+
+    static Image makeImage(int width, int height, unsigned seed) {
+        return makeNoiseImage(width, height, 1, seed);
+    }
+
+    ThreadCountGuard thread_count{2};
+    std::shared_ptr<const FilterPipeline> pipeline;
+    std::shared_ptr<Gate> gate;
+    std::shared_ptr<const FilterPipeline> gated_pipeline;
+};
+
+TEST_F(AsyncExecutorTest, FutureMatchesApplyTest) {
+    AsyncExecutor executor;
+    std::vector<Image> inputs;
+    std::vector<JobHandle> handles;
+    for (int i = 0; i < 6; ++i) {
+        inputs.push_back(makeImage(50 + 9 * i, 40 + 3 * i, 11u + i));
+        handles.push_back(executor.submit(inputs.back(), pipeline));
+    }
+    for (size_t i = 0; i < handles.size(); ++i) {
+        auto output = handles[i].getFuture().get();
+        EXPECT_EQ(output->getData(), pipeline->apply(inputs[i])->getData());
+        EXPECT_EQ(handles[i].getState(), JobHandle::Completed);
+    }
+    executor.shutdown();
+    EXPECT_EQ(executor.getStats().completed, 6u);
+}
+
+TEST_F(AsyncExecutorTest, CallbackTest) {
+    AsyncExecutor executor;
+    const Image input = makeImage(64, 48, 5u);
+    std::unique_ptr<Image> received;
+    JobResult::Status status = JobResult::Failed;
+    auto handle = executor.submit(input, pipeline, [&](JobResult& result) {
+        status = result.status;
+        received = std::move(result.output);
+    });
+    handle.wait();
+    EXPECT_EQ(status, JobResult::Completed);
+    ASSERT_TRUE(received);
+    EXPECT_EQ(received->getData(), pipeline->apply(input)->getData());
+    EXPECT_THROW(handle.getFuture(), std::runtime_error);
+}
+
+TEST_F(AsyncExecutorTest, CancelQueuedTest) {
+    ExecutorOptions options;
+    options.workers = 1;
+    AsyncExecutor executor(options);
+    auto blocker = executor.submit(makeImage(8, 8, 1u), gated_pipeline);
+    gate->waitEntered(1);
+
+    auto queued = executor.submit(makeImage(8, 8, 2u), pipeline);
+    EXPECT_EQ(queued.getState(), JobHandle::Queued);
+    queued.cancel();
+    // Kuyruktaki is calisani beklemeden sonlanir
+    EXPECT_EQ(queued.getState(), JobHandle::Cancelled);
+    try {
+        queued.getFuture().get();
+        FAIL() << "OperationCancelled bekleniyordu";
+    } catch (const OperationCancelled& error) {
+        EXPECT_EQ(error.getReason(), OperationCancelled::Cancelled);
+    }
+
+    gate->release();
+    EXPECT_NO_THROW(blocker.getFuture().get());
+    executor.shutdown();
+    const ExecutorStats stats = executor.getStats();
+    EXPECT_EQ(stats.completed, 1u);
+    EXPECT_EQ(stats.cancelled, 1u);
+    EXPECT_EQ(stats.queued, 0u);
+}
+
+TEST_F(AsyncExecutorTest, CancelRunningBetweenStagesTest) {
+    std::atomic<int> calls{0};
+    auto staged = std::make_shared<FilterPipeline>();
+    staged->addFilter(std::make_unique<GateFilter>(gate));
+    staged->addFilter(std::make_unique<CountingFilter>(calls));
+
+    AsyncExecutor executor;
+    auto handle = executor.submit(makeImage(32, 32, 3u), staged);
+    gate->waitEntered(1);
+    EXPECT_EQ(handle.getState(), JobHandle::Running);
+    handle.cancel();
+    gate->release();
+
+    EXPECT_THROW(handle.getFuture().get(), OperationCancelled);
+    EXPECT_EQ(handle.getState(), JobHandle::Cancelled);
+    EXPECT_EQ(calls.load(), 0);
+}
+
+TEST_F(AsyncExecutorTest, CancelBetweenTilesTest) {
+    ThreadPool::setGlobalThreadCount(1);
+    CancellationToken token;
+    std::atomic<int> calls{0};
+    FilterPipeline tiled;
+    tiled.addFilter(std::make_unique<CountingFilter>(calls, &token));
+    tiled.setExecutionMode(FilterPipeline::Tiled);
+    tiled.setTileSize(16, 16);
+
+    // 8x8 karo; ilk karodan sonra durur
+    EXPECT_THROW(tiled.apply(makeImage(128, 128, 4u), token), OperationCancelled);
+    EXPECT_EQ(calls.load(), 1);
+
+    CancellationToken fresh;
+    calls = 0;
+    tiled.clear();
+    tiled.addFilter(std::make_unique<CountingFilter>(calls));
+    EXPECT_NO_THROW(tiled.apply(makeImage(128, 128, 4u), fresh));
+    EXPECT_EQ(calls.load(), 64);
+}
+
+TEST_F(AsyncExecutorTest, DeadlineTest) {
+    ExecutorOptions options;
+    options.workers = 1;
+    AsyncExecutor executor(options);
+
+    auto late = executor.submit(makeImage(8, 8, 1u), pipeline, JobOptions::withTimeout(std::chrono::milliseconds(-1)));
+    try {
+        late.getFuture().get();
+        FAIL() << "OperationCancelled bekleniyordu";
+    } catch (const OperationCancelled& error) {
+        EXPECT_EQ(error.getReason(), OperationCancelled::DeadlineExceeded);
+    }
+    EXPECT_EQ(late.getState(), JobHandle::DeadlineExceeded);
+
+    // Kuyrukta beklerken son tarihi gecen is hic baslamaz
+    auto blocker = executor.submit(makeImage(8, 8, 2u), gated_pipeline);
+    gate->waitEntered(1);
+    auto queued = executor.submit(makeImage(8, 8, 3u), gated_pipeline,
+                                  JobOptions::withTimeout(std::chrono::milliseconds(20)));
+    std::this_thread::sleep_for(std::chrono::milliseconds(40));
+    gate->release();
+    EXPECT_THROW(queued.getFuture().get(), OperationCancelled);
+    EXPECT_EQ(queued.getState(), JobHandle::DeadlineExceeded);
+    EXPECT_NO_THROW(blocker.getFuture().get());
+
+    executor.shutdown();
+    EXPECT_EQ(gate->entered, 1);
+    EXPECT_EQ(executor.getStats().expired, 2u);
+}
+
+TEST_F(AsyncExecutorTest, PriorityOrderTest) {
+    ExecutorOptions options;
+    options.workers = 1;
+    AsyncExecutor executor(options);
+    auto blocker = executor.submit(makeImage(8, 8, 1u), gated_pipeline);
+    gate->waitEntered(1);
+
+    std::mutex mutex;
+    std::vector<int> order;
+    std::vector<JobHandle> handles;
+    const JobOptions::Priority priorities[] = {JobOptions::Low, JobOptions::Normal, JobOptions::High,
+                                               JobOptions::Low, JobOptions::High};
+    for (int i = 0; i < 5; ++i) {
+        JobOptions job_options;
+        job_options.priority = priorities[i];
+        handles.push_back(executor.submit(makeImage(8, 8, 2u), pipeline, [&mutex, &order, i](JobResult&) {
+            std::lock_guard<std::mutex> lock(mutex);
+            order.push_back(i);
+        }, job_options));
+    }
+    gate->release();
+    for (auto& handle : handles) {
+        handle.wait();
+    }
+    EXPECT_EQ(order, (std::vector<int>{2, 4, 1, 0, 3}));
+}
+
+TEST_F(AsyncExecutorTest, BackpressureTest) {
+    ExecutorOptions options;
+    options.workers = 1;
+    options.queue_capacity = 2;
+    AsyncExecutor executor(options);
+    auto blocker = executor.submit(makeImage(8, 8, 1u), gated_pipeline);
+    gate->waitEntered(1);
+
+    auto first = executor.trySubmit(makeImage(8, 8, 2u), pipeline);
+    auto second = executor.trySubmit(makeImage(8, 8, 3u), pipeline);
+    auto rejected = executor.trySubmit(makeImage(8, 8, 4u), pipeline);
+    EXPECT_TRUE(first.valid());
+    EXPECT_TRUE(second.valid());
+    EXPECT_FALSE(rejected.valid());
+    EXPECT_EQ(executor.getStats().rejected, 1u);
+    EXPECT_EQ(executor.getStats().queued, 2u);
+
+    // submit kuyrukta yer acilana kadar bekler
+    std::atomic<bool> submitted{false};
+    std::thread producer([&]() {
+        executor.submit(makeImage(8, 8, 5u), pipeline).wait();
+        submitted = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_FALSE(submitted.load());
+    gate->release();
+    producer.join();
+    EXPECT_TRUE(submitted.load());
+}
+
+TEST_F(AsyncExecutorTest, SmallJobNotBlockedTest) {
+    ExecutorOptions options;
+    options.workers = 2;
+    options.small_job_pixels = 64 * 64;
+    AsyncExecutor executor(options);
+
+    // Iki buyuk is: biri genel dagiticida kapida bekler, digeri kuyrukta
+    auto big1 = executor.submit(makeImage(256, 256, 1u), gated_pipeline);
+    auto big2 = executor.submit(makeImage(256, 256, 2u), gated_pipeline);
+    gate->waitEntered(1);
+
+    auto small = executor.submit(makeImage(32, 32, 3u), pipeline);
+    EXPECT_TRUE(small.waitFor(std::chrono::seconds(10)));
+    EXPECT_EQ(small.getState(), JobHandle::Completed);
+    EXPECT_EQ(big2.getState(), JobHandle::Queued);
+
+    gate->release();
+    EXPECT_NO_THROW(big1.getFuture().get());
+    EXPECT_NO_THROW(big2.getFuture().get());
+}
+
+TEST_F(AsyncExecutorTest, FailureAndShutdownTest) {
+    auto broken = std::make_shared<FilterPipeline>();
+    broken->addFilter(std::make_unique<ThrowingFilter>());
+
+    AsyncExecutor executor;
+    auto handle = executor.submit(makeImage(8, 8, 1u), broken);
+    EXPECT_THROW(handle.getFuture().get(), std::invalid_argument);
+    EXPECT_EQ(handle.getState(), JobHandle::Failed);
+
+    EXPECT_THROW(executor.submit(makeImage(8, 8, 1u), nullptr), std::invalid_argument);
+    executor.shutdown();
+    EXPECT_EQ(executor.getStats().failed, 1u);
+    EXPECT_THROW(executor.submit(makeImage(8, 8, 1u), pipeline), std::runtime_error);
+}
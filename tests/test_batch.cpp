@@ -0,0 +1,193 @@
+#include <gtest/gtest.h>
+#include "BatchProcessor.h"
+#include "PipelineSpec.h"
+#include "GaussianBlur.h"
+#include "EdgeDetection.h"
+#include "BrightnessAdjust.h"
+#include "ThreadPool.h"
+#include "TestUtils.h"
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+
+using namespace GorselIsleme;
+using namespace GorselIsleme::test;
+
+class BatchTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        saved_thread_count = ThreadPool::global().getThreadCount();
+        ThreadPool::setGlobalThreadCount(4);
+
+        pipeline.addFilter(std::make_unique<GaussianBlur>(1.5, 5));
+        pipeline.addFilter(std::make_unique<BrightnessAdjust>(1.2));
+        pipeline.addFilter(std::make_unique<EdgeDetection>());
+
+        for (int i = 0; i < 9; ++i) {
+            // Farkli boyutlar: hazirlanmis planin yeniden kurulmasi da sinanir
+            images.push_back(std::make_unique<Image>(makeNoiseImage(40 + 7 * (i % 3), 30 + 5 * i, 1, 17u + i)));
+        }
+
+        directory = std::filesystem::temp_directory_path() / "gorselisleme_batch_test";
+        std::filesystem::remove_all(directory);
+        std::filesystem::create_directories(directory);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(directory);
+        ThreadPool::setGlobalThreadCount(saved_thread_count);
+    }
+
+    size_t saved_thread_count = 0;
+    FilterPipeline pipeline;
+    std::vector<std::unique_ptr<Image>> images;
+    std::filesystem::path directory;
+};
+
+TEST_F(BatchTest, ImagesMatchPipelineTest) {
+    std::vector<const Image*> inputs;
+    for (const auto& image : images) {
+        inputs.push_back(image.get());
+    }
+
+    std::atomic<int> callbacks{0};
+    BatchOptions options;
+    options.on_item = [&](const BatchItemResult&) { ++callbacks; };
+    const BatchReport report = processBatch(inputs, pipeline, options);
+
+    ASSERT_EQ(report.items.size(), images.size());
+    EXPECT_EQ(report.succeeded, images.size());
+    EXPECT_EQ(report.failed, 0u);
+    EXPECT_EQ(callbacks.load(), static_cast<int>(images.size()));
+    for (size_t i = 0; i < images.size(); ++i) {
+        const auto& item = report.items[i];
+        EXPECT_EQ(item.index, i);
+        EXPECT_TRUE(item.success);
+        ASSERT_NE(item.output, nullptr);
+        EXPECT_EQ(item.output->getData(), pipeline.apply(*images[i])->getData()) << i;
+    }
+    EXPECT_GT(report.megapixelsPerSecond(), 0.0);
+    EXPECT_LE(report.latencyPercentile(50), report.latencyPercentile(100));
+}
+
+TEST_F(BatchTest, FailureDoesNotStopBatchTest) {
+    std::vector<const Image*> inputs = {images[0].get(), nullptr, images[1].get()};
+    BatchOptions options;
+    options.concurrency = 1;
+    const BatchReport report = processBatch(inputs, pipeline, options);
+
+    EXPECT_EQ(report.succeeded, 2u);
+    EXPECT_EQ(report.failed, 1u);
+    EXPECT_FALSE(report.items[1].success);
+    EXPECT_FALSE(report.items[1].error.empty());
+    EXPECT_TRUE(report.items[2].success);
+}
+
+TEST_F(BatchTest, FilesTest) {
+    std::vector<std::string> files;
+    for (size_t i = 0; i < 5; ++i) {
+        const auto path = directory / ("girdi" + std::to_string(i) + ".pgm");
+        ASSERT_TRUE(images[i]->save(path.string()));
+        files.push_back(path.string());
+    }
+    // Bozuk ve eksik dosyalar yalnizca kendi ogelerini basarisiz yapar
+    const auto broken = directory / "bozuk.pgm";
+    std::ofstream(broken) << "P2\n1 1\n255\n0\n";
+    files.insert(files.begin() + 2, broken.string());
+    files.push_back((directory / "yok.pgm").string());
+
+    EXPECT_EQ(listImageFiles(directory.string()).size(), 6u);
+    EXPECT_THROW(listImageFiles((directory / "yok").string()), std::invalid_argument);
+
+    BatchOptions options;
+    options.output_directory = (directory / "cikti").string();
+    options.output_suffix = "_sonuc";
+    const BatchReport report = processBatch(files, pipeline, options);
+
+    ASSERT_EQ(report.items.size(), 7u);
+    EXPECT_EQ(report.succeeded, 5u);
+    EXPECT_EQ(report.failed, 2u);
+    EXPECT_FALSE(report.items[2].success);
+    EXPECT_FALSE(report.items[6].success);
+
+    for (size_t i = 0; i < 5; ++i) {
+        const auto output = directory / "cikti" / ("girdi" + std::to_string(i) + "_sonuc.pgm");
+        auto loaded = Image::load(output.string());
+        ASSERT_NE(loaded, nullptr) << output;
+        EXPECT_EQ(loaded->getData(), pipeline.apply(*images[i])->getData());
+    }
+}
+
+TEST_F(BatchTest, OutputConflictsTest) {
+    // a.jpg ve a.pgm ayni a.pgm'ye yazardi; kaynak dizine soneksiz yazilan
+    // b.pgm ve c.pgm kendi uzerlerine yazardi. Hicbiri islenmez.
+    const auto source = directory / "kaynak";
+    std::filesystem::create_directories(source);
+    ASSERT_TRUE(images[0]->save((source / "a.pgm").string()));
+    std::ofstream(source / "a.jpg") << "jpeg";
+    ASSERT_TRUE(images[1]->save((directory / "b.pgm").string()));
+    ASSERT_TRUE(images[2]->save((directory / "c.pgm").string()));
+    const std::vector<std::string> files = {(source / "a.pgm").string(), (source / "a.jpg").string(),
+                                            (directory / "b.pgm").string(), (directory / "c.pgm").string()};
+
+    BatchOptions options;
+    options.output_directory = directory.string();
+    const BatchReport report = processBatch(files, pipeline, options);
+
+    ASSERT_EQ(report.items.size(), 4u);
+    EXPECT_EQ(report.succeeded, 0u);
+    EXPECT_EQ(report.failed, 4u);
+    for (const auto& item : report.items) {
+        EXPECT_FALSE(item.error.empty()) << item.name;
+    }
+    EXPECT_FALSE(std::filesystem::exists(directory / "a.pgm"));
+    EXPECT_EQ(Image::load((directory / "b.pgm").string())->getData(), images[1]->getData());
+
+    options.output_directory = (directory / "cikti").string();
+    const BatchReport separate = processBatch({files[2], files[3]}, pipeline, options);
+    EXPECT_EQ(separate.succeeded, 2u);
+}
+
+TEST_F(BatchTest, PipelineSpecTest) {
+    auto parsed = parsePipelineSpec(" Blur:1.5:5 , brightness:1.2,edge:both:l1,invert,gamma:0.8,contrast:1.1,threshold:100");
+    EXPECT_EQ(parsed->getAllFilterNames(),
+              (std::vector<std::string>{"GaussianBlur", "BrightnessAdjust", "EdgeDetection", "Invert",
+                                        "GammaCorrection", "ContrastAdjust", "Threshold"}));
+
+    auto blur = parsePipelineSpec("blur:2");
+    EXPECT_EQ(blur->getRadius(), 6);
+    EXPECT_EQ(parsePipelineSpec("blur:6:37:box")->getRadius(), GaussianBlur(6.0, 37, GaussianBlur::StackedBox).getRadius());
+
+    auto spec_pipeline = parsePipelineSpec("blur:1.5:5,brightness:1.2,edge");
+    EXPECT_EQ(spec_pipeline->apply(*images[0])->getData(), pipeline.apply(*images[0])->getData());
+
+    EXPECT_THROW(parsePipelineSpec(""), std::invalid_argument);
+    EXPECT_THROW(parsePipelineSpec("blur"), std::invalid_argument);
+    EXPECT_THROW(parsePipelineSpec("blur:abc"), std::invalid_argument);
+    EXPECT_THROW(parsePipelineSpec("blur:1.0:4"), std::invalid_argument);
+    auto scharr = parsePipelineSpec("edge:both:l1:scharr");
+    EXPECT_EQ(scharr->apply(*images[0])->getData(),
+              EdgeDetection(EdgeDetection::Both, EdgeDetection::L1, EdgeDetection::Scharr).apply(*images[0])->getData());
+
+    EXPECT_THROW(parsePipelineSpec("edge:diagonal"), std::invalid_argument);
+    EXPECT_THROW(parsePipelineSpec("edge:both:l2:prewitt"), std::invalid_argument);
+    EXPECT_THROW(parsePipelineSpec("invert,,edge"), std::invalid_argument);
+    EXPECT_THROW(parsePipelineSpec("sharpen:2"), std::invalid_argument);
+    EXPECT_THROW(parsePipelineSpec("threshold:300"), std::invalid_argument);
+
+    GaussianBlur reflected(2.0, 13);
+    reflected.setBorderMode(Filter::Reflect);
+    EdgeDetection constant;
+    constant.setBorderMode(Filter::Constant, 128);
+    EXPECT_EQ(parsePipelineSpec("blur:2@reflect")->apply(*images[0])->getData(),
+              reflected.apply(*images[0])->getData());
+    EXPECT_EQ(parsePipelineSpec("edge @ Constant=128")->apply(*images[0])->getData(),
+              constant.apply(*images[0])->getData());
+    EXPECT_EQ(parsePipelineSpec("blur:2@renormalize")->apply(*images[0])->getData(),
+              parsePipelineSpec("blur:2")->apply(*images[0])->getData());
+    EXPECT_FALSE(parsePipelineSpec("blur:1,edge@wrap")->isLocal());
+    EXPECT_THROW(parsePipelineSpec("invert@clamp"), std::invalid_argument);
+    EXPECT_THROW(parsePipelineSpec("blur:1@mirror"), std::invalid_argument);
+    EXPECT_THROW(parsePipelineSpec("blur:1@clamp=3"), std::invalid_argument);
+    EXPECT_THROW(parsePipelineSpec("edge@constant=256"), std::invalid_argument);
+}
@@ -0,0 +1,193 @@
+#include <gtest/gtest.h>
+#include "ResultCache.h"
+#include "FilterPipeline.h"
+#include "GaussianBlur.h"
+#include "EdgeDetection.h"
+#include "BrightnessAdjust.h"
+#include "Convolution.h"
+#include "TestUtils.h"
+
+using namespace GorselIsleme;
+using namespace GorselIsleme::test;
+
+namespace {
+
+// Parmak izi olmayan filtre: onbelleklenemez
+class Passthrough : public Filter {
+public:
+    void apply(const ConstImageView& input, const ImageView& output) const override {
+        checkViews(input, output);
+        for (int y = 0; y < input.getHeight(); ++y) {
+            std::copy(input.row(y), input.row(y) + input.getRowSize(), output.row(y));
+        }
+    }
+    std::string getName() const override { return "Passthrough"; }
+    std::unique_ptr<Filter> clone() const override { return std::make_unique<Passthrough>(); }
+    int getRadius() const override { return 0; }
+};
+
+} // namespace
+
+class ResultCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        input = std::make_unique<Image>(makeNoiseImage(96, 64, 3, 41u));
+    }
+
+    std::shared_ptr<const Image> makeShared(int width, int height) {
+        return std::make_shared<Image>(width, height, 1);
+    }
+
+    std::unique_ptr<Image> input;
+};
+
+TEST_F(ResultCacheTest, FingerprintTest) {
+    EXPECT_EQ(GaussianBlur(2.0, 5).getFingerprint(), GaussianBlur(2.0, 5).getFingerprint());
+    EXPECT_NE(GaussianBlur(2.0, 5).getFingerprint(), GaussianBlur(2.0001, 5).getFingerprint());
+    EXPECT_NE(GaussianBlur(2.0, 5).getFingerprint(), GaussianBlur(2.0, 7).getFingerprint());
+    GaussianBlur reflect(2.0, 5);
+    reflect.setBorderMode(Filter::Reflect);
+    EXPECT_NE(reflect.getFingerprint(), GaussianBlur(2.0, 5).getFingerprint());
+
+    EXPECT_EQ(EdgeDetection().getFingerprint(), EdgeDetection().getFingerprint());
+    EXPECT_NE(EdgeDetection().getFingerprint(), EdgeDetection(EdgeDetection::Horizontal).getFingerprint());
+    EXPECT_NE(EdgeDetection().getFingerprint(),
+              EdgeDetection(EdgeDetection::Both, EdgeDetection::L2, EdgeDetection::Scharr).getFingerprint());
+
+    EXPECT_EQ(BrightnessAdjust(1.2).getFingerprint(), BrightnessAdjust(1.2).getFingerprint());
+    EXPECT_NE(BrightnessAdjust(1.2).getFingerprint(), BrightnessAdjust(1.3).getFingerprint());
+
+    const std::vector<float> kernel(9, 1.0f / 9.0f);
+    std::vector<float> other = kernel;
+    other[4] = 0.2f;
+    EXPECT_EQ(Convolution(kernel, 3, 3).getFingerprint(), Convolution(kernel, 3, 3).getFingerprint());
+    EXPECT_NE(Convolution(kernel, 3, 3).getFingerprint(), Convolution(other, 3, 3).getFingerprint());
+
+    EXPECT_TRUE(Passthrough().getFingerprint().empty());
+}
+
+TEST_F(ResultCacheTest, PrefixReuseTest) {
+    auto cache = std::make_shared<ResultCache>(size_t(64) << 20);
+    CountingBlur::Counts blur;
+
+    FilterPipeline edges;
+    edges.addFilter(std::make_unique<CountingBlur>(blur));
+    edges.addFilter(std::make_unique<EdgeDetection>());
+    edges.setCache(cache);
+
+    FilterPipeline brighter;
+    brighter.addFilter(std::make_unique<CountingBlur>(blur));
+    brighter.addFilter(std::make_unique<BrightnessAdjust>(1.2));
+    brighter.setCache(cache);
+
+    FilterPipeline reference;
+    reference.addFilter(std::make_unique<GaussianBlur>(2.0, 5));
+    reference.addFilter(std::make_unique<BrightnessAdjust>(1.2));
+
+    const auto edge_result = edges.apply(*input);
+    EXPECT_EQ(blur.calls.load(), 1);
+    // Bulaniklastirma oneki ve tam sonuc saklandi
+    EXPECT_EQ(cache->getStats().entries, 2u);
+    EXPECT_EQ(cache->getStats().hits, 0u);
+
+    // Ayni bulaniklastirma onekinden devam eder
+    const auto bright_result = brighter.apply(*input);
+    EXPECT_EQ(blur.calls.load(), 1);
+    EXPECT_EQ(bright_result->getData(), reference.apply(*input)->getData());
+    EXPECT_EQ(cache->getStats().hits, 1u);
+
+    // Tam sonuc onbellekten
+    EXPECT_EQ(edges.apply(*input)->getData(), edge_result->getData());
+    EXPECT_EQ(blur.calls.load(), 1);
+    EXPECT_EQ(cache->getStats().hits, 2u);
+
+    // Farkli girdi: kacirir ve yeniden hesaplar
+    Image other = *input;
+    other.at(5, 5) ^= 1;
+    edges.apply(other);
+    EXPECT_EQ(blur.calls.load(), 2);
+    EXPECT_GE(cache->getStats().misses, 4u);
+
+    // clone() onbellegi paylasir
+    EXPECT_EQ(edges.clone()->getCache(), cache);
+}
+
+TEST_F(ResultCacheTest, TiledStoresFinalResultTest) {
+    auto cache = std::make_shared<ResultCache>(size_t(64) << 20);
+    FilterPipeline pipeline;
+    pipeline.addFilter(std::make_unique<GaussianBlur>(1.5, 5));
+    pipeline.addFilter(std::make_unique<EdgeDetection>());
+    pipeline.setExecutionMode(FilterPipeline::Tiled);
+    pipeline.setTileSize(32, 32);
+    const auto expected = pipeline.apply(*input);
+
+    pipeline.setCache(cache);
+    EXPECT_EQ(pipeline.apply(*input)->getData(), expected->getData());
+    EXPECT_EQ(cache->getStats().entries, 1u);
+    EXPECT_EQ(pipeline.apply(*input)->getData(), expected->getData());
+    EXPECT_EQ(cache->getStats().hits, 1u);
+}
+
+TEST_F(ResultCacheTest, UncacheableFilterTest) {
+    auto cache = std::make_shared<ResultCache>(size_t(64) << 20);
+    FilterPipeline pipeline;
+    pipeline.addFilter(std::make_unique<GaussianBlur>(1.5, 5));
+    pipeline.addFilter(std::make_unique<Passthrough>());
+    pipeline.addFilter(std::make_unique<EdgeDetection>());
+    pipeline.setCache(cache);
+
+    FilterPipeline reference;
+    reference.addFilter(std::make_unique<GaussianBlur>(1.5, 5));
+    reference.addFilter(std::make_unique<EdgeDetection>());
+
+    EXPECT_EQ(pipeline.apply(*input)->getData(), reference.apply(*input)->getData());
+    // Yalnizca parmak izi olan bulaniklastirma oneki saklanir
+    EXPECT_EQ(cache->getStats().entries, 1u);
+    EXPECT_EQ(pipeline.apply(*input)->getData(), reference.apply(*input)->getData());
+    EXPECT_EQ(cache->getStats().hits, 1u);
+}
+
+TEST_F(ResultCacheTest, LruEvictionTest) {
+    const size_t image_bytes = 100 * 100;
+    ResultCache cache(2 * image_bytes);
+    const ResultCache::Key a{1, 1}, b{1, 2}, c{2, 1};
+    cache.insert(a, makeShared(100, 100));
+    cache.insert(b, makeShared(100, 100));
+    // a en yeni kullanilan olur; c eklenince b atilir
+    EXPECT_TRUE(cache.find(a));
+    cache.insert(c, makeShared(100, 100));
+    EXPECT_TRUE(cache.find(a));
+    EXPECT_FALSE(cache.find(b));
+    EXPECT_TRUE(cache.find(c));
+
+    ResultCache::Stats stats = cache.getStats();
+    EXPECT_EQ(stats.entries, 2u);
+    EXPECT_EQ(stats.bytes, 2 * image_bytes);
+    EXPECT_EQ(stats.evictions, 1u);
+    EXPECT_EQ(stats.insertions, 3u);
+    EXPECT_EQ(stats.hits, 3u);
+    EXPECT_EQ(stats.misses, 1u);
+
+    // Butceden buyuk goruntu saklanmaz, mevcutlar korunur
+    cache.insert(b, makeShared(200, 200));
+    EXPECT_EQ(cache.getStats().entries, 2u);
+
+    cache.setByteBudget(image_bytes);
+    EXPECT_EQ(cache.getStats().entries, 1u);
+    EXPECT_TRUE(cache.find(c));
+    cache.clear();
+    EXPECT_EQ(cache.getStats().bytes, 0u);
+    EXPECT_FALSE(cache.find(c));
+}
+
+TEST_F(ResultCacheTest, ImageHashTest) {
+    Image copy = *input;
+    EXPECT_EQ(ResultCache::hashImage(copy), ResultCache::hashImage(*input));
+    copy.at(95, 63, 2) ^= 0x80;
+    EXPECT_NE(ResultCache::hashImage(copy), ResultCache::hashImage(*input));
+
+    // Boyut ozetin parcasidir; dolgu icerige katilmaz
+    EXPECT_NE(ResultCache::hashImage(Image(4, 2, 1)), ResultCache::hashImage(Image(2, 4, 1)));
+    const Image padded(input->view(), Image::PaddedRows);
+    EXPECT_EQ(ResultCache::hashImage(padded), ResultCache::hashImage(*input));
+}
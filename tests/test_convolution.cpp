@@ -0,0 +1,271 @@
+#include <gtest/gtest.h>
+#include "Convolution.h"
+#include "GaussianBlur.h"
+#include "Image.h"
+#include "TestUtils.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+using namespace GorselIsleme;
+using namespace GorselIsleme::test;
+
+namespace {
+
+// Kenar modu eslemesinin dogrudan tanimi; -1 goruntu disi demektir
+int referenceBorderIndex(int index, int length, Filter::BorderMode mode) {
+    switch (mode) {
+    case Filter::Clamp:
+        return std::min(std::max(index, 0), length - 1);
+    case Filter::Reflect:
+        while (length > 1 && (index < 0 || index >= length)) {
+            index = index < 0 ? -index : 2 * (length - 1) - index;
+        }
+        return length > 1 ? index : 0;
+    case Filter::Wrap:
+        return ((index % length) + length) % length;
+    default:
+        return (index >= 0 && index < length) ? index : -1;
+    }
+}
+
+// Tanimin kendisi: double toplam. Renormalize goruntu disindaki tap'leri
+// atar ve sonucu kernel toplami / gecerli agirlik toplami ile olcekler.
+std::unique_ptr<Image> referenceConvolution(const Image& input, const std::vector<float>& kernel, int kernel_width,
+                                            int kernel_height, Filter::BorderMode mode = Filter::Clamp,
+                                            int value = 0) {
+    const int rx = kernel_width / 2;
+    const int ry = kernel_height / 2;
+    double kernel_sum = 0.0;
+    for (float tap : kernel) {
+        kernel_sum += tap;
+    }
+    auto output = std::make_unique<Image>(input.getWidth(), input.getHeight(), input.getChannels());
+    for (int y = 0; y < input.getHeight(); ++y) {
+        for (int x = 0; x < input.getWidth(); ++x) {
+            for (int channel = 0; channel < input.getChannels(); ++channel) {
+                double sum = 0.0;
+                double valid = 0.0;
+                for (int j = 0; j < kernel_height; ++j) {
+                    const int sy = referenceBorderIndex(y + j - ry, input.getHeight(), mode);
+                    for (int i = 0; i < kernel_width; ++i) {
+                        const int sx = referenceBorderIndex(x + i - rx, input.getWidth(), mode);
+                        const double tap = kernel[j * kernel_width + i];
+                        if (sx >= 0 && sy >= 0) {
+                            sum += tap * input.at(sx, sy, channel);
+                            valid += tap;
+                        } else if (mode == Filter::Constant) {
+                            sum += tap * value;
+                        }
+                    }
+                }
+                if (mode == Filter::Renormalize) {
+                    sum *= kernel_sum / valid;
+                }
+                output->at(x, y, channel) = static_cast<Image::Pixel>(std::min(255.0, std::max(0.0, sum)) + 0.5);
+            }
+        }
+    }
+    return output;
+}
+
+std::vector<float> gaussianKernel(int width, int height, double sigma) {
+    std::vector<float> kernel(static_cast<size_t>(width) * height);
+    double sum = 0.0;
+    for (int j = 0; j < height; ++j) {
+        for (int i = 0; i < width; ++i) {
+            const double dx = i - width / 2;
+            const double dy = j - height / 2;
+            sum += kernel[j * width + i] = static_cast<float>(std::exp(-(dx * dx + dy * dy) / (2.0 * sigma * sigma)));
+        }
+    }
+    for (auto& value : kernel) {
+        value = static_cast<float>(value / sum);
+    }
+    return kernel;
+}
+
+// Ayrilamayan, isaretli katsayili kernel (rastgele, toplam 1)
+std::vector<float> randomKernel(int width, int height, unsigned seed) {
+    std::vector<float> kernel(static_cast<size_t>(width) * height);
+    double sum = 0.0;
+    for (auto& value : kernel) {
+        value = static_cast<float>(static_cast<int>(nextRandom(seed) % 200) - 60);
+        sum += value;
+    }
+    for (auto& value : kernel) {
+        value = static_cast<float>(value / sum);
+    }
+    return kernel;
+}
+
+int maxDifference(const Image& a, const Image& b) {
+    int worst = 0;
+    for (size_t i = 0; i < a.getData().size(); ++i) {
+        worst = std::max(worst, std::abs(a.getData()[i] - b.getData()[i]));
+    }
+    return worst;
+}
+
+} // namespace
+
+class ConvolutionTest : public ::testing::Test {
+protected:
+    void expectAllStrategiesMatch(const Image& input, const std::vector<float>& kernel, int width, int height) {
+        const auto expected = referenceConvolution(input, kernel, width, height);
+        for (auto strategy : {Convolution::Direct, Convolution::Separable, Convolution::Fft, Convolution::Auto}) {
+            Convolution convolution(kernel, width, height, strategy);
+            const auto result = convolution.apply(input);
+            EXPECT_LE(maxDifference(*result, *expected), 1)
+                << "strategy " << strategy << ", kernel " << width << "x" << height << ", image "
+                << input.getWidth() << "x" << input.getHeight() << "x" << input.getChannels();
+        }
+    }
+};
+
+TEST_F(ConvolutionTest, IdentityKernelTest) {
+    const Image input = makeNoiseImage(37, 23, 3, 1u);
+    std::vector<float> kernel(25, 0.0f);
+    kernel[12] = 1.0f;
+    for (auto strategy : {Convolution::Direct, Convolution::Separable, Convolution::Fft}) {
+        Convolution convolution(kernel, 5, 5, strategy);
+        EXPECT_EQ(convolution.apply(input)->getData(), input.getData()) << "strategy " << strategy;
+    }
+}
+
+TEST_F(ConvolutionTest, StrategiesMatchReferenceTest) {
+    for (int channels : {1, 2, 3, 4}) {
+        const Image input = makeNoiseImage(53, 41, channels, 7u + channels);
+        expectAllStrategiesMatch(input, gaussianKernel(5, 5, 1.2), 5, 5);
+        expectAllStrategiesMatch(input, randomKernel(7, 3, 11u), 7, 3);
+        expectAllStrategiesMatch(input, randomKernel(1, 9, 12u), 1, 9);
+    }
+}
+
+TEST_F(ConvolutionTest, LargeKernelTest) {
+    // 31x31 PSF; goruntu birden fazla FFT karosuna bolunur
+    const Image input = makeNoiseImage(150, 97, 3, 3u);
+    expectAllStrategiesMatch(input, randomKernel(31, 31, 5u), 31, 31);
+}
+
+TEST_F(ConvolutionTest, KernelLargerThanImageTest) {
+    const Image input = makeNoiseImage(9, 6, 1, 4u);
+    expectAllStrategiesMatch(input, gaussianKernel(21, 15, 4.0), 21, 15);
+}
+
+TEST_F(ConvolutionTest, SeparableRankTest) {
+    EXPECT_EQ(Convolution(gaussianKernel(9, 9, 2.0), 9, 9).getSeparableRank(), 1);
+    EXPECT_EQ(Convolution(std::vector<float>(15, 1.0f / 15), 5, 3).getSeparableRank(), 1);
+
+    // Iki ayrilabilir kernelin toplami rank 2
+    const auto wide = gaussianKernel(7, 7, 3.0);
+    const auto narrow = gaussianKernel(7, 7, 0.8);
+    std::vector<float> sum(49);
+    for (size_t i = 0; i < sum.size(); ++i) {
+        sum[i] = wide[i] - 0.5f * narrow[i];
+    }
+    EXPECT_EQ(Convolution(sum, 7, 7).getSeparableRank(), 2);
+
+    EXPECT_EQ(Convolution(randomKernel(5, 5, 9u), 5, 5).getSeparableRank(), 5);
+}
+
+TEST_F(ConvolutionTest, AutoStrategyTest) {
+    EXPECT_EQ(Convolution(randomKernel(3, 3, 1u), 3, 3).selectStrategy(640, 480, 3), Convolution::Direct);
+    EXPECT_EQ(Convolution(gaussianKernel(15, 15, 3.0), 15, 15).selectStrategy(640, 480, 3),
+              Convolution::Separable);
+    EXPECT_EQ(Convolution(randomKernel(31, 31, 2u), 31, 31).selectStrategy(640, 480, 3), Convolution::Fft);
+
+    Convolution fixed(randomKernel(31, 31, 2u), 31, 31, Convolution::Direct);
+    EXPECT_EQ(fixed.selectStrategy(640, 480, 3), Convolution::Direct);
+}
+
+TEST_F(ConvolutionTest, MatchesGaussianBlurTest) {
+    // Normalize Gauss kernelinin ic bolgesi GaussianBlur Exact ile ayni
+    const Image input = makeNoiseImage(64, 48, 3, 8u);
+    const auto kernel = gaussianKernel(7, 7, 1.5);
+    const auto expected = GaussianBlur(1.5, 7, GaussianBlur::Exact).apply(input);
+    const auto result = Convolution(kernel, 7, 7).apply(input);
+    for (int y = 3; y < 45; ++y) {
+        for (int x = 3; x < 61; ++x) {
+            for (int c = 0; c < 3; ++c) {
+                EXPECT_NEAR(result->at(x, y, c), expected->at(x, y, c), 1);
+            }
+        }
+    }
+}
+
+TEST_F(ConvolutionTest, RoiViewTest) {
+    const Image input = makeNoiseImage(80, 60, 3, 6u);
+    const auto kernel = randomKernel(9, 9, 3u);
+    for (auto strategy : {Convolution::Direct, Convolution::Fft}) {
+        Convolution convolution(kernel, 9, 9, strategy);
+        Image output(30, 20, 3);
+        convolution.apply(input.view().subView(10, 15, 30, 20), output.view());
+
+        Image crop(30, 20, 3);
+        for (int y = 0; y < 20; ++y) {
+            for (int x = 0; x < 30; ++x) {
+                for (int c = 0; c < 3; ++c) {
+                    crop.at(x, y, c) = input.at(x + 10, y + 15, c);
+                }
+            }
+        }
+        EXPECT_LE(maxDifference(output, *referenceConvolution(crop, kernel, 9, 9)), 1);
+    }
+}
+
+TEST_F(ConvolutionTest, InvalidArgumentsTest) {
+    EXPECT_THROW(Convolution(std::vector<float>(4, 0.25f), 2, 2), std::invalid_argument);
+    EXPECT_THROW(Convolution(std::vector<float>(8, 0.1f), 3, 3), std::invalid_argument);
+    EXPECT_THROW(Convolution(std::vector<float>(), 0, 1), std::invalid_argument);
+    EXPECT_THROW(Convolution(std::vector<float>(3, NAN), 3, 1), std::invalid_argument);
+
+    Convolution convolution(gaussianKernel(3, 3, 1.0), 3, 3);
+    Image input(10, 10, 3);
+    Image output(10, 9, 3);
+    EXPECT_THROW(convolution.apply(input.view(), output.view()), std::invalid_argument);
+}
+
+TEST_F(ConvolutionTest, CloneTest) {
+    Convolution convolution(randomKernel(5, 3, 4u), 5, 3, Convolution::Fft);
+    auto copy = convolution.clone();
+    EXPECT_EQ(copy->getName(), "Convolution");
+    EXPECT_EQ(copy->getRadius(), 2);
+    const Image input = makeNoiseImage(20, 20, 1, 2u);
+    EXPECT_EQ(copy->apply(input)->getData(), convolution.apply(input)->getData());
+}
+
+TEST_F(ConvolutionTest, BorderModesTest) {
+    // Kernel goruntuden genis: yansima ve sarma birden fazla kez doner
+    const Image input = makeNoiseImage(45, 12, 3, 21u);
+    const auto wide = gaussianKernel(17, 17, 4.0);
+    const auto random = randomKernel(9, 5, 8u);
+    for (auto mode : {Filter::Renormalize, Filter::Clamp, Filter::Reflect, Filter::Wrap, Filter::Constant}) {
+        for (const auto* kernel : {&wide, &random}) {
+            const int size = kernel == &wide ? 17 : 9;
+            const int height = kernel == &wide ? 17 : 5;
+            const auto expected = referenceConvolution(input, *kernel, size, height, mode, 190);
+            for (auto strategy : {Convolution::Direct, Convolution::Separable, Convolution::Fft}) {
+                Convolution convolution(*kernel, size, height, strategy);
+                convolution.setBorderMode(mode, 190);
+                EXPECT_LE(maxDifference(*convolution.apply(input), *expected), 1)
+                    << "mode " << mode << ", strategy " << strategy << ", kernel " << size << "x" << height;
+            }
+        }
+    }
+
+    Convolution convolution(wide, 17, 17);
+    EXPECT_EQ(convolution.getBorderMode(), Filter::Clamp);
+    EXPECT_TRUE(convolution.isLocal());
+    convolution.setBorderMode(Filter::Wrap);
+    EXPECT_FALSE(convolution.isLocal());
+}
+
+TEST_F(ConvolutionTest, RenormalizeMatchesGaussianBlurTest) {
+    // Renormalize ile normalize Gauss kerneli GaussianBlur Exact'in kenar davranisini verir
+    const Image input = makeNoiseImage(64, 48, 3, 8u);
+    const auto expected = GaussianBlur(1.5, 7, GaussianBlur::Exact).apply(input);
+    Convolution convolution(gaussianKernel(7, 7, 1.5), 7, 7);
+    convolution.setBorderMode(Filter::Renormalize);
+    EXPECT_LE(maxDifference(*convolution.apply(input), *expected), 1);
+}
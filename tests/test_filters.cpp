@@ -2,9 +2,163 @@
 #include "GaussianBlur.h"
 #include "EdgeDetection.h"
 #include "BrightnessAdjust.h"
+#include "PointOp.h"
 #include "Image.h"
+#include "TestUtils.h"
+#include <cmath>
+#include <cstdlib>
 
 using namespace GorselIsleme;
+using namespace GorselIsleme::test;
+
+namespace {
+
+// Eski 2D Gauss yolu: her tap icin sinir kontrolu ve piksel basina normalize
+std::unique_ptr<Image> referenceGaussianBlur(const Image& input, double sigma, int kernel_size) {
+    int half_kernel = kernel_size / 2;
+    std::vector<std::vector<double>> kernel(kernel_size, std::vector<double>(kernel_size));
+    for (int y = 0; y < kernel_size; ++y) {
+        for (int x = 0; x < kernel_size; ++x) {
+            double dx = x - half_kernel;
+            double dy = y - half_kernel;
+            kernel[y][x] = std::exp(-(dx * dx + dy * dy) / (2.0 * sigma * sigma));
+        }
+    }
+
+    auto output = std::make_unique<Image>(input.getWidth(), input.getHeight(), input.getChannels());
+    for (int y = 0; y < input.getHeight(); ++y) {
+        for (int x = 0; x < input.getWidth(); ++x) {
+            for (int channel = 0; channel < input.getChannels(); ++channel) {
+                double sum = 0.0;
+                double weight_sum = 0.0;
+                for (int ky = -half_kernel; ky <= half_kernel; ++ky) {
+                    for (int kx = -half_kernel; kx <= half_kernel; ++kx) {
+                        int nx = x + kx;
+                        int ny = y + ky;
+                        if (nx >= 0 && nx < input.getWidth() &&
+                            ny >= 0 && ny < input.getHeight()) {
+                            double weight = kernel[ky + half_kernel][kx + half_kernel];
+                            sum += input.at(nx, ny, channel) * weight;
+                            weight_sum += weight;
+                        }
+                    }
+                }
+                output->at(x, y, channel) = static_cast<Image::Pixel>(
+                    std::min(255.0, std::max(0.0, sum / weight_sum)));
+            }
+        }
+    }
+    return output;
+}
+
+// Kanal basina dogru Sobel/Scharr/Laplacian referansi (double karekok, kesme)
+// Kenar modu eslemesinin dogrudan tanimi; -1 sabit deger demektir
+int referenceBorderIndex(int index, int length, Filter::BorderMode mode) {
+    switch (mode) {
+    case Filter::Clamp:
+        return std::min(std::max(index, 0), length - 1);
+    case Filter::Reflect:
+        while (length > 1 && (index < 0 || index >= length)) {
+            index = index < 0 ? -index : 2 * (length - 1) - index;
+        }
+        return length > 1 ? index : 0;
+    case Filter::Wrap:
+        return ((index % length) + length) % length;
+    default:
+        return (index >= 0 && index < length) ? index : -1;
+    }
+}
+
+int borderSample(const Image& input, int x, int y, int channel, Filter::BorderMode mode, int value) {
+    const int sx = referenceBorderIndex(x, input.getWidth(), mode);
+    const int sy = referenceBorderIndex(y, input.getHeight(), mode);
+    return (sx < 0 || sy < 0) ? value : input.at(sx, sy, channel);
+}
+
+// Renormalize disindaki modlar: tam 1D kernel (sabit noktali agirliklar), double
+std::unique_ptr<Image> referenceBorderBlur(const Image& input, const GaussianBlur& blur, Filter::BorderMode mode,
+                                           int value) {
+    const auto& weights = blur.getWeights();
+    const int radius = static_cast<int>(weights.size()) / 2;
+    const double one = 1 << GaussianBlur::kWeightBits;
+    auto output = std::make_unique<Image>(input.getWidth(), input.getHeight(), input.getChannels());
+    for (int y = 0; y < input.getHeight(); ++y) {
+        for (int x = 0; x < input.getWidth(); ++x) {
+            for (int channel = 0; channel < input.getChannels(); ++channel) {
+                double sum = 0.0;
+                for (int j = -radius; j <= radius; ++j) {
+                    for (int i = -radius; i <= radius; ++i) {
+                        sum += weights[j + radius] * weights[i + radius] / (one * one) *
+                               borderSample(input, x + i, y + j, channel, mode, value);
+                    }
+                }
+                output->at(x, y, channel) = static_cast<Image::Pixel>(sum + 0.5);
+            }
+        }
+    }
+    return output;
+}
+
+std::unique_ptr<Image> referenceSobel(const Image& input, EdgeDetection::Direction direction,
+                                      EdgeDetection::Magnitude magnitude,
+                                      EdgeDetection::Operator op = EdgeDetection::Sobel,
+                                      Filter::BorderMode border = Filter::Renormalize, int border_value = 0) {
+    static const int sobel_x[3][3] = {{-1, 0, 1}, {-2, 0, 2}, {-1, 0, 1}};
+    static const int sobel_y[3][3] = {{-1, -2, -1}, {0, 0, 0}, {1, 2, 1}};
+    static const int scharr_x[3][3] = {{-3, 0, 3}, {-10, 0, 10}, {-3, 0, 3}};
+    static const int scharr_y[3][3] = {{-3, -10, -3}, {0, 0, 0}, {3, 10, 3}};
+    static const int laplacian[3][3] = {{0, 1, 0}, {1, -4, 1}, {0, 1, 0}};
+    static const int zero[3][3] = {};
+    const auto& kx = op == EdgeDetection::Sobel ? sobel_x : op == EdgeDetection::Scharr ? scharr_x : laplacian;
+    const auto& ky = op == EdgeDetection::Sobel ? sobel_y : op == EdgeDetection::Scharr ? scharr_y : zero;
+    if (op == EdgeDetection::Laplacian) {
+        direction = EdgeDetection::Both;
+        magnitude = EdgeDetection::L1;
+    }
+    // Renormalize: 1 piksellik cerceve sifir kalir
+    const int frame = border == Filter::Renormalize ? 1 : 0;
+    auto output = std::make_unique<Image>(input.getWidth(), input.getHeight(), input.getChannels());
+    for (int y = frame; y < input.getHeight() - frame; ++y) {
+        for (int x = frame; x < input.getWidth() - frame; ++x) {
+            for (int channel = 0; channel < input.getChannels(); ++channel) {
+                int gx = 0, gy = 0;
+                for (int j = 0; j < 3; ++j) {
+                    for (int i = 0; i < 3; ++i) {
+                        int value = borderSample(input, x + i - 1, y + j - 1, channel, border, border_value);
+                        gx += value * kx[j][i];
+                        gy += value * ky[j][i];
+                    }
+                }
+                if (direction == EdgeDetection::Horizontal) gy = 0;
+                if (direction == EdgeDetection::Vertical) gx = 0;
+                double result;
+                if (magnitude == EdgeDetection::L1) {
+                    result = std::abs(gx) + std::abs(gy);
+                } else if (magnitude == EdgeDetection::Max) {
+                    result = std::max(std::abs(gx), std::abs(gy));
+                } else {
+                    result = std::sqrt(static_cast<double>(gx * gx + gy * gy));
+                }
+                output->at(x, y, channel) = static_cast<Image::Pixel>(std::min(255.0, result));
+            }
+        }
+    }
+    return output;
+}
+
+int maxAbsDifference(const Image& a, const Image& b) {
+    int max_diff = 0;
+    for (int y = 0; y < a.getHeight(); ++y) {
+        for (int x = 0; x < a.getWidth(); ++x) {
+            for (int channel = 0; channel < a.getChannels(); ++channel) {
+                max_diff = std::max(max_diff, std::abs(a.at(x, y, channel) - b.at(x, y, channel)));
+            }
+        }
+    }
+    return max_diff;
+}
+
+} // namespace
 
 class FilterTest : public ::testing::Test {
 protected:
@@ -70,4 +224,411 @@ TEST_F(FilterTest, FilterCloneTest) {
     
     ASSERT_NE(cloned_filter, nullptr);
     EXPECT_EQ(cloned_filter->getName(), "GaussianBlur");
-}
\ No newline at end of file
+}
+
+TEST_F(FilterTest, GaussianBlurMatchesReferenceTest) {
+    const struct { double sigma; int kernel_size; } params[] = {
+        {1.0, 3}, {1.5, 5}, {2.0, 7}, {10.0, 9}, {0.3, 5}
+    };
+
+    for (int channels : {1, 3}) {
+        const Image noise = makeNoiseImage(37, 23, channels, 7u + channels);
+        for (const auto& p : params) {
+            GaussianBlur blur_filter(p.sigma, p.kernel_size);
+            auto result = blur_filter.apply(noise);
+            auto expected = referenceGaussianBlur(noise, p.sigma, p.kernel_size);
+            EXPECT_LE(maxAbsDifference(*result, *expected), 1)
+                << "sigma=" << p.sigma << " kernel=" << p.kernel_size << " channels=" << channels;
+        }
+    }
+
+    auto pattern_result = GaussianBlur(1.5, 5).apply(*test_image);
+    EXPECT_LE(maxAbsDifference(*pattern_result, *referenceGaussianBlur(*test_image, 1.5, 5)), 1);
+}
+
+TEST_F(FilterTest, GaussianBlurSmallerThanKernelTest) {
+    const Image noise = makeNoiseImage(3, 2, 1, 42u);
+    GaussianBlur blur_filter(2.0, 9);
+    auto result = blur_filter.apply(noise);
+    EXPECT_LE(maxAbsDifference(*result, *referenceGaussianBlur(noise, 2.0, 9)), 1);
+}
+
+TEST_F(FilterTest, GaussianBlurSpecializedKernelsTest) {
+    // Yaricap 1..4 ve kanal 1/3/4 ozel cekirdeklerden, digerleri genel yoldan
+    for (int kernel_size : {1, 3, 5, 7, 9, 11}) {
+        for (int channels : {1, 2, 3, 4}) {
+            const Image noise = makeNoiseImage(45, 23, channels, 31u * kernel_size + channels);
+            GaussianBlur blur_filter(1.2, kernel_size, GaussianBlur::Exact);
+            EXPECT_LE(maxAbsDifference(*blur_filter.apply(noise), *referenceGaussianBlur(noise, 1.2, kernel_size)),
+                      1)
+                << "kernel=" << kernel_size << " channels=" << channels;
+        }
+    }
+}
+
+TEST_F(FilterTest, GaussianBlurWeightsTest) {
+    GaussianBlur blur_filter(2.0, 7);
+    const auto& weights = blur_filter.getWeights();
+    ASSERT_EQ(weights.size(), 7u);
+
+    int32_t total = 0;
+    for (size_t i = 0; i < weights.size(); ++i) {
+        EXPECT_EQ(weights[i], weights[weights.size() - 1 - i]);
+        total += weights[i];
+    }
+    EXPECT_EQ(total, 1 << GaussianBlur::kWeightBits);
+
+    // Sabit goruntu degismemeli
+    Image flat(20, 20, 1);
+    std::fill(flat.getData().begin(), flat.getData().end(), 200);
+    auto result = blur_filter.apply(flat);
+    for (auto value : result->getData()) {
+        EXPECT_EQ(value, 200);
+    }
+}
+
+TEST_F(FilterTest, GaussianBlurModeSelectionTest) {
+    EXPECT_FALSE(GaussianBlur(2.0, 13).usesStackedBox());
+    EXPECT_FALSE(GaussianBlur(10.0, 9).usesStackedBox());
+    EXPECT_TRUE(GaussianBlur(10.0, 61).usesStackedBox());
+    EXPECT_FALSE(GaussianBlur(10.0, 61, GaussianBlur::Exact).usesStackedBox());
+    EXPECT_TRUE(GaussianBlur(2.0, 13, GaussianBlur::StackedBox).usesStackedBox());
+
+    GaussianBlur blur_filter(8.0, 49);
+    EXPECT_TRUE(blur_filter.usesStackedBox());
+    blur_filter.setKernelSize(9);
+    EXPECT_FALSE(blur_filter.usesStackedBox());
+}
+
+TEST_F(FilterTest, GaussianBlurStackedBoxAccuracyTest) {
+    for (double sigma : {3.0, 4.0, 8.0, 12.0}) {
+        int kernel_size = 2 * static_cast<int>(std::ceil(3.0 * sigma)) + 1;
+        GaussianBlur exact(sigma, kernel_size, GaussianBlur::Exact);
+        GaussianBlur box(sigma, kernel_size, GaussianBlur::StackedBox);
+
+        // 1D etkin kutu kernelini kesin agirliklarla karsilastir (L1 <= 0.05)
+        std::vector<double> effective{1.0};
+        for (int radius : box.getBoxRadii()) {
+            std::vector<double> next(effective.size() + 2 * radius, 0.0);
+            for (size_t i = 0; i < effective.size(); ++i) {
+                for (int k = 0; k <= 2 * radius; ++k) {
+                    next[i + k] += effective[i] / (2 * radius + 1);
+                }
+            }
+            effective.swap(next);
+        }
+        const auto& weights = exact.getWeights();
+        int half = static_cast<int>(std::max(effective.size(), weights.size())) / 2;
+        double l1 = 0.0;
+        for (int offset = -half; offset <= half; ++offset) {
+            int ei = offset + static_cast<int>(effective.size()) / 2;
+            int wi = offset + static_cast<int>(weights.size()) / 2;
+            double e = (ei >= 0 && ei < static_cast<int>(effective.size())) ? effective[ei] : 0.0;
+            double w = (wi >= 0 && wi < static_cast<int>(weights.size()))
+                           ? weights[wi] / double(1 << GaussianBlur::kWeightBits) : 0.0;
+            l1 += std::abs(e - w);
+        }
+        EXPECT_LE(l1, 0.05) << "sigma=" << sigma;
+
+        // Goruntu uzerinde hata belgelenen sinirin altinda kalmali
+        const Image noise = makeNoiseImage(80, 60, 3, 11u);
+        EXPECT_LE(maxAbsDifference(*box.apply(noise), *exact.apply(noise)), 26) << "sigma=" << sigma;
+
+        Image gradient(90, 70, 1);
+        for (int y = 0; y < 70; ++y) {
+            for (int x = 0; x < 90; ++x) {
+                gradient.at(x, y) = static_cast<Image::Pixel>((x * 255) / 89);
+            }
+        }
+        EXPECT_LE(maxAbsDifference(*box.apply(gradient), *exact.apply(gradient)), 3) << "sigma=" << sigma;
+    }
+}
+
+TEST_F(FilterTest, GaussianBlurStackedBoxFlatImageTest) {
+    Image flat(33, 17, 3);
+    std::fill(flat.getData().begin(), flat.getData().end(), 77);
+    GaussianBlur box(6.0, 37, GaussianBlur::StackedBox);
+    auto result = box.apply(flat);
+    for (auto value : result->getData()) {
+        EXPECT_EQ(value, 77);
+    }
+}
+
+TEST_F(FilterTest, RegionOfInterestTest) {
+    const Image source = makeNoiseImage(64, 48, 3, 5u);
+
+    GaussianBlur blur_filter(1.5, 5);
+    EdgeDetection edge_filter;
+    BrightnessAdjust bright_filter(1.3);
+    const Filter* filters[] = {&blur_filter, &edge_filter, &bright_filter};
+
+    for (const Filter* filter : filters) {
+        // ROI sonucu, kopyalanmis kesit uzerindeki sonuc ile ayni olmali
+        Image crop(source.view(10, 8, 30, 20));
+        auto expected = filter->apply(crop);
+
+        Image output = source;
+        filter->apply(source.view(10, 8, 30, 20), output.view(10, 8, 30, 20));
+
+        Image output_crop(static_cast<const Image&>(output).view(10, 8, 30, 20));
+        EXPECT_EQ(output_crop.getData(), expected->getData()) << filter->getName();
+
+        // ROI disi degismemeli
+        EXPECT_EQ(output.at(9, 8, 0), source.at(9, 8, 0));
+        EXPECT_EQ(output.at(40, 27, 2), source.at(40, 27, 2));
+        EXPECT_EQ(output.at(10, 28, 1), source.at(10, 28, 1));
+    }
+}
+
+TEST_F(FilterTest, ViewSizeMismatchTest) {
+    GaussianBlur blur_filter;
+    Image output(10, 10, 1);
+    EXPECT_THROW(blur_filter.apply(test_image->view(), output.view()), std::invalid_argument);
+}
+
+TEST_F(FilterTest, BrightnessAdjustValuesTest) {
+    const Image noise = makeNoiseImage(45, 7, 3, 9u);
+    for (double factor : {0.1, 1.0, 1.5, 3.7}) {
+        BrightnessAdjust bright_filter(factor);
+        auto result = bright_filter.apply(noise);
+        for (size_t i = 0; i < noise.getData().size(); ++i) {
+            double expected = std::min(255.0, noise.getData()[i] * factor);
+            ASSERT_EQ(result->getData()[i], static_cast<Image::Pixel>(expected)) << "factor=" << factor;
+        }
+    }
+    EXPECT_THROW(BrightnessAdjust(-1.0), std::invalid_argument);
+}
+
+TEST_F(FilterTest, PointOpLutTest) {
+    EXPECT_EQ(Invert().getLut()[0], 255);
+    EXPECT_EQ(Invert().getLut()[200], 55);
+    EXPECT_EQ(Threshold(100).getLut()[100], 0);
+    EXPECT_EQ(Threshold(100).getLut()[101], 255);
+    EXPECT_EQ(ContrastAdjust(2.0).getLut()[128], 128);
+    EXPECT_EQ(ContrastAdjust(2.0).getLut()[200], 255);
+    EXPECT_EQ(ContrastAdjust(0.0).getLut()[17], 128);
+    EXPECT_EQ(GammaCorrection(1.0).getLut(), PointOp::identity());
+    EXPECT_GT(GammaCorrection(2.2).getLut()[64], 64);
+
+    CurveAdjust curve([](Image::Pixel v) { return static_cast<Image::Pixel>(v / 2); });
+    EXPECT_EQ(curve.getLut()[255], 127);
+    EXPECT_EQ(curve.getName(), "CurveAdjust");
+
+    EXPECT_THROW(Threshold(256), std::invalid_argument);
+    EXPECT_THROW(GammaCorrection(0.0), std::invalid_argument);
+    EXPECT_THROW(ContrastAdjust(-0.5), std::invalid_argument);
+}
+
+TEST_F(FilterTest, PointOpApplyTest) {
+    // Tum bayt degerleri ve vektor genisliginin kati olmayan satirlar
+    GammaCorrection gamma(1.8);
+    const auto& lut = gamma.getLut();
+    for (int width : {1, 15, 16, 31, 33, 100}) {
+        const Image noise = makeNoiseImage(width, 9, 3, 3u + width);
+        auto result = gamma.apply(noise);
+        for (size_t i = 0; i < noise.getData().size(); ++i) {
+            ASSERT_EQ(result->getData()[i], lut[noise.getData()[i]]) << "width=" << width;
+        }
+    }
+
+    Image all_values(256, 1, 1);
+    for (int v = 0; v < 256; ++v) {
+        all_values.at(v, 0) = static_cast<Image::Pixel>(v);
+    }
+    auto inverted = Invert().apply(all_values);
+    for (int v = 0; v < 256; ++v) {
+        EXPECT_EQ(inverted->at(v, 0), 255 - v);
+    }
+
+    // Yerinde uygulama
+    Image in_place = all_values;
+    PointOp::applyLut(lut, in_place.view(), in_place.view());
+    for (int v = 0; v < 256; ++v) {
+        EXPECT_EQ(in_place.at(v, 0), lut[v]);
+    }
+}
+
+TEST_F(FilterTest, PointOpComposeTest) {
+    BrightnessAdjust bright(1.4);
+    Invert invert;
+    auto lut = PointOp::compose(bright.getLut(), invert.getLut());
+    for (int v = 0; v < 256; ++v) {
+        EXPECT_EQ(lut[v], invert.getLut()[bright.getLut()[v]]);
+    }
+}
+
+TEST_F(FilterTest, EdgeDetectionMatchesReferenceTest) {
+    const EdgeDetection::Direction directions[] = {
+        EdgeDetection::Horizontal, EdgeDetection::Vertical, EdgeDetection::Both};
+    const EdgeDetection::Magnitude magnitudes[] = {
+        EdgeDetection::L2, EdgeDetection::L1, EdgeDetection::Max};
+
+    for (int channels : {1, 3, 4}) {
+        for (int width : {3, 9, 18, 40, 67}) {
+            const Image noise = makeNoiseImage(width, 6, channels, 13u * width + channels);
+            for (auto direction : directions) {
+                for (auto magnitude : magnitudes) {
+                    EdgeDetection edge_filter(direction, magnitude);
+                    auto result = edge_filter.apply(noise);
+                    auto expected = referenceSobel(noise, direction, magnitude);
+                    ASSERT_EQ(result->getData(), expected->getData())
+                        << "channels=" << channels << " width=" << width
+                        << " direction=" << direction << " magnitude=" << magnitude;
+                }
+            }
+        }
+    }
+}
+
+TEST_F(FilterTest, EdgeDetectionOperatorsTest) {
+    // Kanal 1/3/4 derleme zamani ozellestirilmis, 2 genel yoldan gecer
+    for (auto op : {EdgeDetection::Scharr, EdgeDetection::Laplacian}) {
+        for (int channels : {1, 2, 3, 4}) {
+            for (int width : {3, 9, 18, 67}) {
+                const Image noise = makeNoiseImage(width, 7, channels, 7u * width + channels);
+                for (auto direction : {EdgeDetection::Horizontal, EdgeDetection::Vertical, EdgeDetection::Both}) {
+                    for (auto magnitude : {EdgeDetection::L2, EdgeDetection::L1, EdgeDetection::Max}) {
+                        EdgeDetection edge_filter(direction, magnitude, op);
+                        ASSERT_EQ(edge_filter.apply(noise)->getData(),
+                                  referenceSobel(noise, direction, magnitude, op)->getData())
+                            << "op=" << op << " channels=" << channels << " width=" << width
+                            << " direction=" << direction << " magnitude=" << magnitude;
+                    }
+                }
+            }
+        }
+    }
+
+    EdgeDetection edge_filter;
+    EXPECT_EQ(edge_filter.getOperator(), EdgeDetection::Sobel);
+    edge_filter.setOperator(EdgeDetection::Scharr);
+    auto copy = edge_filter.clone();
+    const Image noise = makeNoiseImage(30, 20, 3, 99u);
+    EXPECT_EQ(copy->apply(noise)->getData(),
+              referenceSobel(noise, EdgeDetection::Both, EdgeDetection::L2, EdgeDetection::Scharr)->getData());
+}
+
+TEST_F(FilterTest, EdgeDetectionPerChannelTest) {
+    // Yalnizca 1. kanalda kenar var; diger kanallar sifir kalmali
+    Image rgb(20, 20, 3);
+    for (int y = 0; y < 20; ++y) {
+        for (int x = 10; x < 20; ++x) {
+            rgb.at(x, y, 1) = 200;
+        }
+    }
+    EdgeDetection edge_filter;
+    auto result = edge_filter.apply(rgb);
+    EXPECT_EQ(result->at(10, 5, 0), 0);
+    EXPECT_EQ(result->at(10, 5, 2), 0);
+    EXPECT_EQ(result->at(10, 5, 1), 255);
+    EXPECT_EQ(result->at(0, 5, 1), 0);
+}
+
+TEST_F(FilterTest, EdgeDetectionTinyImageTest) {
+    Image tiny(2, 5, 1);
+    std::fill(tiny.getData().begin(), tiny.getData().end(), 90);
+    auto result = EdgeDetection().apply(tiny);
+    for (auto value : result->getData()) {
+        EXPECT_EQ(value, 0);
+    }
+}
+
+
+TEST_F(FilterTest, GaussianBlurBorderModesTest) {
+    // Yaricap 2 ozellestirilmis, 7 genel yol; 5 genislik kernelden dar (coklu yansima/sarma)
+    for (int kernel : {5, 15}) {
+        GaussianBlur blur(kernel / 4.0, kernel, GaussianBlur::Exact);
+        for (auto mode : {Filter::Clamp, Filter::Reflect, Filter::Wrap, Filter::Constant}) {
+            blur.setBorderMode(mode, 77);
+            for (int width : {5, 31}) {
+                for (int channels : {1, 3}) {
+                    const Image noise = makeNoiseImage(width, 23, channels, 3u * width + channels);
+                    EXPECT_LE(maxAbsDifference(*blur.apply(noise), *referenceBorderBlur(noise, blur, mode, 77)), 1)
+                        << "kernel=" << kernel << " mode=" << mode << " width=" << width << " channels=" << channels;
+                }
+            }
+        }
+    }
+}
+
+TEST_F(FilterTest, GaussianBlurStackedBoxBorderModesTest) {
+    const Image noise = makeNoiseImage(41, 29, 3, 9u);
+    GaussianBlur box(6.0, 37, GaussianBlur::StackedBox);
+
+    // Wrap: dairesel kaydirma ciktiyi ayni miktar kaydirir
+    box.setBorderMode(Filter::Wrap);
+    Image shifted(41, 29, 3);
+    for (int y = 0; y < 29; ++y) {
+        for (int x = 0; x < 41; ++x) {
+            for (int c = 0; c < 3; ++c) {
+                shifted.at((x + 13) % 41, (y + 5) % 29, c) = noise.at(x, y, c);
+            }
+        }
+    }
+    auto result = box.apply(noise);
+    auto shifted_result = box.apply(shifted);
+    for (int y = 0; y < 29; ++y) {
+        for (int x = 0; x < 41; ++x) {
+            for (int c = 0; c < 3; ++c) {
+                ASSERT_EQ(shifted_result->at((x + 13) % 41, (y + 5) % 29, c), result->at(x, y, c));
+            }
+        }
+    }
+
+    // Clamp ve Reflect simetrik: yatay ayna goruntusu aynalanmis cikti verir
+    Image mirrored(41, 29, 3);
+    for (int y = 0; y < 29; ++y) {
+        for (int x = 0; x < 41; ++x) {
+            for (int c = 0; c < 3; ++c) {
+                mirrored.at(40 - x, y, c) = noise.at(x, y, c);
+            }
+        }
+    }
+    for (auto mode : {Filter::Clamp, Filter::Reflect}) {
+        box.setBorderMode(mode);
+        result = box.apply(noise);
+        auto mirrored_result = box.apply(mirrored);
+        for (int y = 0; y < 29; ++y) {
+            for (int x = 0; x < 41; ++x) {
+                for (int c = 0; c < 3; ++c) {
+                    ASSERT_EQ(mirrored_result->at(40 - x, y, c), result->at(x, y, c)) << "mode=" << mode;
+                }
+            }
+        }
+    }
+
+    // Constant: ayni degerli duz goruntu degismez, farkli deger kenari etkiler
+    Image flat(33, 17, 1);
+    std::fill(flat.getData().begin(), flat.getData().end(), 77);
+    box.setBorderMode(Filter::Constant, 77);
+    result = box.apply(flat);
+    for (auto value : result->getData()) {
+        EXPECT_EQ(value, 77);
+    }
+    box.setBorderMode(Filter::Constant, 0);
+    result = box.apply(flat);
+    EXPECT_LT(result->at(0, 0), 77);
+    EXPECT_EQ(box.getBorderMode(), Filter::Constant);
+    EXPECT_TRUE(GaussianBlur().isLocal());
+}
+
+TEST_F(FilterTest, EdgeDetectionBorderModesTest) {
+    for (auto op : {EdgeDetection::Sobel, EdgeDetection::Scharr, EdgeDetection::Laplacian}) {
+        for (auto mode : {Filter::Clamp, Filter::Reflect, Filter::Wrap, Filter::Constant}) {
+            for (int channels : {1, 3}) {
+                for (int width : {1, 2, 3, 40}) {
+                    const Image noise = makeNoiseImage(width, 6, channels, 11u * width + channels);
+                    EdgeDetection edge(EdgeDetection::Both, EdgeDetection::L2, op);
+                    edge.setBorderMode(mode, 200);
+                    auto expected = referenceSobel(noise, EdgeDetection::Both, EdgeDetection::L2, op, mode, 200);
+                    ASSERT_EQ(edge.apply(noise)->getData(), expected->getData())
+                        << "op=" << op << " mode=" << mode << " channels=" << channels << " width=" << width;
+                }
+            }
+        }
+    }
+    EdgeDetection edge;
+    EXPECT_TRUE(edge.isLocal());
+    edge.setBorderMode(Filter::Wrap);
+    EXPECT_FALSE(edge.isLocal());
+}
@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+#include "FrameStream.h"
+#include "GaussianBlur.h"
+#include "EdgeDetection.h"
+#include "BrightnessAdjust.h"
+#include "TestUtils.h"
+#include <stdexcept>
+#include <thread>
+
+using namespace GorselIsleme;
+using namespace GorselIsleme::test;
+
+class FrameStreamTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        pipeline.addFilter(std::make_unique<GaussianBlur>(1.5, 5));
+        pipeline.addFilter(std::make_unique<BrightnessAdjust>(1.2));
+        pipeline.addFilter(std::make_unique<BrightnessAdjust>(0.9));
+        pipeline.addFilter(std::make_unique<EdgeDetection>());
+
+        for (int i = 0; i < 12; ++i) {
+            frames.push_back(makeNoiseImage(48, 36, 3, 29u + i));
+        }
+    }
+
+    // Uretici ayri thread'de; sonuclar sirayla toplanir
+    std::vector<Image> run(FrameStream& stream) {
+        std::thread producer([&]() {
+            for (const auto& frame : frames) {
+                stream.push(frame);
+            }
+            stream.close();
+        });
+        std::vector<Image> results;
+        Image output(1, 1, 1);
+        while (stream.pop(output)) {
+            results.push_back(output);
+        }
+        producer.join();
+        return results;
+    }
+
+    ThreadCountGuard thread_count{2};
+    FilterPipeline pipeline;
+    std::vector<Image> frames;
+};
+
+TEST_F(FrameStreamTest, MatchesApplyTest) {
+    FrameStreamOptions options;
+    options.ring_capacity = 2;
+    FrameStream stream(pipeline, 48, 36, 3, options);
+    // Ardisik parlaklik ayarlari tek asamada kalir
+    ASSERT_EQ(stream.getStageCount(), 3u);
+
+    const auto results = run(stream);
+    ASSERT_EQ(results.size(), frames.size());
+    for (size_t i = 0; i < frames.size(); ++i) {
+        EXPECT_EQ(results[i].getData(), pipeline.apply(frames[i])->getData()) << "kare " << i;
+    }
+
+    const FrameStreamStats stats = stream.getStats();
+    EXPECT_EQ(stats.frames_in, frames.size());
+    EXPECT_EQ(stats.frames_out, frames.size());
+    ASSERT_EQ(stats.stages.size(), 3u);
+    EXPECT_EQ(stats.stages[1].name, "BrightnessAdjust+BrightnessAdjust");
+    for (const auto& stage : stats.stages) {
+        EXPECT_EQ(stage.frames, frames.size());
+        EXPECT_GT(stage.busy_ms, 0.0);
+        EXPECT_LE(stage.max_input_depth, options.ring_capacity);
+        EXPECT_EQ(stage.input_depth, 0u);
+    }
+    EXPECT_EQ(stats.output_depth, 0u);
+}
+
+TEST_F(FrameStreamTest, StageGroupsTest) {
+    FrameStreamOptions options;
+    options.stage_groups = {2, 2};
+    FrameStream stream(pipeline, 48, 36, 3, options);
+    EXPECT_EQ(stream.getStageCount(), 2u);
+    const auto results = run(stream);
+    ASSERT_EQ(results.size(), frames.size());
+    for (size_t i = 0; i < frames.size(); ++i) {
+        EXPECT_EQ(results[i].getData(), pipeline.apply(frames[i])->getData());
+    }
+
+    options.stage_groups = {1, 2};
+    EXPECT_THROW(FrameStream(pipeline, 48, 36, 3, options), std::invalid_argument);
+    options.stage_groups = {0, 4};
+    EXPECT_THROW(FrameStream(pipeline, 48, 36, 3, options), std::invalid_argument);
+    options.stage_groups.clear();
+    options.ring_capacity = 0;
+    EXPECT_THROW(FrameStream(pipeline, 48, 36, 3, options), std::invalid_argument);
+}
+
+TEST_F(FrameStreamTest, BackpressureTest) {
+    // Asamasiz akis: kareler dogrudan tuketici halkasinda bekler
+    FrameStreamOptions options;
+    options.ring_capacity = 2;
+    FrameStream stream(FilterPipeline(), 48, 36, 3, options);
+    EXPECT_TRUE(stream.tryPush(frames[0]));
+    EXPECT_TRUE(stream.tryPush(frames[1]));
+    EXPECT_FALSE(stream.tryPush(frames[2]));
+    EXPECT_EQ(stream.getStats().output_depth, 2u);
+    EXPECT_THROW(stream.push(Image(10, 10, 3)), std::invalid_argument);
+
+    Image output(1, 1, 1);
+    EXPECT_TRUE(stream.tryPop(output));
+    EXPECT_EQ(output.getData(), frames[0].getData());
+    EXPECT_TRUE(stream.tryPush(frames[2]));
+    stream.close();
+    EXPECT_TRUE(stream.pop(output));
+    EXPECT_EQ(output.getData(), frames[1].getData());
+    EXPECT_TRUE(stream.pop(output));
+    EXPECT_EQ(output.getData(), frames[2].getData());
+    EXPECT_FALSE(stream.pop(output));
+    EXPECT_EQ(stream.getStats().max_output_depth, 2u);
+}
+
+TEST_F(FrameStreamTest, StageErrorTest) {
+    FilterPipeline broken;
+    broken.addFilter(std::make_unique<GaussianBlur>(1.0, 3));
+    broken.addFilter(std::make_unique<ThrowingFilter>());
+    FrameStream stream(broken, 48, 36, 3);
+    stream.push(frames[0]);
+    Image output(1, 1, 1);
+    EXPECT_THROW(stream.pop(output), std::invalid_argument);
+    EXPECT_THROW(stream.push(frames[1]), std::invalid_argument);
+}
+
+TEST_F(FrameStreamTest, DestroyWithPendingFramesTest) {
+    FrameStreamOptions options;
+    options.ring_capacity = 1;
+    auto stream = std::make_unique<FrameStream>(pipeline, 48, 36, 3, options);
+    for (int i = 0; i < 3; ++i) {
+        stream->push(frames[i]);
+    }
+    // Sonuclar alinmadan yok edilir; bekleyen asamalar birakilmali
+    stream.reset();
+    SUCCEED();
+}
@@ -0,0 +1,239 @@
+#include <gtest/gtest.h>
+#include "FilterGraph.h"
+#include "GaussianBlur.h"
+#include "EdgeDetection.h"
+#include "BrightnessAdjust.h"
+#include "ThreadPool.h"
+#include "TestUtils.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+
+using namespace GorselIsleme;
+using namespace GorselIsleme::test;
+
+namespace {
+
+// Iki kopya birbirini bekler: ikisi ayni anda calismiyorsa zaman asimina duser
+struct Rendezvous {
+    std::mutex mutex;
+    std::condition_variable changed;
+    int arrived = 0;
+    bool timed_out = false;
+};
+
+class RendezvousFilter : public Filter {
+public:
+    RendezvousFilter(Rendezvous& rendezvous, int id) : rendezvous_(rendezvous), id_(id) {}
+
+    void apply(const ConstImageView& input, const ImageView& output) const override {
+        checkViews(input, output);
+        {
+            std::unique_lock<std::mutex> lock(rendezvous_.mutex);
+            ++rendezvous_.arrived;
+            rendezvous_.changed.notify_all();
+            if (!rendezvous_.changed.wait_for(lock, std::chrono::seconds(5),
+                                              [this]() { return rendezvous_.arrived >= 2; })) {
+                rendezvous_.timed_out = true;
+            }
+        }
+        for (int y = 0; y < input.getHeight(); ++y) {
+            std::copy(input.row(y), input.row(y) + input.getRowSize(), output.row(y));
+        }
+    }
+
+    std::string getName() const override { return "Rendezvous"; }
+    std::string getFingerprint() const override { return "Rendezvous:" + std::to_string(id_); }
+    std::unique_ptr<Filter> clone() const override { return std::make_unique<RendezvousFilter>(rendezvous_, id_); }
+    int getRadius() const override { return 0; }
+
+private:
+    Rendezvous& rendezvous_;
+    int id_;
+};
+
+// Kendi icinde havuzda parallelFor calistirir ve kac farkli thread'in
+// parca aldigini kaydeder; en az sayi tum cagrilar uzerinden tutulur
+class PoolProbeFilter : public Filter {
+public:
+    explicit PoolProbeFilter(std::atomic<int>& min_threads) : min_threads_(min_threads) {}
+
+    void apply(const ConstImageView& input, const ImageView& output) const override {
+        checkViews(input, output);
+        std::mutex mutex;
+        std::set<std::thread::id> threads;
+        ThreadPool::global().parallelFor(0, 8, 1, [&](int, int) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                threads.insert(std::this_thread::get_id());
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        });
+        int current = min_threads_.load();
+        while (static_cast<int>(threads.size()) < current &&
+               !min_threads_.compare_exchange_weak(current, static_cast<int>(threads.size()))) {
+        }
+        for (int y = 0; y < input.getHeight(); ++y) {
+            std::copy(input.row(y), input.row(y) + input.getRowSize(), output.row(y));
+        }
+    }
+
+    std::string getName() const override { return "PoolProbe"; }
+    std::unique_ptr<Filter> clone() const override { return std::make_unique<PoolProbeFilter>(min_threads_); }
+    int getRadius() const override { return 0; }
+
+private:
+    std::atomic<int>& min_threads_;
+};
+
+} // namespace
+
+class FilterGraphTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        input = std::make_unique<Image>(makeNoiseImage(64, 48, 3, 19u));
+    }
+
+    ThreadCountGuard thread_count{2};
+    std::unique_ptr<Image> input;
+};
+
+TEST_F(FilterGraphTest, BranchingTest) {
+    // main.cpp akisi: bulanik -> kenar ve ayrica parlak orijinal
+    FilterGraph graph;
+    const auto source = graph.addInput();
+    const auto blurred = graph.addNode(std::make_unique<GaussianBlur>(2.0, 9), source);
+    const auto edges = graph.addNode(std::make_unique<EdgeDetection>(), blurred);
+    const auto bright = graph.addNode(std::make_unique<BrightnessAdjust>(0.5), source);
+    EXPECT_EQ(graph.addOutput(blurred), 0u);
+    EXPECT_EQ(graph.addOutput(edges), 1u);
+    EXPECT_EQ(graph.addOutput(bright), 2u);
+
+    GraphStats stats;
+    const auto results = graph.run({input.get()}, &stats);
+    ASSERT_EQ(results.size(), 3u);
+    const auto expected_blur = GaussianBlur(2.0, 9).apply(*input);
+    EXPECT_EQ(results[0]->getData(), expected_blur->getData());
+    EXPECT_EQ(results[1]->getData(), EdgeDetection().apply(*expected_blur)->getData());
+    EXPECT_EQ(results[2]->getData(), BrightnessAdjust(0.5).apply(*input)->getData());
+    EXPECT_EQ(stats.nodes, 3u);
+    EXPECT_EQ(stats.computed, 3u);
+    EXPECT_EQ(stats.shared, 0u);
+}
+
+TEST_F(FilterGraphTest, SharedSubexpressionTest) {
+    CountingBlur::Counts counts;
+    FilterGraph graph;
+    const auto source = graph.addInput();
+    const auto first = graph.addNode(std::make_unique<CountingBlur>(counts), source);
+    const auto second = graph.addNode(std::make_unique<CountingBlur>(counts), source);
+    const auto other = graph.addNode(std::make_unique<CountingBlur>(counts, 3.0), source);
+    // Ayni alt graflar: iki kenar dugumu de tek kez hesaplanir
+    graph.addOutput(graph.addNode(std::make_unique<EdgeDetection>(), first));
+    graph.addOutput(graph.addNode(std::make_unique<EdgeDetection>(), second));
+    graph.addOutput(graph.addNode(std::make_unique<BrightnessAdjust>(1.2), second));
+    graph.addOutput(other);
+
+    GraphStats stats;
+    const auto results = graph.run({input.get()}, &stats);
+    EXPECT_EQ(counts.calls.load(), 2);
+    EXPECT_EQ(stats.nodes, 6u);
+    EXPECT_EQ(stats.computed, 4u);
+    EXPECT_EQ(stats.shared, 2u);
+    ASSERT_EQ(results.size(), 4u);
+    EXPECT_NE(results[0].get(), results[1].get());
+    EXPECT_EQ(results[0]->getData(), results[1]->getData());
+    EXPECT_EQ(results[0]->getData(), EdgeDetection().apply(*GaussianBlur(2.0, 5).apply(*input))->getData());
+    EXPECT_EQ(results[3]->getData(), GaussianBlur(3.0, 5).apply(*input)->getData());
+
+    // Ayni goruntuye bagli iki girdi de tek girdi sayilir
+    counts.reset();
+    FilterGraph pair;
+    const auto a = pair.addInput();
+    const auto b = pair.addInput();
+    pair.addOutput(pair.addNode(std::make_unique<CountingBlur>(counts), a));
+    pair.addOutput(pair.addNode(std::make_unique<CountingBlur>(counts), b));
+    pair.run({input.get(), input.get()});
+    EXPECT_EQ(counts.calls.load(), 1);
+    Image other_input = *input;
+    pair.run({input.get(), &other_input});
+    EXPECT_EQ(counts.calls.load(), 3);
+}
+
+TEST_F(FilterGraphTest, UnreachedNodesTest) {
+    CountingBlur::Counts counts;
+    FilterGraph graph;
+    const auto source = graph.addInput();
+    graph.addNode(std::make_unique<CountingBlur>(counts), source);
+    graph.addOutput(source);
+
+    GraphStats stats;
+    const auto results = graph.run({input.get()}, &stats);
+    EXPECT_EQ(counts.calls.load(), 0);
+    EXPECT_EQ(stats.computed, 0u);
+    // Girdi ciktiysa kopyalanir
+    ASSERT_EQ(results.size(), 1u);
+    EXPECT_NE(results[0].get(), input.get());
+    EXPECT_EQ(results[0]->getData(), input->getData());
+}
+
+TEST_F(FilterGraphTest, FreesIntermediatesTest) {
+    // Dort asamali zincir: her an en fazla iki goruntu yasar
+    FilterGraph graph;
+    auto node = graph.addInput();
+    for (int i = 0; i < 4; ++i) {
+        node = graph.addNode(std::make_unique<BrightnessAdjust>(1.0 + 0.1 * i), node);
+    }
+    graph.addOutput(node);
+
+    GraphStats stats;
+    graph.run({input.get()}, &stats);
+    EXPECT_EQ(stats.computed, 4u);
+    EXPECT_EQ(stats.peak_bytes, 2 * input->getData().size());
+}
+
+TEST_F(FilterGraphTest, ConcurrentBranchesTest) {
+    Rendezvous rendezvous;
+    FilterGraph graph;
+    const auto source = graph.addInput();
+    graph.addOutput(graph.addNode(std::make_unique<RendezvousFilter>(rendezvous, 1), source));
+    graph.addOutput(graph.addNode(std::make_unique<RendezvousFilter>(rendezvous, 2), source));
+    const auto results = graph.run({input.get()});
+    EXPECT_FALSE(rendezvous.timed_out);
+    EXPECT_EQ(results[1]->getData(), input->getData());
+}
+
+TEST_F(FilterGraphTest, ChainKeepsPoolForFiltersTest) {
+    // Havuz thread sayisindan uzun zincir: bekleyen govde isci tutmamali,
+    // her filtrenin kendi parallelFor'u birden fazla thread'de calismali
+    std::atomic<int> min_threads{1000};
+    FilterGraph graph;
+    auto node = graph.addInput();
+    for (int i = 0; i < 5; ++i) {
+        node = graph.addNode(std::make_unique<PoolProbeFilter>(min_threads), node);
+    }
+    graph.addOutput(node);
+
+    const auto results = graph.run({input.get()});
+    EXPECT_GE(min_threads.load(), 2);
+    EXPECT_EQ(results[0]->getData(), input->getData());
+}
+
+TEST_F(FilterGraphTest, ErrorTest) {
+    FilterGraph graph;
+    const auto source = graph.addInput();
+    EXPECT_THROW(graph.addNode(std::make_unique<EdgeDetection>(), 5), std::out_of_range);
+    EXPECT_THROW(graph.addNode(nullptr, source), std::invalid_argument);
+    EXPECT_THROW(graph.addOutput(3), std::out_of_range);
+
+    const auto blurred = graph.addNode(std::make_unique<GaussianBlur>(1.0, 3), source);
+    graph.addOutput(graph.addNode(std::make_unique<ThrowingFilter>(), blurred));
+    graph.addOutput(graph.addNode(std::make_unique<EdgeDetection>(), blurred));
+    EXPECT_THROW(graph.run({input.get()}), std::invalid_argument);
+    EXPECT_THROW(graph.run({}), std::invalid_argument);
+    EXPECT_THROW(graph.run({nullptr}), std::invalid_argument);
+}
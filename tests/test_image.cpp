@@ -1,5 +1,11 @@
 #include <gtest/gtest.h>
 #include "Image.h"
+#include "MappedImage.h"
+#include "GaussianBlur.h"
+#include "EdgeDetection.h"
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
 
 using namespace GorselIsleme;
 
@@ -51,4 +57,287 @@ TEST_F(ImageTest, AssignmentOperatorTest) {
     EXPECT_EQ(assigned_image.getWidth(), test_image->getWidth());
     EXPECT_EQ(assigned_image.getHeight(), test_image->getHeight());
     EXPECT_EQ(assigned_image.at(30, 30), 150);
-}
\ No newline at end of file
+}
+
+TEST_F(ImageTest, MoveTest) {
+    test_image->at(12, 34) = 77;
+    const Image::Pixel* pixels = test_image->getData().data();
+
+    Image moved(std::move(*test_image));
+    EXPECT_EQ(moved.getData().data(), pixels);
+    EXPECT_EQ(moved.at(12, 34), 77);
+    EXPECT_TRUE(test_image->empty());
+
+    // Gecici nesneden atama kopyalamaz, tamponu devralir
+    Image target(8, 8, 1);
+    target = Image(64, 32, 3, Image::Uninitialized, Image::PaddedRows);
+    EXPECT_EQ(target.getWidth(), 64);
+    EXPECT_EQ(target.getChannels(), 3);
+    EXPECT_EQ(target.getLayout(), Image::PaddedRows);
+
+    target = std::move(moved);
+    EXPECT_EQ(target.getData().data(), pixels);
+    EXPECT_EQ(target.at(12, 34), 77);
+}
+
+TEST_F(ImageTest, ViewTest) {
+    test_image->at(7, 3) = 99;
+    ImageView view = test_image->view();
+    EXPECT_EQ(view.getWidth(), 100);
+    EXPECT_EQ(view.getHeight(), 100);
+    EXPECT_EQ(view.getStride(), 100);
+    EXPECT_TRUE(view.isContiguous());
+    EXPECT_EQ(view.row(3)[7], 99);
+
+    view.at(8, 3) = 42;
+    EXPECT_EQ(test_image->at(8, 3), 42);
+
+    ConstImageView const_view = view;
+    EXPECT_EQ(const_view.at(7, 3), 99);
+}
+
+TEST_F(ImageTest, SubViewTest) {
+    Image rgb(20, 10, 3);
+    rgb.at(5, 4, 2) = 77;
+
+    ConstImageView roi = static_cast<const Image&>(rgb).view(4, 2, 8, 5);
+    EXPECT_EQ(roi.getWidth(), 8);
+    EXPECT_EQ(roi.getHeight(), 5);
+    EXPECT_EQ(roi.getStride(), 60);
+    EXPECT_FALSE(roi.isContiguous());
+    EXPECT_EQ(roi.at(1, 2, 2), 77);
+
+    ConstImageView nested = roi.subView(1, 2, 3, 3);
+    EXPECT_EQ(nested.at(0, 0, 2), 77);
+
+    EXPECT_THROW(rgb.view(15, 0, 6, 1), std::out_of_range);
+    EXPECT_THROW(rgb.view(-1, 0, 2, 2), std::out_of_range);
+    EXPECT_THROW(roi.subView(0, 0, 9, 1), std::out_of_range);
+}
+
+TEST_F(ImageTest, ConstructFromViewTest) {
+    for (int y = 0; y < 100; ++y) {
+        for (int x = 0; x < 100; ++x) {
+            test_image->at(x, y) = static_cast<Image::Pixel>(x + y);
+        }
+    }
+
+    Image crop(static_cast<const Image&>(*test_image).view(10, 20, 30, 5));
+    EXPECT_EQ(crop.getWidth(), 30);
+    EXPECT_EQ(crop.getHeight(), 5);
+    EXPECT_EQ(crop.at(0, 0), 30);
+    EXPECT_EQ(crop.at(29, 4), 63);
+}
+
+TEST_F(ImageTest, AlignedStorageTest) {
+    for (int width : {1, 3, 63, 64, 100, 333}) {
+        Image image(width, 7, 3);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(image.getData().data()) % BufferPool::kAlignment, 0u);
+        EXPECT_EQ(image.getStride(), width * 3);
+        EXPECT_EQ(image.getData().size(), static_cast<size_t>(width) * 7 * 3);
+        for (auto value : image.getData()) {
+            ASSERT_EQ(value, 0);
+        }
+    }
+}
+
+TEST_F(ImageTest, PaddedRowsTest) {
+    Image padded(50, 4, 3, Image::Uninitialized, Image::PaddedRows);
+    EXPECT_EQ(padded.getLayout(), Image::PaddedRows);
+    EXPECT_EQ(padded.getStride(), 192);
+    EXPECT_EQ(padded.getData().size(), 192u * 4);
+    for (int y = 0; y < 4; ++y) {
+        const Image::Pixel* row = padded.view().row(y);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(row) % BufferPool::kAlignment, 0u);
+        // Dolgu ilklendirilmemis goruntude de sifirdir
+        for (int i = 150; i < 192; ++i) {
+            ASSERT_EQ(row[i], 0);
+        }
+        for (int x = 0; x < 50; ++x) {
+            for (int c = 0; c < 3; ++c) {
+                padded.at(x, y, c) = static_cast<Image::Pixel>(x * 3 + y + c);
+            }
+        }
+    }
+    EXPECT_EQ(padded.view().row(2)[4 * 3 + 1], 4 * 3 + 2 + 1);
+
+    Image copy(padded);
+    EXPECT_EQ(copy.getStride(), 192);
+    EXPECT_EQ(copy.at(49, 3, 2), padded.at(49, 3, 2));
+
+    Image packed(padded.view());
+    EXPECT_EQ(packed.getStride(), 150);
+    EXPECT_EQ(packed.at(49, 3, 2), padded.at(49, 3, 2));
+}
+
+TEST_F(ImageTest, PaddedRowsFilterTest) {
+    Image packed(97, 41, 3);
+    Image padded(97, 41, 3, Image::Zeroed, Image::PaddedRows);
+    for (int y = 0; y < 41; ++y) {
+        for (int x = 0; x < 97; ++x) {
+            for (int c = 0; c < 3; ++c) {
+                packed.at(x, y, c) = padded.at(x, y, c) = static_cast<Image::Pixel>((x * 7 + y * 13 + c * 5) % 256);
+            }
+        }
+    }
+
+    GaussianBlur blur(1.5, 5);
+    EdgeDetection edge;
+    Image blurred(97, 41, 3, Image::Uninitialized, Image::PaddedRows);
+    blur.apply(padded.view(), blurred.view());
+    EXPECT_EQ(Image(blurred.view()).getData(), blur.apply(packed)->getData());
+
+    Image edges(97, 41, 3, Image::Uninitialized, Image::PaddedRows);
+    edge.apply(padded.view(), edges.view());
+    EXPECT_EQ(Image(edges.view()).getData(), edge.apply(packed)->getData());
+}
+
+TEST_F(ImageTest, PaddedSaveLoadTest) {
+    Image padded(30, 5, 1, Image::Uninitialized, Image::PaddedRows);
+    for (int y = 0; y < 5; ++y) {
+        for (int x = 0; x < 30; ++x) {
+            padded.at(x, y) = static_cast<Image::Pixel>(x * 8 + y);
+        }
+    }
+    ASSERT_TRUE(padded.save("test_padded.pgm"));
+
+    auto loaded = Image::load("test_padded.pgm");
+    ASSERT_NE(loaded, nullptr);
+    EXPECT_EQ(loaded->getData(), Image(padded.view()).getData());
+    std::remove("test_padded.pgm");
+}
+
+TEST_F(ImageTest, ColorSaveLoadTest) {
+    Image color(17, 9, 3);
+    for (int y = 0; y < 9; ++y) {
+        for (int x = 0; x < 17; ++x) {
+            for (int c = 0; c < 3; ++c) {
+                color.at(x, y, c) = static_cast<Image::Pixel>(x * 13 + y * 7 + c * 50);
+            }
+        }
+    }
+    ASSERT_TRUE(color.save("test_color.ppm"));
+
+    std::ifstream file("test_color.ppm", std::ios::binary);
+    std::string magic;
+    file >> magic;
+    EXPECT_EQ(magic, "P6");
+    file.close();
+
+    auto loaded = Image::load("test_color.ppm");
+    ASSERT_NE(loaded, nullptr);
+    EXPECT_EQ(loaded->getChannels(), 3);
+    EXPECT_EQ(loaded->getData(), color.getData());
+    std::remove("test_color.ppm");
+
+    // PNM'de karsiligi olmayan kanal sayisi
+    EXPECT_FALSE(Image(4, 4, 4).save("test_rgba.ppm"));
+    std::remove("test_rgba.ppm");
+}
+
+TEST_F(ImageTest, PnmHeaderTest) {
+    // Yorumlar, farkli bosluklar ve 16 bit ornekler
+    {
+        std::ofstream file("test_header.pgm", std::ios::binary);
+        file << "P5 # yorum\n# tam satir yorum\n3\t2\n#son\n65535\n";
+        const unsigned char samples[] = {0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x12, 0x34, 0x00, 0x80, 0xFF, 0x00};
+        file.write(reinterpret_cast<const char*>(samples), sizeof(samples));
+    }
+    auto loaded = Image::load("test_header.pgm");
+    ASSERT_NE(loaded, nullptr);
+    EXPECT_EQ(loaded->getWidth(), 3);
+    EXPECT_EQ(loaded->getHeight(), 2);
+    EXPECT_EQ(loaded->getData(), (Image::PixelVector{0, 255, 128, 18, 0, 254}));
+    // 16 bit veri eslenemez
+    EXPECT_EQ(MappedImage::open("test_header.pgm"), nullptr);
+    std::remove("test_header.pgm");
+
+    for (const char* broken : {"P2\n1 1\n255\n0", "P5\n0 1\n255\n", "P5\n1 1\n70000\n\0", "P5\n2 2\n255\nab"}) {
+        std::ofstream("test_broken.pgm", std::ios::binary) << broken;
+        EXPECT_EQ(Image::load("test_broken.pgm"), nullptr) << broken;
+        EXPECT_EQ(MappedImage::open("test_broken.pgm"), nullptr) << broken;
+    }
+    std::remove("test_broken.pgm");
+}
+
+TEST_F(ImageTest, MappedImageTest) {
+    Image color(31, 12, 3);
+    for (size_t i = 0; i < color.getData().size(); ++i) {
+        color.getData()[i] = static_cast<Image::Pixel>(i * 7);
+    }
+    ASSERT_TRUE(color.save("test_mapped.ppm"));
+
+    auto mapped = MappedImage::open("test_mapped.ppm");
+    ASSERT_NE(mapped, nullptr);
+    EXPECT_EQ(mapped->getWidth(), 31);
+    EXPECT_EQ(mapped->getHeight(), 12);
+    EXPECT_EQ(mapped->getChannels(), 3);
+    EXPECT_EQ(Image(mapped->view()).getData(), color.getData());
+
+    // Eslenmis gorunum filtrelere kopyasiz girdi olarak verilebilir
+    GaussianBlur blur(1.0, 5);
+    Image output(31, 12, 3);
+    blur.apply(mapped->view(), output.view());
+    EXPECT_EQ(output.getData(), blur.apply(color)->getData());
+
+    EXPECT_EQ(MappedImage::open("yok.ppm"), nullptr);
+    mapped.reset();
+    std::remove("test_mapped.ppm");
+}
+
+TEST_F(ImageTest, BufferPoolTest) {
+    EXPECT_EQ(BufferPool::bucketSize(1), 64u);
+    EXPECT_EQ(BufferPool::bucketSize(64), 64u);
+    EXPECT_EQ(BufferPool::bucketSize(65), 128u);
+    EXPECT_EQ(BufferPool::bucketSize(1000), 1024u);
+    EXPECT_EQ(BufferPool::bucketSize(1 << 20), size_t(1) << 20);
+    EXPECT_EQ(BufferPool::bucketSize((1 << 20) + 1), (size_t(1) << 20) + (size_t(1) << 17));
+
+    BufferPool pool(1 << 20);
+    EXPECT_FALSE(pool.isEnabled());
+    void* first = pool.allocate(1000);
+    pool.deallocate(first, 1000);
+    EXPECT_EQ(pool.getStats().retained_buffers, 0u);
+
+    pool.setEnabled(true);
+    first = pool.allocate(1000);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(first) % BufferPool::kAlignment, 0u);
+    pool.deallocate(first, 1000);
+    EXPECT_EQ(pool.getStats().retained_bytes, 1024u);
+
+    // Ayni kovadaki farkli boyut geri donusturulmus tamponu alir
+    void* second = pool.allocate(1010);
+    EXPECT_EQ(second, first);
+    EXPECT_EQ(pool.getStats().hits, 1u);
+    pool.deallocate(second, 1010);
+
+    // Kapasiteyi asan tampon saklanmaz
+    void* large = pool.allocate(2 << 20);
+    pool.deallocate(large, 2 << 20);
+    EXPECT_EQ(pool.getStats().retained_buffers, 1u);
+
+    pool.setCapacity(0);
+    EXPECT_EQ(pool.getStats().retained_bytes, 0u);
+    pool.setCapacity(1 << 20);
+    pool.deallocate(pool.allocate(100), 100);
+    pool.trim();
+    EXPECT_EQ(pool.getStats().retained_buffers, 0u);
+}
+
+TEST_F(ImageTest, ImageBufferRecyclingTest) {
+    BufferPool& pool = BufferPool::global();
+    pool.setEnabled(true);
+
+    const Image::Pixel* data = nullptr;
+    {
+        Image first(640, 480, 3, Image::Uninitialized);
+        data = first.getData().data();
+    }
+    const size_t hits = pool.getStats().hits;
+    Image second(640, 480, 3, Image::Uninitialized);
+    EXPECT_EQ(second.getData().data(), data);
+    EXPECT_EQ(pool.getStats().hits, hits + 1);
+
+    pool.setEnabled(false);
+    EXPECT_EQ(pool.getStats().retained_buffers, 0u);
+}
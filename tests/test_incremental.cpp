@@ -0,0 +1,178 @@
+#include <gtest/gtest.h>
+#include "FilterPipeline.h"
+#include "GaussianBlur.h"
+#include "EdgeDetection.h"
+#include "BrightnessAdjust.h"
+#include "Convolution.h"
+#include "TestUtils.h"
+
+using namespace GorselIsleme;
+using namespace GorselIsleme::test;
+
+class IncrementalTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        input = std::make_unique<Image>(120, 80, 3);
+        fill(*input, 0, 0, 120, 80, 13u);
+    }
+
+    static void fill(Image& image, int x, int y, int width, int height, unsigned seed) {
+        for (int row = y; row < y + height; ++row) {
+            for (int col = x; col < x + width; ++col) {
+                for (int c = 0; c < image.getChannels(); ++c) {
+                    image.at(col, row, c) = static_cast<Image::Pixel>(nextRandom(seed));
+                }
+            }
+        }
+    }
+
+    // Rastgele yamalar: her duzenlemeden sonra tam apply ile karsilastirilir
+    void checkEdits(FilterPipeline& pipeline) {
+        Image output(1, 1, 1);
+        pipeline.applyIncremental(*input, output, FilterPipeline::Rect());
+        ASSERT_EQ(output.getData(), pipeline.apply(*input)->getData());
+
+        unsigned seed = 7u;
+        for (int edit = 0; edit < 12; ++edit) {
+            nextRandom(seed);
+            const int width = 1 + static_cast<int>((seed >> 8) % 20);
+            const int height = 1 + static_cast<int>((seed >> 16) % 20);
+            const int x = static_cast<int>((seed >> 4) % (input->getWidth() - width + 1));
+            const int y = static_cast<int>((seed >> 12) % (input->getHeight() - height + 1));
+            fill(*input, x, y, width, height, seed);
+            pipeline.applyIncremental(*input, output, {x, y, width, height});
+            ASSERT_EQ(output.getData(), pipeline.apply(*input)->getData()) << "duzenleme " << edit;
+        }
+    }
+
+    std::unique_ptr<Image> input;
+};
+
+TEST_F(IncrementalTest, MatchesApplyTest) {
+    FilterPipeline pipeline;
+    pipeline.addFilter(std::make_unique<GaussianBlur>(1.5, 5));
+    pipeline.addFilter(std::make_unique<BrightnessAdjust>(1.2));
+    pipeline.addFilter(std::make_unique<BrightnessAdjust>(0.9));
+    pipeline.addFilter(std::make_unique<EdgeDetection>());
+    checkEdits(pipeline);
+}
+
+TEST_F(IncrementalTest, BorderModesTest) {
+    const Filter::BorderMode modes[] = {Filter::Clamp, Filter::Reflect, Filter::Constant, Filter::Wrap};
+    for (const auto mode : modes) {
+        auto blur = std::make_unique<GaussianBlur>(2.0, 7);
+        blur->setBorderMode(mode, 40);
+        auto edge = std::make_unique<EdgeDetection>();
+        edge->setBorderMode(mode, 40);
+        auto box = std::make_unique<Convolution>(std::vector<float>(9, 1.0f / 9.0f), 3, 3, Convolution::Direct);
+        box->setBorderMode(mode, 40);
+
+        FilterPipeline pipeline;
+        pipeline.addFilter(std::move(blur));
+        pipeline.addFilter(std::move(box));
+        pipeline.addFilter(std::move(edge));
+        checkEdits(pipeline);
+    }
+}
+
+TEST_F(IncrementalTest, ViewDependentConvolutionTest) {
+    // Fft'nin yuvarlamasi blok yerlesimine, Auto'nun secimi gorunum boyutuna
+    // bagli: yama yerine tum goruntu yeniden hesaplanmali
+    std::vector<float> kernel(31 * 31);
+    unsigned seed = 5u;
+    for (auto& tap : kernel) {
+        tap = static_cast<float>(nextRandom(seed) % 1000) / (1000.0f * 31 * 31 / 2);
+    }
+    for (auto strategy : {Convolution::Fft, Convolution::Auto}) {
+        FilterPipeline pipeline;
+        pipeline.addFilter(std::make_unique<Convolution>(kernel, 31, 31, strategy));
+        pipeline.addFilter(std::make_unique<EdgeDetection>());
+        EXPECT_FALSE(pipeline.isViewInvariant());
+        checkEdits(pipeline);
+
+        Image output(1, 1, 1);
+        pipeline.applyIncremental(*input, output, FilterPipeline::Rect());
+        const auto changed = pipeline.applyIncremental(*input, output, {10, 10, 2, 2});
+        EXPECT_EQ(changed.width, input->getWidth()) << strategy;
+        EXPECT_EQ(changed.height, input->getHeight()) << strategy;
+    }
+}
+
+TEST_F(IncrementalTest, ChangedRegionTest) {
+    FilterPipeline pipeline;
+    pipeline.addFilter(std::make_unique<GaussianBlur>(1.5, 5));
+    pipeline.addFilter(std::make_unique<BrightnessAdjust>(1.2));
+    pipeline.addFilter(std::make_unique<EdgeDetection>());
+    Image output(1, 1, 1);
+
+    // Ilk cagri tum goruntuyu isler
+    FilterPipeline::Rect changed = pipeline.applyIncremental(*input, output, {10, 10, 4, 4});
+    EXPECT_EQ(changed.width, 120);
+    EXPECT_EQ(changed.height, 80);
+
+    // Bolge asama yaricaplari toplami (2 + 0 + 1) kadar buyur
+    changed = pipeline.applyIncremental(*input, output, {10, 10, 4, 4});
+    EXPECT_EQ(changed.x, 7);
+    EXPECT_EQ(changed.y, 7);
+    EXPECT_EQ(changed.width, 10);
+    EXPECT_EQ(changed.height, 10);
+
+    // Goruntu kenarinda kirpilir
+    changed = pipeline.applyIncremental(*input, output, {-5, 78, 8, 10});
+    EXPECT_EQ(changed.x, 0);
+    EXPECT_EQ(changed.y, 75);
+    EXPECT_EQ(changed.width, 6);
+    EXPECT_EQ(changed.height, 5);
+
+    changed = pipeline.applyIncremental(*input, output, {200, 10, 4, 4});
+    EXPECT_EQ(changed.width, 0);
+    EXPECT_THROW(pipeline.applyIncremental(*input, output, {0, 0, -1, 4}), std::invalid_argument);
+    EXPECT_THROW(pipeline.applyIncremental(*input, *input, {0, 0, 1, 1}), std::invalid_argument);
+
+    // Filtre listesi degisince tekrar tam hesaplanir
+    pipeline.addFilter(std::make_unique<BrightnessAdjust>(0.8));
+    changed = pipeline.applyIncremental(*input, output, {10, 10, 4, 4});
+    EXPECT_EQ(changed.width, 120);
+    EXPECT_EQ(output.getData(), pipeline.apply(*input)->getData());
+}
+
+TEST_F(IncrementalTest, CostScalesWithDirtyAreaTest) {
+    CountingBlur::Counts counts;
+    FilterPipeline pipeline;
+    pipeline.addFilter(std::make_unique<CountingBlur>(counts, 2.0, 7));
+    pipeline.addFilter(std::make_unique<EdgeDetection>());
+    Image output(1, 1, 1);
+    pipeline.applyIncremental(*input, output, FilterPipeline::Rect());
+    EXPECT_EQ(counts.pixels.load(), 120L * 80);
+
+    // 2x2 yama: bulaniklastirma (2 + 3 + 3) x (2 + 3 + 3) pikselde calisir
+    counts.reset();
+    fill(*input, 50, 40, 2, 2, 99u);
+    pipeline.applyIncremental(*input, output, {50, 40, 2, 2});
+    EXPECT_EQ(counts.pixels.load(), 14L * 14);
+    EXPECT_EQ(output.getData(), pipeline.apply(*input)->getData());
+
+    // Boyut degisince tam hesaplanir
+    counts.reset();
+    Image smaller(60, 40, 3);
+    pipeline.applyIncremental(smaller, output, {0, 0, 1, 1});
+    EXPECT_EQ(counts.pixels.load(), 60L * 40);
+    EXPECT_EQ(output.getWidth(), 60);
+
+    // resetIncremental sonrasi da
+    counts.reset();
+    pipeline.resetIncremental();
+    pipeline.applyIncremental(smaller, output, {0, 0, 1, 1});
+    EXPECT_EQ(counts.pixels.load(), 60L * 40);
+}
+
+TEST_F(IncrementalTest, EmptyPipelineTest) {
+    FilterPipeline pipeline;
+    Image output(1, 1, 1);
+    pipeline.applyIncremental(*input, output, FilterPipeline::Rect());
+    EXPECT_EQ(output.getData(), input->getData());
+    fill(*input, 3, 4, 5, 6, 5u);
+    const FilterPipeline::Rect changed = pipeline.applyIncremental(*input, output, {3, 4, 5, 6});
+    EXPECT_EQ(changed.width, 5);
+    EXPECT_EQ(output.getData(), input->getData());
+}
@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+#include "Image.h"
+#include "ThreadPool.h"
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <jpeglib.h>
+
+using namespace GorselIsleme;
+
+class JpegTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // Tirnak ve bosluk iceren dizin/dosya adi: eski kabuk tabanli yol burada bozuluyordu
+        directory = std::filesystem::temp_directory_path() / "gorselisleme jpeg'test";
+        std::filesystem::remove_all(directory);
+        std::filesystem::create_directories(directory);
+
+        for (int y = 0; y < 37; ++y) {
+            for (int x = 0; x < 50; ++x) {
+                color.at(x, y, 0) = static_cast<Image::Pixel>(x * 5);
+                color.at(x, y, 1) = static_cast<Image::Pixel>(y * 6);
+                color.at(x, y, 2) = static_cast<Image::Pixel>((x + y) * 3);
+            }
+        }
+        color_path = (directory / "renk \"1\".jpg").string();
+        writeJpeg(color_path, color);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(directory);
+    }
+
+    // Test girdisi libjpeg ile yuksek kalitede kodlanir
+    static void writeJpeg(const std::string& path, const Image& image) {
+        std::FILE* file = std::fopen(path.c_str(), "wb");
+        ASSERT_NE(file, nullptr);
+        jpeg_compress_struct info;
+        jpeg_error_mgr error;
+        info.err = jpeg_std_error(&error);
+        jpeg_create_compress(&info);
+        jpeg_stdio_dest(&info, file);
+        info.image_width = static_cast<JDIMENSION>(image.getWidth());
+        info.image_height = static_cast<JDIMENSION>(image.getHeight());
+        info.input_components = image.getChannels();
+        info.in_color_space = image.getChannels() == 1 ? JCS_GRAYSCALE : JCS_RGB;
+        jpeg_set_defaults(&info);
+        jpeg_set_quality(&info, 98, TRUE);
+        jpeg_start_compress(&info, TRUE);
+        while (info.next_scanline < info.image_height) {
+            JSAMPROW row = const_cast<JSAMPROW>(image.view().row(static_cast<int>(info.next_scanline)));
+            jpeg_write_scanlines(&info, &row, 1);
+        }
+        jpeg_finish_compress(&info);
+        jpeg_destroy_compress(&info);
+        std::fclose(file);
+    }
+
+    static double meanAbsoluteError(const Image& a, const Image& b) {
+        double sum = 0.0;
+        for (size_t i = 0; i < a.getData().size(); ++i) {
+            sum += std::abs(static_cast<int>(a.getData()[i]) - static_cast<int>(b.getData()[i]));
+        }
+        return sum / static_cast<double>(a.getData().size());
+    }
+
+    std::filesystem::path directory;
+    Image color{50, 37, 3};
+    std::string color_path;
+};
+
+TEST_F(JpegTest, DecodeColorTest) {
+    auto decoded = Image::loadJPEG(color_path, 1, 3);
+    ASSERT_NE(decoded, nullptr);
+    EXPECT_EQ(decoded->getWidth(), 50);
+    EXPECT_EQ(decoded->getHeight(), 37);
+    EXPECT_EQ(decoded->getChannels(), 3);
+    EXPECT_LT(meanAbsoluteError(*decoded, color), 3.0);
+}
+
+TEST_F(JpegTest, DecodeGrayTest) {
+    auto gray = Image::loadJPEG(color_path);
+    ASSERT_NE(gray, nullptr);
+    EXPECT_EQ(gray->getChannels(), 1);
+
+    // Gri donusum BT.601 agirliklari ile
+    Image expected(50, 37, 1);
+    for (int y = 0; y < 37; ++y) {
+        for (int x = 0; x < 50; ++x) {
+            expected.at(x, y) = static_cast<Image::Pixel>(
+                0.299 * color.at(x, y, 0) + 0.587 * color.at(x, y, 1) + 0.114 * color.at(x, y, 2) + 0.5);
+        }
+    }
+    EXPECT_LT(meanAbsoluteError(*gray, expected), 3.0);
+
+    // Gri kodlanmis dosya RGB olarak da acilabilir
+    const std::string gray_path = (directory / "gri.jpeg").string();
+    writeJpeg(gray_path, expected);
+    auto rgb = Image::loadJPEG(gray_path, 1, 3);
+    ASSERT_NE(rgb, nullptr);
+    EXPECT_EQ(rgb->getChannels(), 3);
+    EXPECT_EQ(rgb->at(20, 20, 0), rgb->at(20, 20, 2));
+}
+
+TEST_F(JpegTest, ScaledDecodeTest) {
+    auto full = Image::loadJPEG(color_path, 1, 3);
+    ASSERT_NE(full, nullptr);
+    for (int denominator : {2, 4, 8}) {
+        auto scaled = Image::loadJPEG(color_path, denominator, 3);
+        ASSERT_NE(scaled, nullptr) << denominator;
+        EXPECT_EQ(scaled->getWidth(), (50 + denominator - 1) / denominator);
+        EXPECT_EQ(scaled->getHeight(), (37 + denominator - 1) / denominator);
+
+        // Kucultulmus pikseller tam cozumun ilgili blok ortalamasina yakin
+        const int x = scaled->getWidth() / 2;
+        const int y = scaled->getHeight() / 2;
+        int sum = 0;
+        for (int dy = 0; dy < denominator; ++dy) {
+            for (int dx = 0; dx < denominator; ++dx) {
+                sum += full->at(x * denominator + dx, y * denominator + dy, 0);
+            }
+        }
+        EXPECT_NEAR(scaled->at(x, y, 0), sum / (denominator * denominator), 6) << denominator;
+    }
+
+    EXPECT_THROW(Image::loadJPEG(color_path, 3), std::invalid_argument);
+    EXPECT_THROW(Image::loadJPEG(color_path, 1, 4), std::invalid_argument);
+}
+
+TEST_F(JpegTest, InvalidFilesTest) {
+    EXPECT_EQ(Image::loadJPEG((directory / "yok.jpg").string()), nullptr);
+
+    const std::string not_jpeg = (directory / "metin.jpg").string();
+    std::ofstream(not_jpeg) << "JPEG degil";
+    EXPECT_EQ(Image::loadJPEG(not_jpeg), nullptr);
+
+    const std::string empty = (directory / "bos.jpg").string();
+    std::ofstream(empty).close();
+    EXPECT_EQ(Image::loadJPEG(empty), nullptr);
+}
+
+TEST_F(JpegTest, ConcurrentDecodeTest) {
+    const size_t saved_thread_count = ThreadPool::global().getThreadCount();
+    ThreadPool::setGlobalThreadCount(4);
+
+    auto reference = Image::loadJPEG(color_path, 2, 3);
+    ASSERT_NE(reference, nullptr);
+    std::vector<std::unique_ptr<Image>> results(32);
+    ThreadPool::global().parallelFor(0, 32, 1, [&](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+            results[i] = Image::loadJPEG(color_path, 2, 3);
+        }
+    });
+    for (const auto& result : results) {
+        ASSERT_NE(result, nullptr);
+        EXPECT_EQ(result->getData(), reference->getData());
+    }
+
+    ThreadPool::setGlobalThreadCount(saved_thread_count);
+}
@@ -3,9 +3,48 @@
 #include "GaussianBlur.h"
 #include "EdgeDetection.h"
 #include "BrightnessAdjust.h"
+#include "Convolution.h"
+#include "PointOp.h"
 #include "Image.h"
+#include "ThreadPool.h"
+#include "TestUtils.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
 
 using namespace GorselIsleme;
+using namespace GorselIsleme::test;
+
+// Kararli durum ayirma testi icin global operator new sayaci (hizali surum
+// dahil). Varsayilan operator delete bu bellegi free() ile birakir.
+namespace {
+std::atomic<bool> g_count_allocations{false};
+std::atomic<long> g_allocation_count{0};
+}
+
+void* operator new(std::size_t size) {
+    if (g_count_allocations.load(std::memory_order_relaxed)) {
+        g_allocation_count.fetch_add(1, std::memory_order_relaxed);
+    }
+    void* pointer = std::malloc(size ? size : 1);
+    if (!pointer) {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    if (g_count_allocations.load(std::memory_order_relaxed)) {
+        g_allocation_count.fetch_add(1, std::memory_order_relaxed);
+    }
+    const std::size_t align = static_cast<std::size_t>(alignment);
+    void* pointer = std::aligned_alloc(align, (std::max<std::size_t>(size, 1) + align - 1) / align * align);
+    if (!pointer) {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
 
 class PipelineTest : public ::testing::Test {
 protected:
@@ -97,4 +136,276 @@ TEST_F(PipelineTest, ClonePipelineTest) {
     EXPECT_EQ(cloned_pipeline->getFilterCount(), 2);
     EXPECT_EQ(cloned_pipeline->getFilterName(0), "GaussianBlur");
     EXPECT_EQ(cloned_pipeline->getFilterName(1), "BrightnessAdjust");
-}
\ No newline at end of file
+}
+
+TEST_F(PipelineTest, PointOpFusionTest) {
+    FilterPipeline pipeline;
+    pipeline.addFilter(std::make_unique<BrightnessAdjust>(1.7));
+    pipeline.addFilter(std::make_unique<GammaCorrection>(0.8));
+    pipeline.addFilter(std::make_unique<GaussianBlur>(1.0, 3));
+    pipeline.addFilter(std::make_unique<Invert>());
+    pipeline.addFilter(std::make_unique<ContrastAdjust>(1.3));
+    pipeline.addFilter(std::make_unique<Threshold>(90));
+
+    // Birlestirilmis sonuc filtrelerin tek tek uygulanmasiyla ayni olmali
+    std::unique_ptr<Image> expected = std::make_unique<Image>(*test_image);
+    BrightnessAdjust bright(1.7);
+    GammaCorrection gamma(0.8);
+    GaussianBlur blur(1.0, 3);
+    Invert invert;
+    ContrastAdjust contrast(1.3);
+    Threshold threshold(90);
+    const Filter* filters[] = {&bright, &gamma, &blur, &invert, &contrast, &threshold};
+    for (const Filter* filter : filters) {
+        expected = filter->apply(*expected);
+    }
+
+    auto result = pipeline.apply(*test_image);
+    ASSERT_NE(result, nullptr);
+    EXPECT_EQ(result->getData(), expected->getData());
+}
+
+TEST_F(PipelineTest, PointOpOnlyPipelineTest) {
+    FilterPipeline pipeline;
+    pipeline.addFilter(std::make_unique<Invert>());
+    pipeline.addFilter(std::make_unique<Invert>());
+
+    auto result = pipeline.apply(*test_image);
+    ASSERT_NE(result, nullptr);
+    EXPECT_EQ(result->getData(), test_image->getData());
+}
+
+TEST_F(PipelineTest, RadiusTest) {
+    EXPECT_EQ(GaussianBlur(1.0, 5).getRadius(), 2);
+    EXPECT_EQ(EdgeDetection().getRadius(), 1);
+    EXPECT_EQ(BrightnessAdjust(1.2).getRadius(), 0);
+
+    GaussianBlur box(6.0, 37, GaussianBlur::StackedBox);
+    int box_radius = 0;
+    for (int radius : box.getBoxRadii()) {
+        box_radius += radius;
+    }
+    EXPECT_EQ(box.getRadius(), box_radius);
+
+    FilterPipeline pipeline;
+    pipeline.addFilter(std::make_unique<GaussianBlur>(1.0, 7));
+    pipeline.addFilter(std::make_unique<BrightnessAdjust>(1.2));
+    pipeline.addFilter(std::make_unique<EdgeDetection>());
+    EXPECT_EQ(pipeline.getRadius(), 4);
+}
+
+TEST_F(PipelineTest, TiledMatchesSequentialTest) {
+    const Image noise = makeNoiseImage(203, 157, 3, 3u);
+
+    FilterPipeline pipeline;
+    pipeline.addFilter(std::make_unique<GaussianBlur>(1.5, 5));
+    pipeline.addFilter(std::make_unique<BrightnessAdjust>(1.3));
+    pipeline.addFilter(std::make_unique<Invert>());
+    pipeline.addFilter(std::make_unique<EdgeDetection>());
+    pipeline.addFilter(std::make_unique<GaussianBlur>(6.0, 37, GaussianBlur::StackedBox));
+    pipeline.addFilter(std::make_unique<GammaCorrection>(1.4));
+
+    auto expected = pipeline.apply(noise);
+
+    pipeline.setExecutionMode(FilterPipeline::Tiled);
+    const int tile_sizes[][2] = {{256, 256}, {64, 32}, {37, 23}, {1, 300}, {500, 7}};
+    for (const auto& size : tile_sizes) {
+        pipeline.setTileSize(size[0], size[1]);
+        auto result = pipeline.apply(noise);
+        ASSERT_NE(result, nullptr);
+        EXPECT_EQ(result->getData(), expected->getData()) << size[0] << "x" << size[1];
+    }
+}
+
+TEST_F(PipelineTest, BorderModesTiledTest) {
+    const Image noise = makeNoiseImage(97, 61, 3, 4u);
+
+    // Yerel kenar modlari karolarla ayni sonucu verir; Wrap Sequential'a duser
+    for (auto mode : {Filter::Clamp, Filter::Reflect, Filter::Constant, Filter::Wrap}) {
+        FilterPipeline pipeline;
+        auto blur = std::make_unique<GaussianBlur>(2.0, 9);
+        blur->setBorderMode(mode, 50);
+        auto box = std::make_unique<GaussianBlur>(6.0, 37, GaussianBlur::StackedBox);
+        box->setBorderMode(mode, 50);
+        auto edge = std::make_unique<EdgeDetection>();
+        edge->setBorderMode(mode, 50);
+        pipeline.addFilter(std::move(blur));
+        pipeline.addFilter(std::move(edge));
+        pipeline.addFilter(std::move(box));
+        EXPECT_EQ(pipeline.isLocal(), mode != Filter::Wrap);
+
+        auto expected = pipeline.apply(noise);
+        pipeline.setExecutionMode(FilterPipeline::Tiled);
+        pipeline.setTileSize(32, 24);
+        EXPECT_EQ(pipeline.apply(noise)->getData(), expected->getData()) << "mode=" << mode;
+        Image output(1, 1, 1);
+        pipeline.apply(noise, output);
+        EXPECT_EQ(output.getData(), expected->getData()) << "mode=" << mode;
+    }
+}
+
+TEST_F(PipelineTest, ConvolutionStrategiesTiledTest) {
+    const Image noise = makeNoiseImage(211, 143, 3, 6u);
+    std::vector<float> kernel(31 * 31);
+    unsigned seed = 8u;
+    for (auto& tap : kernel) {
+        tap = static_cast<float>(nextRandom(seed) % 1000) / (1000.0f * 31 * 31 / 2);
+    }
+
+    // Direct ve Separable karolarla ayni sonucu verir; Fft ve Auto gorunume
+    // bagli oldugundan Sequential'a duser
+    for (auto strategy : {Convolution::Direct, Convolution::Separable, Convolution::Fft, Convolution::Auto}) {
+        FilterPipeline pipeline;
+        pipeline.addFilter(std::make_unique<Convolution>(kernel, 31, 31, strategy));
+        pipeline.addFilter(std::make_unique<BrightnessAdjust>(1.1));
+        EXPECT_EQ(pipeline.isViewInvariant(),
+                  strategy == Convolution::Direct || strategy == Convolution::Separable);
+
+        auto expected = pipeline.apply(noise);
+        pipeline.setExecutionMode(FilterPipeline::Tiled);
+        for (int tile : {64, 37}) {
+            pipeline.setTileSize(tile, tile);
+            EXPECT_EQ(pipeline.apply(noise)->getData(), expected->getData()) << strategy << " " << tile;
+            Image output(1, 1, 1);
+            pipeline.apply(noise, output);
+            EXPECT_EQ(output.getData(), expected->getData()) << strategy << " " << tile;
+        }
+    }
+}
+
+TEST_F(PipelineTest, TiledSettingsTest) {
+    FilterPipeline pipeline;
+    pipeline.addFilter(std::make_unique<EdgeDetection>());
+    pipeline.setExecutionMode(FilterPipeline::Tiled);
+    pipeline.setTileSize(16, 8);
+    EXPECT_THROW(pipeline.setTileSize(0, 8), std::invalid_argument);
+
+    auto cloned = pipeline.clone();
+    EXPECT_EQ(cloned->getExecutionMode(), FilterPipeline::Tiled);
+    EXPECT_EQ(cloned->getTileWidth(), 16);
+    EXPECT_EQ(cloned->getTileHeight(), 8);
+
+    auto result = cloned->apply(*test_image);
+    auto expected = EdgeDetection().apply(*test_image);
+    EXPECT_EQ(result->getData(), expected->getData());
+}
+
+
+TEST_F(PipelineTest, PreparedApplyMatchesApplyTest) {
+    const Image noise = makeNoiseImage(131, 97, 3, 5u);
+
+    FilterPipeline pipeline;
+    pipeline.addFilter(std::make_unique<BrightnessAdjust>(1.1));
+    pipeline.addFilter(std::make_unique<GaussianBlur>(1.5, 5));
+    pipeline.addFilter(std::make_unique<Invert>());
+    pipeline.addFilter(std::make_unique<EdgeDetection>());
+    pipeline.addFilter(std::make_unique<GaussianBlur>(6.0, 37, GaussianBlur::StackedBox));
+    pipeline.addFilter(std::make_unique<ContrastAdjust>(1.2));
+    pipeline.addFilter(std::make_unique<GammaCorrection>(0.8));
+
+    auto expected = pipeline.apply(noise);
+
+    Image output(1, 1, 1);
+    pipeline.apply(noise, output);
+    EXPECT_TRUE(pipeline.isPreparedFor(131, 97, 3));
+    EXPECT_EQ(output.getData(), expected->getData());
+
+    // Ikinci cagri ayni cikti tamponunu kullanir
+    const Image::Pixel* data = output.getData().data();
+    pipeline.apply(noise, output);
+    EXPECT_EQ(output.getData().data(), data);
+    EXPECT_EQ(output.getData(), expected->getData());
+
+    pipeline.setExecutionMode(FilterPipeline::Tiled);
+    pipeline.setTileSize(32, 48);
+    EXPECT_FALSE(pipeline.isPreparedFor(131, 97, 3));
+    pipeline.apply(noise, output);
+    EXPECT_EQ(output.getData(), expected->getData());
+
+    // Filtre listesi degisince plan yeniden kurulur
+    pipeline.addFilter(std::make_unique<Invert>());
+    EXPECT_FALSE(pipeline.isPreparedFor(131, 97, 3));
+    pipeline.apply(noise, output);
+    EXPECT_EQ(output.getData(), Invert().apply(*expected)->getData());
+
+    EXPECT_THROW(pipeline.apply(output, output), std::invalid_argument);
+}
+
+TEST_F(PipelineTest, PreparedApplyEmptyPipelineTest) {
+    FilterPipeline pipeline;
+    Image output(3, 3, 3);
+    pipeline.apply(*test_image, output);
+    EXPECT_EQ(output.getChannels(), 1);
+    EXPECT_EQ(output.getData(), test_image->getData());
+}
+
+TEST_F(PipelineTest, PreparedApplySteadyStateAllocationTest) {
+    const size_t saved_thread_count = ThreadPool::global().getThreadCount();
+
+    const Image input = makeNoiseImage(160, 120, 3, 9u);
+
+    FilterPipeline pipeline;
+    pipeline.addFilter(std::make_unique<GaussianBlur>(1.5, 5));
+    pipeline.addFilter(std::make_unique<BrightnessAdjust>(1.2));
+    pipeline.addFilter(std::make_unique<EdgeDetection>(EdgeDetection::Both, EdgeDetection::L1));
+    pipeline.addFilter(std::make_unique<GaussianBlur>(6.0, 37, GaussianBlur::StackedBox));
+    pipeline.addFilter(std::make_unique<Invert>());
+
+    const FilterPipeline::ExecutionMode modes[] = {FilterPipeline::Sequential, FilterPipeline::Tiled};
+    for (size_t thread_count : {1u, 4u}) {
+        ThreadPool::setGlobalThreadCount(thread_count);
+        for (auto mode : modes) {
+            pipeline.setExecutionMode(mode);
+            pipeline.setTileSize(64, 64);
+            Image output(input.getWidth(), input.getHeight(), input.getChannels());
+
+            // Ilk cagrilar plani, ara tamponu ve thread basina gecici tamponlari
+            // hazirlar; iscilerin tamponlari aldiklari karolara gore isinir.
+            // Kararli duruma ulasildiktan sonra cagrilar hic ayirma yapmamali.
+            pipeline.apply(input, output);
+            long allocations = -1;
+            for (int round = 0; round < 20 && allocations != 0; ++round) {
+                g_allocation_count = 0;
+                g_count_allocations = true;
+                for (int i = 0; i < 3; ++i) {
+                    pipeline.apply(input, output);
+                }
+                g_count_allocations = false;
+                allocations = g_allocation_count.load();
+            }
+            EXPECT_EQ(allocations, 0) << thread_count << " thread, mod " << mode;
+        }
+    }
+
+    ThreadPool::setGlobalThreadCount(saved_thread_count);
+}
+
+TEST_F(PipelineTest, PreparedApplyLargeScratchAllocationTest) {
+    const size_t saved_thread_count = ThreadPool::global().getThreadCount();
+
+    // Kutu yolunun iki uint16 duzlemi ~25 MB: thread basina gecici tampon
+    // sinirini (16 MB) asar, yine de hattin alaninda tutulmali
+    const Image input = makeNoiseImage(1920, 1080, 3, 13u);
+
+    FilterPipeline pipeline;
+    pipeline.addFilter(std::make_unique<GaussianBlur>(10.0, 61));
+    pipeline.addFilter(std::make_unique<EdgeDetection>());
+
+    for (size_t thread_count : {1u, 4u}) {
+        ThreadPool::setGlobalThreadCount(thread_count);
+        Image output(input.getWidth(), input.getHeight(), input.getChannels());
+
+        pipeline.apply(input, output);
+        long allocations = -1;
+        for (int round = 0; round < 10 && allocations != 0; ++round) {
+            g_allocation_count = 0;
+            g_count_allocations = true;
+            pipeline.apply(input, output);
+            g_count_allocations = false;
+            allocations = g_allocation_count.load();
+        }
+        EXPECT_EQ(allocations, 0) << thread_count << " thread";
+    }
+
+    ThreadPool::setGlobalThreadCount(saved_thread_count);
+}
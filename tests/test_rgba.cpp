@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include "RgbaConvert.h"
+#include "Image.h"
+#include "TestUtils.h"
+#include <stdexcept>
+#include <vector>
+
+using namespace GorselIsleme;
+using namespace GorselIsleme::test;
+
+class RgbaConvertTest : public ::testing::Test {
+protected:
+    static Image makeImage(int width, int height, int channels) {
+        return makeNoiseImage(width, height, channels, 17u + width * 31u + channels);
+    }
+
+    // Piksel piksel beklenen RGBA
+    static std::vector<uint8_t> reference(const ConstImageView& view) {
+        std::vector<uint8_t> result;
+        for (int y = 0; y < view.getHeight(); ++y) {
+            for (int x = 0; x < view.getWidth(); ++x) {
+                const int channels = view.getChannels();
+                const uint8_t first = view.at(x, y, 0);
+                result.push_back(first);
+                result.push_back(channels >= 3 ? view.at(x, y, 1) : first);
+                result.push_back(channels >= 3 ? view.at(x, y, 2) : first);
+                result.push_back(channels == 2 ? view.at(x, y, 1) : channels == 4 ? view.at(x, y, 3) : 255);
+            }
+        }
+        return result;
+    }
+};
+
+TEST_F(RgbaConvertTest, MatchesReferenceTest) {
+    // SIMD govdeleri ve kuyruklar icin farkli genislikler
+    for (int channels = 1; channels <= 4; ++channels) {
+        for (int width = 1; width <= 70; ++width) {
+            const Image image = makeImage(width, 3, channels);
+            std::vector<uint8_t> output(static_cast<size_t>(width) * 3 * 4);
+            convertToRgba(image.view(), output.data(), width * 4);
+            ASSERT_EQ(output, reference(image.view())) << "kanal " << channels << " genislik " << width;
+        }
+    }
+}
+
+TEST_F(RgbaConvertTest, SubViewAndStrideTest) {
+    const Image image = makeImage(100, 40, 3);
+    const ConstImageView region = image.view(13, 7, 50, 20);
+    // Satir sonlarinda dolgu: dolguya yazilmamali
+    const std::ptrdiff_t stride = 50 * 4 + 12;
+    std::vector<uint8_t> output(static_cast<size_t>(stride) * 20, 0xAB);
+    convertToRgba(region, output.data(), stride);
+
+    const std::vector<uint8_t> expected = reference(region);
+    for (int y = 0; y < 20; ++y) {
+        const uint8_t* row = output.data() + y * stride;
+        ASSERT_TRUE(std::equal(row, row + 50 * 4, expected.begin() + y * 50 * 4)) << "satir " << y;
+        for (int i = 50 * 4; i < stride; ++i) {
+            ASSERT_EQ(row[i], 0xAB);
+        }
+    }
+}
+
+TEST_F(RgbaConvertTest, InvalidArgumentsTest) {
+    const Image gray = makeImage(8, 2, 1);
+    std::vector<uint8_t> output(8 * 2 * 4);
+    EXPECT_THROW(convertToRgba(gray.view(), output.data(), 8 * 4 - 1), std::invalid_argument);
+    EXPECT_THROW(convertToRgba(gray.view(), nullptr, 8 * 4), std::invalid_argument);
+    const Image five = makeImage(8, 2, 5);
+    EXPECT_THROW(convertToRgba(five.view(), output.data(), 8 * 4), std::invalid_argument);
+}
@@ -0,0 +1,176 @@
+#include <gtest/gtest.h>
+#include "FilterPipeline.h"
+#include "RowStream.h"
+#include "GaussianBlur.h"
+#include "EdgeDetection.h"
+#include "BrightnessAdjust.h"
+#include "Convolution.h"
+#include "PointOp.h"
+#include "TestUtils.h"
+#include <filesystem>
+#include <fstream>
+
+using namespace GorselIsleme;
+using namespace GorselIsleme::test;
+
+class StreamTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        pipeline.addFilter(std::make_unique<GaussianBlur>(1.5, 5));
+        pipeline.addFilter(std::make_unique<GaussianBlur>(4.0, 25, GaussianBlur::StackedBox));
+        pipeline.addFilter(std::make_unique<BrightnessAdjust>(1.3));
+        pipeline.addFilter(std::make_unique<EdgeDetection>());
+        pipeline.addFilter(std::make_unique<GammaCorrection>(0.8));
+
+        directory = std::filesystem::temp_directory_path() / "gorselisleme_stream_test";
+        std::filesystem::remove_all(directory);
+        std::filesystem::create_directories(directory);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(directory);
+    }
+
+    static Image makeImage(int width, int height, int channels) {
+        Image image(width, height, channels);
+        unsigned seed = 7u;
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                for (int c = 0; c < channels; ++c) {
+                    // Gurultu ustune kenar: tum asamalar anlamli cikti uretir
+                    const int base = ((x / 9 + y / 13) % 2) * 120;
+                    image.at(x, y, c) = static_cast<Image::Pixel>(base + nextRandom(seed) % 100);
+                }
+            }
+        }
+        return image;
+    }
+
+    static void writePnm(const std::string& path, const Image& image) {
+        std::ofstream file(path, std::ios::binary);
+        file << (image.getChannels() == 3 ? "P6" : "P5") << "\n# yorum\n"
+             << image.getWidth() << " " << image.getHeight() << "\n255\n";
+        file.write(reinterpret_cast<const char*>(image.getData().data()), image.getData().size());
+    }
+
+    static std::vector<Image::Pixel> readPnmPixels(const std::string& path, const Image& like) {
+        PnmRowSource source(path);
+        EXPECT_EQ(source.getWidth(), like.getWidth());
+        EXPECT_EQ(source.getHeight(), like.getHeight());
+        EXPECT_EQ(source.getChannels(), like.getChannels());
+        Image image(source.getWidth(), source.getHeight(), source.getChannels());
+        source.readRows(image.view());
+        return std::vector<Image::Pixel>(image.getData().begin(), image.getData().end());
+    }
+
+    FilterPipeline pipeline;
+    std::filesystem::path directory;
+};
+
+TEST_F(StreamTest, MatchesApplyTest) {
+    const Image input = makeImage(53, 97, 1);
+    const auto expected = pipeline.apply(input);
+
+    for (int strip_rows : {1, 7, 64, 200}) {
+        Image output(input.getWidth(), input.getHeight(), input.getChannels());
+        ImageRowSource source(input);
+        ImageRowSink sink(output);
+        const StreamStats stats = pipeline.applyStreaming(source, sink, strip_rows);
+        EXPECT_EQ(output.getData(), expected->getData()) << strip_rows;
+        EXPECT_EQ(stats.strips, (input.getHeight() + strip_rows - 1) / strip_rows);
+    }
+}
+
+TEST_F(StreamTest, ViewDependentFilterTest) {
+    // Fft seritlerle ayni sonucu vermez; goruntu tek serit olarak islenir
+    const Image input = makeImage(61, 47, 3);
+    FilterPipeline fft_pipeline;
+    fft_pipeline.addFilter(std::make_unique<Convolution>(std::vector<float>(15 * 15, 1.0f / 225), 15, 15,
+                                                         Convolution::Fft));
+    fft_pipeline.addFilter(std::make_unique<EdgeDetection>());
+    const auto expected = fft_pipeline.apply(input);
+
+    Image output(input.getWidth(), input.getHeight(), input.getChannels());
+    ImageRowSource source(input);
+    ImageRowSink sink(output);
+    const StreamStats stats = fft_pipeline.applyStreaming(source, sink, 8);
+    EXPECT_EQ(output.getData(), expected->getData());
+    EXPECT_EQ(stats.strips, 1);
+}
+
+TEST_F(StreamTest, PnmFilesTest) {
+    for (int channels : {1, 3}) {
+        const Image input = makeImage(41, 70, channels);
+        const auto expected = pipeline.apply(input);
+        const std::string input_path = (directory / "girdi.pnm").string();
+        const std::string output_path = (directory / "cikti.pnm").string();
+        writePnm(input_path, input);
+
+        for (int strip_rows : {1, 16, 100}) {
+            pipeline.applyStreaming(input_path, output_path, strip_rows);
+            const auto pixels = readPnmPixels(output_path, input);
+            EXPECT_EQ(pixels, std::vector<Image::Pixel>(expected->getData().begin(), expected->getData().end()))
+                << channels << " " << strip_rows;
+        }
+    }
+}
+
+TEST_F(StreamTest, EmptyPipelineTest) {
+    const Image input = makeImage(20, 33, 3);
+    Image output(20, 33, 3);
+    ImageRowSource source(input);
+    ImageRowSink sink(output);
+    FilterPipeline empty;
+    empty.applyStreaming(source, sink, 8);
+    EXPECT_EQ(output.getData(), input.getData());
+}
+
+TEST_F(StreamTest, BoundedMemoryTest) {
+    // Uzun goruntude tampon boyutu yukseklikten bagimsiz kalmali
+    const Image input = makeImage(64, 2000, 1);
+    Image output(64, 2000, 1);
+    ImageRowSource source(input);
+    ImageRowSink sink(output);
+    const int strip_rows = 16;
+    const StreamStats stats = pipeline.applyStreaming(source, sink, strip_rows);
+
+    const size_t row_size = 64;
+    const size_t window_rows = strip_rows + 2 * pipeline.getRadius();
+    EXPECT_LE(stats.buffer_bytes, (pipeline.getFilterCount() + 1) * window_rows * row_size);
+    EXPECT_LT(stats.buffer_bytes, input.getData().size() / 4);
+    EXPECT_EQ(output.getData(), pipeline.apply(input)->getData());
+}
+
+TEST_F(StreamTest, ErrorsTest) {
+    const Image input = makeImage(10, 10, 1);
+    Image output(10, 10, 1);
+    ImageRowSource source(input);
+    ImageRowSink sink(output);
+    EXPECT_THROW(pipeline.applyStreaming(source, sink, 0), std::invalid_argument);
+
+    Image wrong(10, 9, 1);
+    ImageRowSource source2(input);
+    ImageRowSink short_sink(wrong);
+    EXPECT_THROW(pipeline.applyStreaming(source2, short_sink, 4), std::out_of_range);
+
+    // Wrap kenar modu karsi kenari okur, seritlerle islenemez
+    FilterPipeline wrapped;
+    auto blur = std::make_unique<GaussianBlur>(1.5, 5);
+    blur->setBorderMode(Filter::Wrap);
+    wrapped.addFilter(std::move(blur));
+    ImageRowSource source3(input);
+    ImageRowSink sink3(output);
+    EXPECT_THROW(wrapped.applyStreaming(source3, sink3, 4), std::invalid_argument);
+
+    const std::string missing = (directory / "yok.pgm").string();
+    EXPECT_THROW(pipeline.applyStreaming(missing, (directory / "c.pgm").string()), std::runtime_error);
+
+    const std::string broken = (directory / "bozuk.pgm").string();
+    std::ofstream(broken) << "P2\n1 1\n255\n0\n";
+    EXPECT_THROW(PnmRowSource{broken}, std::runtime_error);
+
+    // Baslik dogru, veri eksik
+    const std::string truncated = (directory / "kisa.pgm").string();
+    std::ofstream(truncated, std::ios::binary) << "P5\n10 10\n255\n" << std::string(30, 'a');
+    EXPECT_THROW(pipeline.applyStreaming(truncated, (directory / "c.pgm").string(), 4), std::runtime_error);
+}
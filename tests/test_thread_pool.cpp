@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+#include "ThreadPool.h"
+#include "GaussianBlur.h"
+#include "EdgeDetection.h"
+#include "BrightnessAdjust.h"
+#include "FilterPipeline.h"
+#include "Image.h"
+#include "TestUtils.h"
+#include <atomic>
+#include <stdexcept>
+
+using namespace GorselIsleme;
+using namespace GorselIsleme::test;
+
+class ThreadPoolTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        saved_thread_count = ThreadPool::global().getThreadCount();
+
+        // Birden fazla banda bolunecek kadar buyuk goruntu
+        test_image = std::make_unique<Image>(makeNoiseImage(320, 410, 3, 17u));
+    }
+
+    void TearDown() override {
+        ThreadPool::setGlobalThreadCount(saved_thread_count);
+    }
+
+    std::unique_ptr<Image> applyWithThreads(const Filter& filter, size_t thread_count) {
+        ThreadPool::setGlobalThreadCount(thread_count);
+        return filter.apply(*test_image);
+    }
+
+    size_t saved_thread_count = 1;
+    std::unique_ptr<Image> test_image;
+};
+
+TEST_F(ThreadPoolTest, ParallelForCoversRangeTest) {
+    ThreadPool pool(4);
+    EXPECT_EQ(pool.getThreadCount(), 4u);
+
+    std::vector<std::atomic<int>> visits(1000);
+    pool.parallelFor(0, 1000, 7, [&](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+            visits[i]++;
+        }
+    });
+    for (const auto& count : visits) {
+        EXPECT_EQ(count.load(), 1);
+    }
+}
+
+TEST_F(ThreadPoolTest, ParallelForExceptionTest) {
+    ThreadPool pool(3);
+    EXPECT_THROW(pool.parallelFor(0, 100, 1, [](int begin, int) {
+        if (begin == 42) {
+            throw std::runtime_error("hata");
+        }
+    }), std::runtime_error);
+}
+
+TEST_F(ThreadPoolTest, NestedParallelForTest) {
+    ThreadPool pool(2);
+    std::atomic<int> total{0};
+    pool.parallelFor(0, 8, 1, [&](int, int) {
+        pool.parallelFor(0, 100, 10, [&](int begin, int end) {
+            total += end - begin;
+        });
+    });
+    EXPECT_EQ(total.load(), 800);
+}
+
+TEST_F(ThreadPoolTest, SubmitTest) {
+    std::atomic<int> counter{0};
+    {
+        ThreadPool pool(3);
+        for (int i = 0; i < 50; ++i) {
+            pool.submit([&counter]() { counter++; });
+        }
+    }
+    EXPECT_EQ(counter.load(), 50);
+
+    // Iscisiz havuz gorevi hemen calistirir
+    ThreadPool serial(1);
+    serial.submit([&counter]() { counter++; });
+    EXPECT_EQ(counter.load(), 51);
+}
+
+TEST_F(ThreadPoolTest, SerialParallelIdenticalTest) {
+    GaussianBlur exact_blur(2.0, 9, GaussianBlur::Exact);
+    GaussianBlur box_blur(6.0, 37, GaussianBlur::StackedBox);
+    EdgeDetection edge_filter;
+    BrightnessAdjust bright_filter(1.4);
+    const Filter* filters[] = {&exact_blur, &box_blur, &edge_filter, &bright_filter};
+
+    for (const Filter* filter : filters) {
+        auto serial = applyWithThreads(*filter, 1);
+        for (size_t thread_count : {2u, 3u, 8u}) {
+            auto parallel = applyWithThreads(*filter, thread_count);
+            EXPECT_EQ(parallel->getData(), serial->getData())
+                << filter->getName() << " threads=" << thread_count;
+        }
+    }
+}
+
+TEST_F(ThreadPoolTest, PipelineSerialParallelIdenticalTest) {
+    FilterPipeline pipeline;
+    pipeline.addFilter(std::make_unique<GaussianBlur>(1.5, 5));
+    pipeline.addFilter(std::make_unique<BrightnessAdjust>(1.2));
+    pipeline.addFilter(std::make_unique<EdgeDetection>());
+
+    ThreadPool::setGlobalThreadCount(1);
+    auto serial = pipeline.apply(*test_image);
+    ThreadPool::setGlobalThreadCount(4);
+    auto parallel = pipeline.apply(*test_image);
+    EXPECT_EQ(parallel->getData(), serial->getData());
+
+    pipeline.setExecutionMode(FilterPipeline::Tiled);
+    pipeline.setTileSize(64, 48);
+    auto tiled = pipeline.apply(*test_image);
+    EXPECT_EQ(tiled->getData(), serial->getData());
+}
@@ -0,0 +1,218 @@
+#include <gtest/gtest.h>
+#include "TiledImage.h"
+#include "FilterPipeline.h"
+#include "GaussianBlur.h"
+#include "EdgeDetection.h"
+#include "TestUtils.h"
+#include <filesystem>
+#include <fstream>
+
+using namespace GorselIsleme;
+using namespace GorselIsleme::test;
+
+class TiledImageTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        directory = std::filesystem::temp_directory_path() / "gorselisleme_tiled_test";
+        std::filesystem::remove_all(directory);
+        std::filesystem::create_directories(directory);
+        path = (directory / "goruntu.gtf").string();
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(directory);
+    }
+
+    // Duz alanlar (RLE'ye uygun) ve gurultulu alanlar (sikismayan) karisik
+    static Image makeImage(int width, int height, int channels) {
+        Image image(width, height, channels);
+        unsigned seed = 3u;
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                for (int c = 0; c < channels; ++c) {
+                    const unsigned noise = nextRandom(seed);
+                    image.at(x, y, c) = x < width / 2 ? static_cast<Image::Pixel>(40 * c + (y / 16) * 10)
+                                                      : static_cast<Image::Pixel>(noise);
+                }
+            }
+        }
+        return image;
+    }
+
+    static void writeTiled(const std::string& path, const Image& image, const TiledImageWriter::Options& options) {
+        TiledImageWriter writer(path, image.getWidth(), image.getHeight(), image.getChannels(), options);
+        writer.writeRows(image.view());
+        writer.finish();
+    }
+
+    // Yazicinin piramit kurali: 2x2 ortalama, tek kenarlarda son satir/sutun tekrarlanir
+    static Image downsample(const Image& image) {
+        const int width = (image.getWidth() + 1) / 2;
+        const int height = (image.getHeight() + 1) / 2;
+        Image result(width, height, image.getChannels());
+        for (int y = 0; y < height; ++y) {
+            const int y1 = std::min(2 * y + 1, image.getHeight() - 1);
+            for (int x = 0; x < width; ++x) {
+                const int x1 = std::min(2 * x + 1, image.getWidth() - 1);
+                for (int c = 0; c < image.getChannels(); ++c) {
+                    const int sum = image.at(2 * x, 2 * y, c) + image.at(x1, 2 * y, c) + image.at(2 * x, y1, c) +
+                                    image.at(x1, y1, c);
+                    result.at(x, y, c) = static_cast<Image::Pixel>((sum + 2) >> 2);
+                }
+            }
+        }
+        return result;
+    }
+
+    std::filesystem::path directory;
+    std::string path;
+};
+
+TEST_F(TiledImageTest, RoundTripTest) {
+    for (bool compress : {false, true}) {
+        for (int channels : {1, 3}) {
+            const Image image = makeImage(150, 75, channels);
+            TiledImageWriter::Options options;
+            options.tile_size = 32;
+            options.compress = compress;
+            writeTiled(path, image, options);
+
+            auto reader = TiledImageReader::open(path);
+            ASSERT_NE(reader, nullptr);
+            EXPECT_EQ(reader->getLevelCount(), 1);
+            EXPECT_EQ(reader->getWidth(), 150);
+            EXPECT_EQ(reader->getHeight(), 75);
+            EXPECT_EQ(reader->getChannels(), channels);
+            EXPECT_EQ(reader->readRegion(0, 0, 0, 150, 75)->getData(), image.getData());
+
+            // Karo sinirlarini asan rastgele bolgeler
+            const int regions[][4] = {{0, 0, 1, 1}, {31, 31, 2, 2}, {17, 5, 100, 60}, {149, 74, 1, 1}, {64, 32, 32, 32}};
+            for (const auto& r : regions) {
+                EXPECT_EQ(reader->readRegion(0, r[0], r[1], r[2], r[3])->getData(),
+                          Image(image.view(r[0], r[1], r[2], r[3])).getData())
+                    << compress << " " << r[0] << "," << r[1];
+            }
+        }
+    }
+}
+
+TEST_F(TiledImageTest, CompressionTest) {
+    const Image image = makeImage(256, 256, 1);
+    TiledImageWriter::Options options;
+    options.tile_size = 64;
+    writeTiled(path, image, options);
+    const auto raw_size = std::filesystem::file_size(path);
+
+    options.compress = true;
+    const std::string compressed_path = (directory / "sikistirilmis.gtf").string();
+    writeTiled(compressed_path, image, options);
+    // Goruntunun duz yarisi sikisir, gurultulu yarisi ham (hizali) kalir
+    EXPECT_LT(std::filesystem::file_size(compressed_path), raw_size);
+
+    auto reader = TiledImageReader::open(compressed_path);
+    ASSERT_NE(reader, nullptr);
+    EXPECT_EQ(reader->readRegion(0, 0, 0, 256, 256)->getData(), image.getData());
+
+    // Tamamen duz goruntude yalnizca baslik ve birkac yuz bayt kalir
+    const std::string flat_path = (directory / "duz.gtf").string();
+    writeTiled(flat_path, Image(256, 256, 1), options);
+    EXPECT_LT(std::filesystem::file_size(flat_path), raw_size / 10);
+    auto flat = TiledImageReader::open(flat_path);
+    ASSERT_NE(flat, nullptr);
+    EXPECT_EQ(flat->readRegion(0, 10, 200, 100, 50)->getData(), Image(100, 50, 1).getData());
+}
+
+TEST_F(TiledImageTest, PyramidTest) {
+    const Image image = makeImage(301, 177, 3);
+    TiledImageWriter::Options options;
+    options.tile_size = 64;
+    options.levels = 0;
+    TiledImageWriter writer(path, 301, 177, 3, options);
+    EXPECT_EQ(writer.getLevelCount(), 4); // 301 -> 151 -> 76 -> 38
+    // Satirlar farkli parcalar halinde gelebilir
+    writer.writeRows(image.view(0, 0, 301, 5));
+    writer.writeRows(image.view(0, 5, 301, 100));
+    writer.writeRows(image.view(0, 105, 301, 72));
+    writer.finish();
+
+    auto reader = TiledImageReader::open(path);
+    ASSERT_NE(reader, nullptr);
+    ASSERT_EQ(reader->getLevelCount(), 4);
+    Image expected = image;
+    for (int level = 0; level < 4; ++level) {
+        EXPECT_EQ(reader->getWidth(level), expected.getWidth());
+        EXPECT_EQ(reader->getHeight(level), expected.getHeight());
+        EXPECT_EQ(reader->readRegion(level, 0, 0, expected.getWidth(), expected.getHeight())->getData(),
+                  expected.getData())
+            << level;
+        expected = downsample(expected);
+    }
+    EXPECT_THROW(reader->readRegion(4, 0, 0, 1, 1), std::out_of_range);
+}
+
+TEST_F(TiledImageTest, TouchesOnlyOverlappingTilesTest) {
+    const Image image = makeImage(512, 512, 1);
+    TiledImageWriter::Options options;
+    options.tile_size = 64;
+    writeTiled(path, image, options);
+
+    auto reader = TiledImageReader::open(path);
+    ASSERT_NE(reader, nullptr);
+    reader->readRegion(0, 70, 10, 40, 40);   // tek karo
+    EXPECT_EQ(reader->getTileReadCount(), 1u);
+    reader->readRegion(0, 60, 60, 10, 10);   // dort karo
+    EXPECT_EQ(reader->getTileReadCount(), 5u);
+
+    EXPECT_THROW(reader->readRegion(0, 500, 0, 20, 1), std::out_of_range);
+    EXPECT_THROW(reader->readRegion(0, -1, 0, 1, 1), std::out_of_range);
+    Image color(4, 4, 3);
+    EXPECT_THROW(reader->readRegion(0, 0, 0, color.view()), std::invalid_argument);
+}
+
+TEST_F(TiledImageTest, PipelineWriterTest) {
+    // Pipeline ciktisi serit serit dogrudan karolu dosyaya yazilir
+    FilterPipeline pipeline;
+    pipeline.addFilter(std::make_unique<GaussianBlur>(1.5, 5));
+    pipeline.addFilter(std::make_unique<EdgeDetection>());
+
+    const Image image = makeImage(200, 130, 1);
+    TiledImageWriter::Options options;
+    options.tile_size = 48;
+    options.levels = 2;
+    options.compress = true;
+    TiledImageWriter writer(path, 200, 130, 1, options);
+    ImageRowSource source(image);
+    pipeline.applyStreaming(source, writer, 32);
+
+    auto reader = TiledImageReader::open(path);
+    ASSERT_NE(reader, nullptr);
+    const auto expected = pipeline.apply(image);
+    EXPECT_EQ(reader->readRegion(0, 0, 0, 200, 130)->getData(), expected->getData());
+    EXPECT_EQ(reader->readRegion(1, 0, 0, 100, 65)->getData(), downsample(*expected).getData());
+}
+
+TEST_F(TiledImageTest, InvalidTest) {
+    EXPECT_THROW(TiledImageWriter(path, 0, 10, 1), std::invalid_argument);
+    TiledImageWriter::Options options;
+    options.tile_size = 20;
+    EXPECT_THROW(TiledImageWriter(path, 10, 10, 1, options), std::invalid_argument);
+
+    {
+        TiledImageWriter writer(path, 10, 10, 1);
+        Image rows(10, 4, 1);
+        writer.writeRows(rows.view());
+        EXPECT_THROW(writer.finish(), std::runtime_error);
+        Image too_many(10, 7, 1);
+        EXPECT_THROW(writer.writeRows(too_many.view()), std::out_of_range);
+    }
+
+    EXPECT_EQ(TiledImageReader::open((directory / "yok.gtf").string()), nullptr);
+    std::ofstream(path, std::ios::binary) << "GRSLTILE kisa";
+    EXPECT_EQ(TiledImageReader::open(path), nullptr);
+
+    // Karo verisi dosya sonundan kesilmis
+    const Image image = makeImage(64, 64, 1);
+    writeTiled(path, image, TiledImageWriter::Options());
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 100);
+    EXPECT_EQ(TiledImageReader::open(path), nullptr);
+}
@@ -0,0 +1,224 @@
+#include <gtest/gtest.h>
+#include "PipelineTrace.h"
+#include "FilterPipeline.h"
+#include "GaussianBlur.h"
+#include "EdgeDetection.h"
+#include "BrightnessAdjust.h"
+#include "PointOp.h"
+#include "ThreadPool.h"
+#include "TestUtils.h"
+#include <algorithm>
+#include <atomic>
+#include <sstream>
+#include <thread>
+
+using namespace GorselIsleme;
+using namespace GorselIsleme::test;
+
+// Olaylari oldugu gibi saklayan gozlemci
+class CollectingObserver : public PipelineObserver {
+public:
+    void onStage(const StageEvent& event) override { stages.push_back(event); }
+    void onApply(const ApplyEvent& event) override { applies.push_back(event); }
+
+    std::vector<StageEvent> stages;
+    std::vector<ApplyEvent> applies;
+};
+
+// Adi trace satir tamponundan uzun, girdiyi aynen kopyalayan filtre
+class LongNameFilter : public Filter {
+public:
+    using Filter::apply;
+    void apply(const ConstImageView& input, const ImageView& output) const override {
+        checkViews(input, output);
+        for (int y = 0; y < input.getHeight(); ++y) {
+            std::copy(input.row(y), input.row(y) + input.getRowSize(), output.row(y));
+        }
+    }
+    std::string getName() const override { return "Uzun\"" + std::string(2000, 'x') + "\"Ad"; }
+    std::unique_ptr<Filter> clone() const override { return std::make_unique<LongNameFilter>(); }
+    int getRadius() const override { return 0; }
+};
+
+class PipelineTraceTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        input = makeNoiseImage(120, 90, 3, 5u);
+        pipeline.addFilter(std::make_unique<GaussianBlur>(1.5, 5));
+        pipeline.addFilter(std::make_unique<BrightnessAdjust>(1.2));
+        pipeline.addFilter(std::make_unique<Invert>());
+        pipeline.addFilter(std::make_unique<EdgeDetection>());
+    }
+
+    Image input{1, 1, 1};
+    FilterPipeline pipeline;
+};
+
+TEST_F(PipelineTraceTest, StageEventsTest) {
+    auto observer = std::make_shared<CollectingObserver>();
+    pipeline.setObserver(observer);
+
+    for (auto mode : {FilterPipeline::Sequential, FilterPipeline::Tiled}) {
+        observer->stages.clear();
+        observer->applies.clear();
+        pipeline.setExecutionMode(mode);
+        pipeline.setTileSize(32, 32);
+        pipeline.apply(input);
+
+        // Ardisik nokta islemleri tek asamada birlesir
+        ASSERT_EQ(observer->stages.size(), 3u) << mode;
+        EXPECT_EQ(observer->stages[0].name, "GaussianBlur");
+        EXPECT_EQ(observer->stages[1].name, "BrightnessAdjust+Invert");
+        EXPECT_EQ(observer->stages[2].name, "EdgeDetection");
+        ASSERT_EQ(observer->applies.size(), 1u);
+        const ApplyEvent& apply = observer->applies[0];
+        EXPECT_EQ(apply.width, 120);
+        EXPECT_EQ(apply.stage_count, 3u);
+        EXPECT_EQ(apply.tiled, mode == FilterPipeline::Tiled);
+        for (size_t i = 0; i < observer->stages.size(); ++i) {
+            const StageEvent& stage = observer->stages[i];
+            EXPECT_EQ(stage.apply_id, apply.apply_id);
+            EXPECT_EQ(stage.stage_index, i);
+            EXPECT_EQ(stage.fused, mode == FilterPipeline::Tiled);
+            EXPECT_EQ(stage.pixels, 120u * 90u);
+            EXPECT_GE(stage.duration_us, 0.0);
+            EXPECT_GE(stage.start_us, apply.start_us);
+            EXPECT_LE(stage.thread_utilization, 1.0);
+        }
+    }
+
+    // clone() gozlemciyi paylasir, hazir apply de olay uretir
+    auto copy = pipeline.clone();
+    Image output(input.getWidth(), input.getHeight(), input.getChannels());
+    observer->applies.clear();
+    copy->apply(input, output);
+    EXPECT_EQ(observer->applies.size(), 1u);
+}
+
+TEST_F(PipelineTraceTest, ResultUnchangedTest) {
+    const auto expected = pipeline.apply(input);
+    pipeline.setObserver(std::make_shared<PipelineStats>());
+    EXPECT_EQ(pipeline.apply(input)->getData(), expected->getData());
+    pipeline.setObserver(nullptr);
+    EXPECT_EQ(pipeline.apply(input)->getData(), expected->getData());
+}
+
+TEST_F(PipelineTraceTest, ChromeTraceTest) {
+    auto recorder = std::make_shared<ChromeTraceRecorder>();
+    pipeline.setObserver(recorder);
+    pipeline.apply(input);
+    pipeline.setExecutionMode(FilterPipeline::Tiled);
+    pipeline.apply(input);
+    EXPECT_EQ(recorder->getEventCount(), 8u);
+
+    std::ostringstream out;
+    recorder->write(out);
+    const std::string json = out.str();
+    EXPECT_EQ(json.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["), 0u);
+    EXPECT_EQ(json.substr(json.size() - 3), "]}\n");
+    EXPECT_NE(json.find("\"name\":\"BrightnessAdjust+Invert\""), std::string::npos);
+    EXPECT_NE(json.find("\"ph\":\"M\""), std::string::npos);
+    EXPECT_NE(json.find("\"mode\":\"tiled\""), std::string::npos);
+    // Parantez dengesi ve virgul sonrasi kapanis yok
+    EXPECT_EQ(std::count(json.begin(), json.end(), '{'), std::count(json.begin(), json.end(), '}'));
+    EXPECT_EQ(json.find(",\n]"), std::string::npos);
+
+    recorder->clear();
+    EXPECT_EQ(recorder->getEventCount(), 0u);
+}
+
+TEST_F(PipelineTraceTest, LongStageNameTest) {
+    auto recorder = std::make_shared<ChromeTraceRecorder>();
+    pipeline.setObserver(recorder);
+    pipeline.addFilter(std::make_unique<LongNameFilter>());
+    pipeline.apply(input);
+
+    std::ostringstream out;
+    recorder->write(out);
+    const std::string json = out.str();
+    // Ad kesilmeden ve kacisli yazilir, JSON kapanisi bozulmaz
+    const std::string escaped = "\"name\":\"Uzun\\\"" + std::string(2000, 'x') + "\\\"Ad\"";
+    EXPECT_NE(json.find(escaped), std::string::npos);
+    EXPECT_EQ(json.substr(json.size() - 3), "]}\n");
+    EXPECT_EQ(std::count(json.begin(), json.end(), '{'), std::count(json.begin(), json.end(), '}'));
+}
+
+TEST_F(PipelineTraceTest, ConcurrentAppliesTest) {
+    const size_t saved_thread_count = ThreadPool::global().getThreadCount();
+    ThreadPool::setGlobalThreadCount(4);
+
+    // Arka planda surekli ara tampon ayiran bir pipeline calisir
+    Image large(320, 240, 3);
+    std::copy(input.getData().begin(), input.getData().end(), large.getData().begin());
+    FilterPipeline heavy;
+    heavy.addFilter(std::make_unique<GaussianBlur>(2.0, 7));
+    heavy.addFilter(std::make_unique<EdgeDetection>());
+    auto heavy_observer = std::make_shared<CollectingObserver>();
+    heavy.setObserver(heavy_observer);
+    std::atomic<bool> stop{false};
+    std::atomic<int> heavy_applies{0};
+    std::thread background([&]() {
+        while (!stop.load() || heavy_applies.load() < 3) {
+            heavy.apply(large);
+            ++heavy_applies;
+        }
+    });
+
+    // Ciktisi disinda ayirmasi olmayan nokta islemi pipeline'i
+    FilterPipeline light;
+    light.addFilter(std::make_unique<Invert>());
+    auto light_observer = std::make_shared<CollectingObserver>();
+    light.setObserver(light_observer);
+    for (int i = 0; i < 50; ++i) {
+        light.apply(input);
+    }
+    stop = true;
+    background.join();
+    ThreadPool::setGlobalThreadCount(saved_thread_count);
+
+    // Sayaclar apply basinadir: digerinin ayirmalari ve mesgul suresi karismaz
+    ASSERT_EQ(light_observer->applies.size(), 50u);
+    for (const ApplyEvent& apply : light_observer->applies) {
+        EXPECT_EQ(apply.allocated_bytes, 0u);
+        EXPECT_LE(apply.thread_utilization, 1.0);
+    }
+    for (const StageEvent& stage : light_observer->stages) {
+        EXPECT_EQ(stage.allocated_bytes, 0u);
+    }
+    // Agir pipeline her apply'da en az bir tam ara goruntu ayirir
+    ASSERT_GE(heavy_observer->applies.size(), 3u);
+    for (const ApplyEvent& apply : heavy_observer->applies) {
+        EXPECT_GE(apply.allocated_bytes, 320u * 240u * 3u);
+        EXPECT_GT(apply.thread_utilization, 0.0);
+    }
+}
+
+TEST_F(PipelineTraceTest, StatsTest) {
+    auto stats = std::make_shared<PipelineStats>();
+    auto recorder = std::make_shared<ChromeTraceRecorder>();
+    auto group = std::make_shared<ObserverGroup>();
+    group->add(stats);
+    group->add(recorder);
+    pipeline.setObserver(group);
+    for (int i = 0; i < 10; ++i) {
+        pipeline.apply(input);
+    }
+
+    const auto entries = stats->snapshot();
+    ASSERT_EQ(entries.size(), 3u);
+    // Ada gore sirali
+    EXPECT_EQ(entries[0].name, "BrightnessAdjust+Invert");
+    EXPECT_EQ(entries[1].name, "EdgeDetection");
+    EXPECT_EQ(entries[2].name, "GaussianBlur");
+    for (const auto& entry : entries) {
+        EXPECT_EQ(entry.count, 10u);
+        EXPECT_EQ(entry.pixels, 10u * 120u * 90u);
+        EXPECT_LE(entry.p50_ms, entry.p99_ms);
+        EXPECT_LE(entry.p99_ms, entry.max_ms);
+        EXPECT_LE(entry.max_ms, entry.total_ms);
+    }
+    EXPECT_EQ(recorder->getEventCount(), 40u);
+
+    stats->reset();
+    EXPECT_TRUE(stats->snapshot().empty());
+}